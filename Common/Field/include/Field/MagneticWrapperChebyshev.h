@@ -22,6 +22,7 @@
 #include "MathUtils/Chebyshev3D.h"     // for Chebyshev3D
 #include "MathUtils/Chebyshev3DCalc.h" // for _INC_CREATION_Chebyshev3D_
 #include "Rtypes.h"                    // for Double_t, Int_t, Float_t, etc
+#include <vector>                      // for vector
 
 namespace o2
 {
@@ -210,6 +211,14 @@ class MagneticWrapperChebyshev : public TNamed
   /// it gets it at closest valid point
   virtual void Field(const Double_t* xyz, Double_t* b) const;
 
+  /// Computes field in cartesian coordinates for n points, xyz and b hold n consecutive 3-vectors.
+  /// The points are grouped by parameterization piece and every piece is evaluated for all its points at once.
+  void Field(Int_t n, const Double_t* xyz, Double_t* b) const;
+
+  /// Builds the Z grids used to find solenoid and dipole segments without binary search, must be called
+  /// after the parameterization is loaded or modified (otherwise the binary search is used)
+  void buildSegmentLookup();
+
   /// Computes Bz for the point in cartesian coordinates. If point is outside of the parameterized region
   /// it gets it at closest valid point
   Double_t getBz(const Double_t* xyz) const;
@@ -326,6 +335,17 @@ class MagneticWrapperChebyshev : public TNamed
   Double_t fieldCylindricalSolenoidBz(const Double_t* rphiz) const;
 
  private:
+  /// Uniform grid in Z storing for every cell the Z segment containing its lower edge
+  struct ZSegmentLookup {
+    Float_t zMin = 0.f;                 ///< lower edge of the grid
+    Float_t scale = 0.f;                ///< number of cells per cm
+    std::vector<Int_t> segmentAtCell{}; ///< Z segment at the lower edge of each cell
+
+    void build(const Float_t* segZ, Int_t nSegZ);
+    /// same result as TMath::BinarySearch(nSegZ, segZ, z)
+    Int_t find(const Float_t* segZ, Int_t nSegZ, Float_t z) const;
+  };
+
   Int_t mNumberOfParameterizationSolenoid;  ///< Total number of parameterization pieces for solenoid
   Int_t mNumberOfDistinctZSegmentsSolenoid; ///< number of distinct Z segments in Solenoid
   Int_t mNumberOfDistinctPSegmentsSolenoid; ///< number of distinct P segments in Solenoid
@@ -414,6 +434,9 @@ class MagneticWrapperChebyshev : public TNamed
   Float_t mMaxDipoleZ;                ///< Max Z of Dipole parameterization
   TObjArray* mParameterizationDipole; ///< Parameterization pieces for Dipole field
 
+  ZSegmentLookup mZLookupSolenoid; //! Z segment lookup grid for Solenoid
+  ZSegmentLookup mZLookupDipole;   //! Z segment lookup grid for Dipole
+
   ClassDefOverride(o2::field::MagneticWrapperChebyshev,
                    2) // Wrapper class for the set of Chebishev parameterizations of Alice mag.field
 };
@@ -254,6 +254,7 @@ Bool_t MagneticField::loadParameterization()
     LOG(fatal) << "MagneticField::loadParameterization: Did not find field " << getParameterName() << " in " << fname
                << "%s\n";
   }
+  mMeasuredMap->buildSegmentLookup();
   file->Close();
   delete file;
   return kTRUE;
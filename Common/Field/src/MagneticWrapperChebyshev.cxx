@@ -19,6 +19,7 @@
 #include <TSystem.h>    // for TSystem, gSystem
 #include <cstdio>       // for printf, fprintf, fclose, fopen, FILE
 #include <cstring>      // for memcpy
+#include <algorithm>    // for copy_n
 #include <fairlogger/Logger.h> // for FairLogger
 #include "TMath.h"      // for BinarySearch, Sort
 #include "TMathBase.h"  // for Abs
@@ -291,6 +292,8 @@ void MagneticWrapperChebyshev::copyFrom(const MagneticWrapperChebyshev& src)
       mParameterizationDipole->AddAtAndExpand(new Chebyshev3D(*src.getParameterDipole(i)), i);
     }
   }
+  mZLookupSolenoid = src.mZLookupSolenoid;
+  mZLookupDipole = src.mZLookupDipole;
 }
 
 MagneticWrapperChebyshev& MagneticWrapperChebyshev::operator=(const MagneticWrapperChebyshev& rhs)
@@ -414,6 +417,9 @@ void MagneticWrapperChebyshev::Clear(const Option_t*)
     mNumberOfDistinctXSegmentsDipole = 0;
   mMinDipoleZ = 1e6;
   mMaxDipoleZ = -1e6;
+
+  mZLookupSolenoid = ZSegmentLookup{};
+  mZLookupDipole = ZSegmentLookup{};
 }
 
 void MagneticWrapperChebyshev::Field(const Double_t* xyz, Double_t* b) const
@@ -445,6 +451,86 @@ void MagneticWrapperChebyshev::Field(const Double_t* xyz, Double_t* b) const
   par->Eval(xyz, b);
 }
 
+void MagneticWrapperChebyshev::Field(Int_t n, const Double_t* xyz, Double_t* b) const
+{
+  // segment of every point: solenoid pieces first, then the dipole ones, -1 if the field is 0
+  const int nSegTot = mNumberOfParameterizationSolenoid + mNumberOfParameterizationDipole;
+  std::vector<Int_t> segment(n);
+  std::vector<Double_t> coord(3 * n); // rphiz for the solenoid, xyz for the dipole
+  for (int ip = 0; ip < n; ip++) {
+    const Double_t* pnt = xyz + 3 * ip;
+    Double_t* crd = &coord[3 * ip];
+    b[3 * ip] = b[3 * ip + 1] = b[3 * ip + 2] = 0;
+    segment[ip] = -1;
+    Chebyshev3D* par = nullptr;
+    if (pnt[2] > mMinZSolenoid) {
+      cartesianToCylindrical(pnt, crd);
+      int id = findSolenoidSegment(crd);
+      if (id >= 0) {
+        segment[ip] = id;
+        par = getParameterSolenoid(id);
+      }
+    } else {
+      crd[0] = pnt[0];
+      crd[1] = pnt[1];
+      crd[2] = pnt[2];
+      int id = findDipoleSegment(pnt);
+      if (id >= 0) {
+        segment[ip] = mNumberOfParameterizationSolenoid + id;
+        par = getParameterDipole(id);
+      }
+    }
+#ifndef _BRING_TO_BOUNDARY_ // exact matching to fitted volume is requested
+    if (par && !par->isInside(crd)) {
+      segment[ip] = -1;
+    }
+#endif
+  }
+
+  // order the points by segment (counting sort) to evaluate every parameterization piece once
+  std::vector<Int_t> segStart(nSegTot + 1, 0);
+  for (int ip = 0; ip < n; ip++) {
+    if (segment[ip] >= 0) {
+      segStart[segment[ip] + 1]++;
+    }
+  }
+  for (int is = 0; is < nSegTot; is++) {
+    segStart[is + 1] += segStart[is];
+  }
+  std::vector<Int_t> order(segStart[nSegTot]);
+  std::vector<Int_t> fillPos(segStart.begin(), segStart.end() - 1);
+  for (int ip = 0; ip < n; ip++) {
+    if (segment[ip] >= 0) {
+      order[fillPos[segment[ip]]++] = ip;
+    }
+  }
+
+  std::vector<Double_t> crdSeg, bSeg;
+  for (int is = 0; is < nSegTot; is++) {
+    const int np = segStart[is + 1] - segStart[is];
+    if (!np) {
+      continue;
+    }
+    crdSeg.resize(3 * np);
+    bSeg.resize(3 * np);
+    for (int i = 0; i < np; i++) {
+      std::copy_n(&coord[3 * order[segStart[is] + i]], 3, &crdSeg[3 * i]);
+    }
+    const bool isSolenoid = is < mNumberOfParameterizationSolenoid;
+    const Chebyshev3D* par = isSolenoid ? getParameterSolenoid(is) : getParameterDipole(is - mNumberOfParameterizationSolenoid);
+    par->Eval(np, crdSeg.data(), bSeg.data());
+    for (int i = 0; i < np; i++) {
+      const int ip = order[segStart[is] + i];
+      if (isSolenoid) {
+        // convert field to cartesian system
+        cylindricalToCartesianCylB(&crdSeg[3 * i], &bSeg[3 * i], b + 3 * ip);
+      } else {
+        std::copy_n(&bSeg[3 * i], 3, b + 3 * ip);
+      }
+    }
+  }
+}
+
 Double_t MagneticWrapperChebyshev::getBz(const Double_t* xyz) const
 {
   Double_t rphiz[3];
@@ -513,8 +599,8 @@ Int_t MagneticWrapperChebyshev::findDipoleSegment(const Double_t* xyz) const
   if (!mNumberOfParameterizationDipole) {
     return -1;
   }
-  int xid, yid, zid = TMath::BinarySearch(mNumberOfDistinctZSegmentsDipole, mCoordinatesSegmentsZDipole,
-                                          (Float_t)xyz[2]); // find zsegment
+  int xid, yid, zid = mZLookupDipole.find(mCoordinatesSegmentsZDipole, mNumberOfDistinctZSegmentsDipole,
+                                           (Float_t)xyz[2]); // find zsegment
 
   Bool_t reCheck = kFALSE;
   while (true) {
@@ -554,13 +640,53 @@ Int_t MagneticWrapperChebyshev::findDipoleSegment(const Double_t* xyz) const
   return mSegmentIdDipole[xid];
 }
 
+void MagneticWrapperChebyshev::ZSegmentLookup::build(const Float_t* segZ, Int_t nSegZ)
+{
+  segmentAtCell.clear();
+  if (nSegZ < 2 || segZ[nSegZ - 1] <= segZ[0]) {
+    return;
+  }
+  // few cells per segment on average keep the residual linear search at 1-2 steps
+  const int nCells = 4 * nSegZ;
+  zMin = segZ[0];
+  scale = nCells / (segZ[nSegZ - 1] - segZ[0]);
+  segmentAtCell.resize(nCells);
+  for (int ic = 0; ic < nCells; ic++) {
+    segmentAtCell[ic] = TMath::BinarySearch(nSegZ, segZ, Float_t(zMin + ic / scale));
+  }
+}
+
+Int_t MagneticWrapperChebyshev::ZSegmentLookup::find(const Float_t* segZ, Int_t nSegZ, Float_t z) const
+{
+  if (segmentAtCell.empty() || !(z >= zMin)) {
+    return TMath::BinarySearch(nSegZ, segZ, z);
+  }
+  const int nCells = segmentAtCell.size();
+  int ic = int((z - zMin) * scale);
+  int zid = segmentAtCell[ic < nCells ? ic : nCells - 1];
+  // correct for the rounding of the cell boundaries
+  while (zid > 0 && segZ[zid] > z) {
+    zid--;
+  }
+  while (zid + 1 < nSegZ && segZ[zid + 1] <= z) {
+    zid++;
+  }
+  return zid;
+}
+
+void MagneticWrapperChebyshev::buildSegmentLookup()
+{
+  mZLookupSolenoid.build(mCoordinatesSegmentsZSolenoid, mNumberOfDistinctZSegmentsSolenoid);
+  mZLookupDipole.build(mCoordinatesSegmentsZDipole, mNumberOfDistinctZSegmentsDipole);
+}
+
 Int_t MagneticWrapperChebyshev::findSolenoidSegment(const Double_t* rpz) const
 {
   if (!mNumberOfParameterizationSolenoid) {
     return -1;
   }
-  int rid, pid, zid = TMath::BinarySearch(mNumberOfDistinctZSegmentsSolenoid, mCoordinatesSegmentsZSolenoid,
-                                          (Float_t)rpz[2]); // find zsegment
+  int rid, pid, zid = mZLookupSolenoid.find(mCoordinatesSegmentsZSolenoid, mNumberOfDistinctZSegmentsSolenoid,
+                                             (Float_t)rpz[2]); // find zsegment
 
   Bool_t reCheck = kFALSE;
   while (true) {
@@ -913,6 +1039,7 @@ void MagneticWrapperChebyshev::loadData(const char* inpfile)
   buildTableDipole();
   buildTableTPCIntegral();
   buildTableTPCRatIntegral();
+  buildSegmentLookup();
 
   printf("Loaded magnetic field \"%s\" from %s\n", GetName(), strf.Data());
 }
@@ -16,7 +16,9 @@
 #include <iostream>
 #include "Field/MagneticField.h"
 #include "Field/MagFieldFast.h"
+#include "Field/MagneticWrapperChebyshev.h"
 #include <memory>
+#include <vector>
 #include <fairlogger/Logger.h> // for FairLogger
 #include <TStopwatch.h>
 #include <TRandom.h>
@@ -98,3 +100,64 @@ BOOST_AUTO_TEST_CASE(MagneticField_test)
     BOOST_CHECK(TMath::Abs(rms[i] / nomBz) < 1.e-3);
   }
 }
+
+BOOST_AUTO_TEST_CASE(MagneticWrapperChebyshevBatch_test)
+{
+  std::unique_ptr<MagneticField> fld = std::make_unique<MagneticField>("Maps", "Maps", 1., 1., o2::field::MagFieldParam::k5kG);
+  const MagneticWrapperChebyshev* map = fld->getMeasuredMap();
+  BOOST_REQUIRE(map);
+
+  // points in the solenoid and in the dipole regions
+  const int ntst = 10000;
+  std::vector<double> xyz(3 * ntst), bPoint(3 * ntst), bBatch(3 * ntst);
+  float rnd[3];
+  for (int it = 0; it < ntst; it++) {
+    gRandom->RndmArray(3, rnd);
+    xyz[3 * it + 0] = rnd[0] * 400. * TMath::Cos(rnd[1] * TMath::Pi() * 2);
+    xyz[3 * it + 1] = rnd[0] * 400. * TMath::Sin(rnd[1] * TMath::Pi() * 2);
+    xyz[3 * it + 2] = it % 4 ? (rnd[2] - 0.5) * 900 : -600. - rnd[2] * 1000.;
+  }
+
+  const int repFactor = 50;
+  TStopwatch swPoint;
+  swPoint.Start();
+  for (int ii = repFactor; ii--;) {
+    for (int it = ntst; it--;) {
+      map->Field(&xyz[3 * it], &bPoint[3 * it]);
+    }
+  }
+  swPoint.Stop();
+
+  TStopwatch swBatch;
+  swBatch.Start();
+  for (int ii = repFactor; ii--;) {
+    map->Field(ntst, xyz.data(), bBatch.data());
+  }
+  swBatch.Stop();
+
+  // fast parameterization is valid only in the solenoid region, time it on the same points for reference
+  fld->AllowFastField(true);
+  const MagFieldFast* fast = fld->getFastField();
+  BOOST_REQUIRE(fast);
+  double bfast[3];
+  TStopwatch swFast;
+  swFast.Start();
+  for (int ii = repFactor; ii--;) {
+    for (int it = ntst; it--;) {
+      fast->Field(&xyz[3 * it], bfast);
+    }
+  }
+  swFast.Stop();
+
+  double sP = swPoint.CpuTime() / (ntst * repFactor);
+  double sB = swBatch.CpuTime() / (ntst * repFactor);
+  double sF = swFast.CpuTime() / (ntst * repFactor);
+  LOG(info) << "Timing: per point param: " << sP << " batched param: " << sB << " fast param: " << sF
+            << " s/point -> batched speed-up " << (sB > 0. ? sP / sB : -1.);
+
+  for (int it = 0; it < ntst; it++) {
+    for (int i = 0; i < 3; i++) {
+      BOOST_CHECK_SMALL(bBatch[3 * it + i] - bPoint[3 * it + i], 1.e-6);
+    }
+  }
+}
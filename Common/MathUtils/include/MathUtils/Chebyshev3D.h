@@ -53,6 +53,8 @@ namespace math_utils
 /// To compute the interpolation use Eval(float* par,float *res) method, with par being 3D vector of arguments
 /// (inside the validity region) and res is the array of DimOut elements for the output.
 /// If only one component (say, idim-th) of the output is needed, use faster Float_t Eval(Float_t *par,int idim) method
+/// The Eval methods can be called concurrently on the same object, the evaluateDerivative* methods use member
+/// temporaries and can not.
 /// void Print(option="") will print the name, the ranges of validity and the absolute precision of the
 /// parameterization. Option "l" will also print the information about the number of coefficients for each output
 /// dimension.
@@ -136,6 +138,10 @@ class Chebyshev3D : public TNamed
 
   Double_t Eval(const Double_t* par, int idim);
 
+  /// Evaluates Chebyshev parameterization for n points, par and res are arrays of n consecutive 3D arguments
+  /// resp. DimOut results. Unlike the single point methods this one does not use member temporaries.
+  void Eval(int n, const Double_t* par, Double_t* res) const;
+
   void evaluateDerivative(int dimd, const Float_t* par, Float_t* res);
 
   void evaluateDerivative2(int dimd1, int dimd2, const Float_t* par, Float_t* res);
@@ -254,7 +260,7 @@ class Chebyshev3D : public TNamed
 
   Int_t mMaxCoefficients;               //! max possible number of coefs per parameterization
   Int_t mNumberOfPoints[3];             //! number of used points in each dimension
-  Float_t mTemporaryCoefficient[3];     //! temporary vector for coefs calculation
+  Float_t mTemporaryCoefficient[3];     //! temporary vector for coefs calculation of the derivatives
   Float_t* mTemporaryUserResults;       //! temporary vector for results of user function calculation
   Float_t* mTemporaryChebyshevGrid;     //! temporary buffer for Chebyshef roots grid
   Int_t mTemporaryChebyshevGridOffs[3]; //! start of grid for each dimension
@@ -292,41 +298,45 @@ inline Bool_t Chebyshev3D::isInside(const Double_t* par) const
 /// Evaluates Chebyshev parameterization for 3d->DimOut function
 inline void Chebyshev3D::Eval(const Float_t* par, Float_t* res)
 {
+  Float_t x[3]; // not the member temporary, so that the field can be queried concurrently
   for (int i = 3; i--;) {
-    mTemporaryCoefficient[i] = mapToInternal(par[i], i);
+    x[i] = mapToInternal(par[i], i);
   }
   for (int i = mOutputArrayDimension; i--;) {
-    res[i] = getChebyshevCalc(i)->Eval(mTemporaryCoefficient);
+    res[i] = getChebyshevCalc(i)->Eval(x);
   }
 }
 
 /// Evaluates Chebyshev parameterization for 3d->DimOut function
 inline void Chebyshev3D::Eval(const Double_t* par, Double_t* res)
 {
+  Float_t x[3];
   for (int i = 3; i--;) {
-    mTemporaryCoefficient[i] = mapToInternal(par[i], i);
+    x[i] = mapToInternal(par[i], i);
   }
   for (int i = mOutputArrayDimension; i--;) {
-    res[i] = getChebyshevCalc(i)->Eval(mTemporaryCoefficient);
+    res[i] = getChebyshevCalc(i)->Eval(x);
   }
 }
 
 /// Evaluates Chebyshev parameterization for idim-th output dimension of 3d->DimOut function
 inline Double_t Chebyshev3D::Eval(const Double_t* par, int idim)
 {
+  Float_t x[3];
   for (int i = 3; i--;) {
-    mTemporaryCoefficient[i] = mapToInternal(par[i], i);
+    x[i] = mapToInternal(par[i], i);
   }
-  return getChebyshevCalc(idim)->Eval(mTemporaryCoefficient);
+  return getChebyshevCalc(idim)->Eval(x);
 }
 
 /// Evaluates Chebyshev parameterization for idim-th output dimension of 3d->DimOut function
 inline Float_t Chebyshev3D::Eval(const Float_t* par, int idim)
 {
+  Float_t x[3];
   for (int i = 3; i--;) {
-    mTemporaryCoefficient[i] = mapToInternal(par[i], i);
+    x[i] = mapToInternal(par[i], i);
   }
-  return getChebyshevCalc(idim)->Eval(mTemporaryCoefficient);
+  return getChebyshevCalc(idim)->Eval(x);
 }
 
 /// Returns the gradient matrix
@@ -169,7 +169,25 @@ class Chebyshev3DCalc : public TNamed
 
   Double_t Eval(const Double_t* par) const;
 
+  /// Evaluates Chebyshev parameterization for n points of 3D function, par[d][i] is d-th argument of the i-th point.
+  /// The points are processed in blocks of kEvalBlock with the recurrences running over the points in the innermost loop.
+  /// VERY IMPORTANT: par must contain the function arguments ALREADY MAPPED to [-1:1] interval
+  void Eval(int n, const Float_t* const* par, Float_t* res) const;
+
+  /// Evaluates 1D Chebyshev parameterizations for n <= kEvalBlock points, coefficient k of point i is array[k * stride + i]
+  static void chebyshevEvaluation1D(int n, const Float_t* x, const Float_t* array, int stride, int ncf, Float_t* res);
+  /// Evaluates one 1D Chebyshev parameterization, with coefficients array[k], for n <= kEvalBlock points
+  static void chebyshevEvaluation1D(int n, const Float_t* x, const Float_t* array, int ncf, Float_t* res);
+
+  static constexpr int kEvalBlock = 64;       ///< number of points evaluated together by the batched Eval
+  static constexpr int kMaxRowsColumns = 128; ///< max number of rows and of columns for the work space of Eval on the stack
+
  private:
+  /// Evaluates the parameterization at the mapped point x, y, z with the work space tmp2D[mNumberOfColumns], tmp1D[mNumberOfRows]
+  Float_t evaluate(Float_t x, Float_t y, Float_t z, Float_t* tmp2D, Float_t* tmp1D) const;
+  /// Evaluates the parameterization with per-thread work space, for more than kMaxRowsColumns rows or columns
+  Float_t evaluateLarge(Float_t x, Float_t y, Float_t z) const;
+
   Int_t mNumberOfCoefficients;    ///< total number of coeeficients
   Int_t mNumberOfRows;            ///< number of significant rows in the 3D coeffs matrix
   Int_t mNumberOfColumns;         ///< max number of significant cols in the 3D coeffs matrix
@@ -187,6 +205,7 @@ class Chebyshev3DCalc : public TNamed
   // coeffs for col/row
   Float_t* mCoefficients; //[mNumberOfCoefficients] array of Chebyshev coefficients
 
+  // temporaries of the derivative evaluation, which is therefore not thread safe (Eval does not use them)
   Float_t* mTemporaryCoefficients2D; //[mNumberOfColumns] temp. coeffs for 2d summation
   Float_t* mTemporaryCoefficients1D; //[mNumberOfRows] temp. coeffs for 1d summation
 
@@ -213,36 +232,45 @@ inline Float_t Chebyshev3DCalc::chebyshevEvaluation1D(Float_t x, const Float_t*
   return b0 - x * b1;
 }
 
-/// Evaluates Chebyshev parameterization for 3D function.
-/// VERY IMPORTANT: par must contain the function arguments ALREADY MAPPED to [-1:1] interval
-inline Float_t Chebyshev3DCalc::Eval(const Float_t* par) const
+/// Evaluates Chebyshev parameterization for 3D function, x, y and z ALREADY MAPPED to [-1:1] interval
+inline Float_t Chebyshev3DCalc::evaluate(Float_t x, Float_t y, Float_t z, Float_t* tmp2D, Float_t* tmp1D) const
 {
   for (int id0 = mNumberOfRows; id0--;) {
     int nCLoc = mNumberOfColumnsAtRow[id0]; // number of significant coefs on this row
     int col0 = mColumnAtRowBeginning[id0];  // beginning of local column in the 2D boundary matrix
     for (int id1 = nCLoc; id1--;) {
       int id = id1 + col0;
-      mTemporaryCoefficients2D[id1] = chebyshevEvaluation1D(par[2], mCoefficients + mCoefficientBound2D1[id], mCoefficientBound2D0[id]);
+      tmp2D[id1] = chebyshevEvaluation1D(z, mCoefficients + mCoefficientBound2D1[id], mCoefficientBound2D0[id]);
     }
-    mTemporaryCoefficients1D[id0] = chebyshevEvaluation1D(par[1], mTemporaryCoefficients2D, nCLoc);
+    tmp1D[id0] = chebyshevEvaluation1D(y, tmp2D, nCLoc);
   }
-  return chebyshevEvaluation1D(par[0], mTemporaryCoefficients1D, mNumberOfRows);
+  return chebyshevEvaluation1D(x, tmp1D, mNumberOfRows);
+}
+
+/// Evaluates Chebyshev parameterization for 3D function.
+/// VERY IMPORTANT: par must contain the function arguments ALREADY MAPPED to [-1:1] interval
+inline Float_t Chebyshev3DCalc::Eval(const Float_t* par) const
+{
+  // a streamed parameterization is not checked against kMaxRowsColumns
+  if (mNumberOfRows > kMaxRowsColumns || mNumberOfColumns > kMaxRowsColumns) {
+    return evaluateLarge(par[0], par[1], par[2]);
+  }
+  // work space on the stack, so that the function can be evaluated concurrently
+  Float_t tmp2D[kMaxRowsColumns], tmp1D[kMaxRowsColumns];
+  return evaluate(par[0], par[1], par[2], tmp2D, tmp1D);
 }
 
 /// Evaluates Chebyshev parameterization for 3D function.
 /// VERY IMPORTANT: par must contain the function arguments ALREADY MAPPED to [-1:1] interval
 inline Double_t Chebyshev3DCalc::Eval(const Double_t* par) const
 {
-  for (int id0 = mNumberOfRows; id0--;) {
-    int nCLoc = mNumberOfColumnsAtRow[id0]; // number of significant coefs on this row
-    int col0 = mColumnAtRowBeginning[id0];  // beginning of local column in the 2D boundary matrix
-    for (int id1 = nCLoc; id1--;) {
-      int id = id1 + col0;
-      mTemporaryCoefficients2D[id1] = chebyshevEvaluation1D(par[2], mCoefficients + mCoefficientBound2D1[id], mCoefficientBound2D0[id]);
-    }
-    mTemporaryCoefficients1D[id0] = chebyshevEvaluation1D(par[1], mTemporaryCoefficients2D, nCLoc);
+  // a streamed parameterization is not checked against kMaxRowsColumns
+  if (mNumberOfRows > kMaxRowsColumns || mNumberOfColumns > kMaxRowsColumns) {
+    return evaluateLarge(par[0], par[1], par[2]);
   }
-  return chebyshevEvaluation1D(par[0], mTemporaryCoefficients1D, mNumberOfRows);
+  // work space on the stack, so that the function can be evaluated concurrently
+  Float_t tmp2D[kMaxRowsColumns], tmp1D[kMaxRowsColumns];
+  return evaluate(par[0], par[1], par[2], tmp2D, tmp1D);
 }
 } // namespace math_utils
 } // namespace o2
@@ -27,6 +27,7 @@
 #include "TNamed.h"                    // for TNamed
 #include "TObjArray.h"                 // for TObjArray
 #include <fairlogger/Logger.h>         // for FairLogger
+#include <algorithm>                   // for min
 
 using namespace o2::math_utils;
 
@@ -307,6 +308,28 @@ void Chebyshev3D::Clear(const Option_t*)
   mChebyshevParameter.Delete();
 }
 
+void Chebyshev3D::Eval(int n, const Double_t* par, Double_t* res) const
+{
+  constexpr int kBlock = Chebyshev3DCalc::kEvalBlock;
+  Float_t mapped[3][kBlock];
+  const Float_t* mappedPtr[3] = {mapped[0], mapped[1], mapped[2]};
+  Float_t resBlock[kBlock];
+  for (int start = 0; start < n; start += kBlock) {
+    const int np = std::min(kBlock, n - start);
+    for (int ip = 0; ip < np; ip++) {
+      for (int i = 3; i--;) {
+        mapped[i][ip] = mapToInternal(par[3 * (start + ip) + i], i);
+      }
+    }
+    for (int i = mOutputArrayDimension; i--;) {
+      getChebyshevCalc(i)->Eval(np, mappedPtr, resBlock);
+      for (int ip = 0; ip < np; ip++) {
+        res[mOutputArrayDimension * (start + ip) + i] = resBlock[ip];
+      }
+    }
+  }
+}
+
 void Chebyshev3D::Print(const Option_t* opt) const
 {
   // print info
@@ -17,6 +17,8 @@
 #include <TSystem.h> // for TSystem, gSystem
 #include "TNamed.h"  // for TNamed
 #include "TString.h" // for TString, TString::EStripType::kBoth
+#include <algorithm> // for fill_n, min
+#include <vector>    // for vector
 
 using namespace o2::math_utils;
 
@@ -203,6 +205,92 @@ void Chebyshev3DCalc::Print(const Option_t*) const
   printf("%d coefficients in %dx%dx%d matrix\n", mNumberOfCoefficients, mNumberOfRows, mNumberOfColumns, nmax3d);
 }
 
+void Chebyshev3DCalc::chebyshevEvaluation1D(int n, const Float_t* x, const Float_t* array, int stride, int ncf, Float_t* res)
+{
+  if (ncf <= 0) {
+    std::fill_n(res, n, 0.f);
+    return;
+  }
+  // same recurrence as the single point version, so that the results are identical
+  Float_t b0[kEvalBlock], b1[kEvalBlock], b2[kEvalBlock];
+  --ncf;
+  for (int ip = 0; ip < n; ip++) {
+    b0[ip] = array[ncf * stride + ip];
+    b1[ip] = b2[ip] = 0;
+  }
+  for (int i = ncf; i--;) {
+    const Float_t* cf = array + i * stride;
+    for (int ip = 0; ip < n; ip++) {
+      const Float_t x2 = x[ip] + x[ip];
+      b2[ip] = b1[ip];
+      b1[ip] = b0[ip];
+      b0[ip] = cf[ip] + x2 * b1[ip] - b2[ip];
+    }
+  }
+  for (int ip = 0; ip < n; ip++) {
+    res[ip] = b0[ip] - x[ip] * b1[ip];
+  }
+}
+
+void Chebyshev3DCalc::chebyshevEvaluation1D(int n, const Float_t* x, const Float_t* array, int ncf, Float_t* res)
+{
+  if (ncf <= 0) {
+    std::fill_n(res, n, 0.f);
+    return;
+  }
+  // same recurrence as the single point version, so that the results are identical
+  Float_t b0[kEvalBlock], b1[kEvalBlock], b2[kEvalBlock];
+  --ncf;
+  for (int ip = 0; ip < n; ip++) {
+    b0[ip] = array[ncf];
+    b1[ip] = b2[ip] = 0;
+  }
+  for (int i = ncf; i--;) {
+    const Float_t cf = array[i];
+    for (int ip = 0; ip < n; ip++) {
+      const Float_t x2 = x[ip] + x[ip];
+      b2[ip] = b1[ip];
+      b1[ip] = b0[ip];
+      b0[ip] = cf + x2 * b1[ip] - b2[ip];
+    }
+  }
+  for (int ip = 0; ip < n; ip++) {
+    res[ip] = b0[ip] - x[ip] * b1[ip];
+  }
+}
+
+Float_t Chebyshev3DCalc::evaluateLarge(Float_t x, Float_t y, Float_t z) const
+{
+  // per-thread work space, too large for the stack
+  static thread_local std::vector<Float_t> tmp2D, tmp1D;
+  tmp2D.resize(mNumberOfColumns);
+  tmp1D.resize(mNumberOfRows);
+  return evaluate(x, y, z, tmp2D.data(), tmp1D.data());
+}
+
+void Chebyshev3DCalc::Eval(int n, const Float_t* const* par, Float_t* res) const
+{
+  // per-thread work space, too large for the stack
+  static thread_local std::vector<Float_t> tmp2D, tmp1D;
+  tmp2D.resize(mNumberOfColumns * kEvalBlock);
+  tmp1D.resize(mNumberOfRows * kEvalBlock);
+
+  for (int start = 0; start < n; start += kEvalBlock) {
+    const int np = std::min(kEvalBlock, n - start);
+    for (int id0 = mNumberOfRows; id0--;) {
+      int nCLoc = mNumberOfColumnsAtRow[id0]; // number of significant coefs on this row
+      int col0 = mColumnAtRowBeginning[id0];  // beginning of local column in the 2D boundary matrix
+      for (int id1 = nCLoc; id1--;) {
+        int id = id1 + col0;
+        // coefficients along the 3rd dimension are shared by all points
+        chebyshevEvaluation1D(np, par[2] + start, mCoefficients + mCoefficientBound2D1[id], mCoefficientBound2D0[id], tmp2D.data() + id1 * kEvalBlock);
+      }
+      chebyshevEvaluation1D(np, par[1] + start, tmp2D.data(), kEvalBlock, nCLoc, tmp1D.data() + id0 * kEvalBlock);
+    }
+    chebyshevEvaluation1D(np, par[0] + start, tmp1D.data(), kEvalBlock, mNumberOfRows, res + start);
+  }
+}
+
 Float_t Chebyshev3DCalc::evaluateDerivative(int dim, const Float_t* par) const
 {
   int ncfRC;
@@ -0,0 +1,175 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test Chebyshev3DCalc
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "MathUtils/Chebyshev3DCalc.h"
+#include <TRandom.h>
+#include <TStopwatch.h>
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using o2::math_utils::Chebyshev3DCalc;
+
+namespace
+{
+// parameterization with rows of different lengths and a different number of
+// coefficients for each row/column element, in the format of loadData
+std::string makeParameterization(const std::vector<int>& nColsAtRow = {4, 2, 3, 1})
+{
+  std::ostringstream str;
+  str << "START testCalc\n"
+      << nColsAtRow.size() << "\n";
+  int nElements = 0;
+  for (auto ncols : nColsAtRow) {
+    str << ncols << "\n";
+    nElements += ncols;
+  }
+  int nCoefs = 0;
+  for (int i = 0; i < nElements; i++) {
+    str << 1 + (i * 5) % 7 << "\n";
+    nCoefs += 1 + (i * 5) % 7;
+  }
+  for (int i = 0; i < nCoefs; i++) {
+    str << gRandom->Uniform(-1., 1.) << "\n";
+  }
+  str << "1e-6\n"
+      << "END testCalc\n";
+  return str.str();
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(Chebyshev3DCalcBroadcast1D_test)
+{
+  const Float_t cf[] = {1.f, 2.f, 3.f, 4.f, 5.f};
+  const Float_t x[] = {0.1f, 0.5f, -0.3f};
+  Float_t res[3];
+  Chebyshev3DCalc::chebyshevEvaluation1D(3, x, cf, 5, res);
+  for (int ip = 0; ip < 3; ip++) {
+    BOOST_CHECK_CLOSE(res[ip], Chebyshev3DCalc::chebyshevEvaluation1D(x[ip], cf, 5), 1e-4);
+  }
+  Chebyshev3DCalc::chebyshevEvaluation1D(3, x, cf, 0, res);
+  for (int ip = 0; ip < 3; ip++) {
+    BOOST_CHECK_EQUAL(res[ip], 0.f);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Chebyshev3DCalcBatch_test)
+{
+  gRandom->SetSeed(42);
+  auto text = makeParameterization();
+  FILE* stream = fmemopen(text.data(), text.size(), "r");
+  BOOST_REQUIRE(stream);
+  Chebyshev3DCalc calc(stream);
+  fclose(stream);
+
+  // not a multiple of the block size, to check the last partial block
+  const int nPoints = 10 * Chebyshev3DCalc::kEvalBlock + 17;
+  std::vector<Float_t> coords[3], res(nPoints);
+  for (auto& c : coords) {
+    c.resize(nPoints);
+    for (auto& v : c) {
+      v = gRandom->Uniform(-1., 1.);
+    }
+  }
+  const Float_t* par[3] = {coords[0].data(), coords[1].data(), coords[2].data()};
+  calc.Eval(nPoints, par, res.data());
+
+  for (int ip = 0; ip < nPoints; ip++) {
+    const Float_t point[3] = {coords[0][ip], coords[1][ip], coords[2][ip]};
+    auto ref = calc.Eval(point);
+    BOOST_CHECK_SMALL(res[ip] - ref, 1e-5f * (1.f + std::abs(ref)));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Chebyshev3DCalcConcurrentEval_test)
+{
+  gRandom->SetSeed(7);
+  auto text = makeParameterization();
+  FILE* stream = fmemopen(text.data(), text.size(), "r");
+  BOOST_REQUIRE(stream);
+  Chebyshev3DCalc calc(stream);
+  fclose(stream);
+
+  const int nPoints = 100000;
+  std::vector<Float_t> points(3 * nPoints), ref(nPoints);
+  for (auto& v : points) {
+    v = gRandom->Uniform(-1., 1.);
+  }
+  // timing of the single point evaluation
+  TStopwatch sw;
+  sw.Start();
+  for (int ip = 0; ip < nPoints; ip++) {
+    ref[ip] = calc.Eval(&points[3 * ip]);
+  }
+  sw.Stop();
+  BOOST_TEST_MESSAGE("Timing: single point Eval " << sw.CpuTime() / nPoints << " s/point");
+
+  // the single point evaluation uses no member work space, so threads can share the parameterization
+  const int nThreads = 4;
+  std::vector<std::vector<Float_t>> res(nThreads, std::vector<Float_t>(nPoints));
+  std::vector<std::thread> threads;
+  for (int it = 0; it < nThreads; it++) {
+    threads.emplace_back([&, it]() {
+      for (int ip = 0; ip < nPoints; ip++) {
+        res[it][ip] = calc.Eval(&points[3 * ip]);
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  for (int it = 0; it < nThreads; it++) {
+    BOOST_CHECK(res[it] == ref);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Chebyshev3DCalcManyRows_test)
+{
+  // more rows than fit into the work space on the stack of the single point Eval
+  gRandom->SetSeed(11);
+  const int nRows = Chebyshev3DCalc::kMaxRowsColumns + 22;
+  std::vector<int> nColsAtRow(nRows);
+  for (int i = 0; i < nRows; i++) {
+    nColsAtRow[i] = 1 + i % 3;
+  }
+  auto text = makeParameterization(nColsAtRow);
+  FILE* stream = fmemopen(text.data(), text.size(), "r");
+  BOOST_REQUIRE(stream);
+  Chebyshev3DCalc calc(stream);
+  fclose(stream);
+  BOOST_REQUIRE_EQUAL(calc.getNumberOfRows(), nRows);
+
+  const int nPoints = 1000;
+  std::vector<Float_t> coords[3], res(nPoints);
+  for (auto& c : coords) {
+    c.resize(nPoints);
+    for (auto& v : c) {
+      v = gRandom->Uniform(-1., 1.);
+    }
+  }
+  const Float_t* par[3] = {coords[0].data(), coords[1].data(), coords[2].data()};
+  calc.Eval(nPoints, par, res.data());
+
+  for (int ip = 0; ip < nPoints; ip++) {
+    const Float_t point[3] = {coords[0][ip], coords[1][ip], coords[2][ip]};
+    const Double_t pointD[3] = {coords[0][ip], coords[1][ip], coords[2][ip]};
+    auto ref = calc.Eval(point);
+    BOOST_CHECK_EQUAL(calc.Eval(pointD), ref);
+    BOOST_CHECK_SMALL(res[ip] - ref, 1e-5f * (1.f + std::abs(ref)));
+  }
+}
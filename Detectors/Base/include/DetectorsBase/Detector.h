@@ -30,6 +30,7 @@
 #include <type_traits>
 #include <string>
 #include <TMessage.h>
+#include <gsl/span>
 #include "CommonUtils/ShmManager.h"
 #include "CommonUtils/ShmAllocator.h"
 #include <sys/shm.h>
@@ -280,6 +281,127 @@ T decodeTMessage(fair::mq::Parts& dataparts, int index)
   return static_cast<T>(decodeTMessageCore(dataparts, index));
 }
 
+// a trait to determine if a container is sent as a flat copy of its elements
+// instead of being streamed with ROOT (vectors of trivially copyable objects)
+template <typename Container>
+struct IsFlatContainer : std::false_type {
+};
+
+template <typename T, typename Alloc>
+struct IsFlatContainer<std::vector<T, Alloc>> : std::bool_constant<std::is_trivially_copyable_v<T>> {
+};
+
+void attachFlatMessageCore(void const* data, size_t size, fair::mq::Channel& channel, fair::mq::Parts& parts);
+
+// attaches the elements of a vector as one message allocated by the channel
+// transport (i.e. in shared memory for shmem channels)
+template <typename Container>
+void attachFlatMessage(Container const& data, fair::mq::Channel& channel, fair::mq::Parts& parts)
+{
+  attachFlatMessageCore(data.data(), data.size() * sizeof(typename Container::value_type), channel, parts);
+}
+
+// the data of a message taken out of the parts
+struct FlatMessageBuffer {
+  std::shared_ptr<void> owner; // keeps the message alive
+  void* data = nullptr;
+  size_t size = 0;
+};
+
+// takes the message at index out of the parts; the transport does not guarantee the alignment
+// of received buffers, so the data is copied to a new message if it is not aligned as requested
+FlatMessageBuffer takeFlatMessageCore(fair::mq::Parts& dataparts, int index, size_t alignment);
+
+// the elements sent with attachFlatMessage, used in place inside the received message
+// (no copy, in shared memory for shmem channels); they can be modified and remain
+// valid as long as this object exists
+template <typename T>
+class FlatMessageData
+{
+ public:
+  using value_type = T;
+
+  FlatMessageData(fair::mq::Parts& dataparts, int index)
+  {
+    auto buffer = takeFlatMessageCore(dataparts, index, alignof(T));
+    mOwner = std::move(buffer.owner);
+    mElements = gsl::span<T>(static_cast<T*>(buffer.data), buffer.size / sizeof(T));
+  }
+
+  // holds a copy of the elements instead (for hits received through the ShmManager)
+  explicit FlatMessageData(std::vector<T> elements)
+  {
+    auto copy = std::make_shared<std::vector<T>>(std::move(elements));
+    mElements = gsl::span<T>(copy->data(), copy->size());
+    mOwner = std::move(copy);
+  }
+
+  T* begin() { return mElements.data(); }
+  T* end() { return mElements.data() + mElements.size(); }
+  T const* begin() const { return mElements.data(); }
+  T const* end() const { return mElements.data() + mElements.size(); }
+  T& operator[](size_t i) { return mElements[i]; }
+  T const& operator[](size_t i) const { return mElements[i]; }
+  size_t size() const { return mElements.size(); }
+  bool empty() const { return mElements.empty(); }
+
+ private:
+  std::shared_ptr<void> mOwner; // the message (or vector) holding the elements
+  gsl::span<T> mElements;
+};
+
+// attaches a container, flat if possible, otherwise as TMessage
+template <typename Container>
+void attachData(Container const& data, fair::mq::Channel& channel, fair::mq::Parts& parts)
+{
+  if constexpr (IsFlatContainer<Container>::value) {
+    attachFlatMessage(data, channel, parts);
+  } else {
+    attachTMessage(data, channel, parts);
+  }
+}
+
+// the type in which a container sent with attachData is received: flat containers
+// stay in their message, the others are decoded from the TMessage
+template <typename Container>
+using ReceivedData_t = std::conditional_t<IsFlatContainer<Container>::value, FlatMessageData<typename Container::value_type>, Container>;
+
+// takes over a container sent with attachData (nullptr if it could not be decoded)
+template <typename Container>
+std::unique_ptr<ReceivedData_t<Container>> receiveData(fair::mq::Parts& dataparts, int index)
+{
+  if constexpr (IsFlatContainer<Container>::value) {
+    return std::make_unique<ReceivedData_t<Container>>(dataparts, index);
+  } else {
+    return std::unique_ptr<Container>(decodeTMessage<Container*>(dataparts, index));
+  }
+}
+
+// the received data as a container (as needed for ROOT IO): the received object itself
+// if it is one, otherwise its elements copied to the given buffer
+template <typename Container>
+Container* asContainer(ReceivedData_t<Container>& received, Container& buffer)
+{
+  if constexpr (std::is_same_v<ReceivedData_t<Container>, Container>) {
+    return &received;
+  } else {
+    buffer.assign(received.begin(), received.end());
+    return &buffer;
+  }
+}
+
+// decodes a container sent with attachData into a new object owned by the caller
+template <typename Container>
+Container* decodeData(fair::mq::Parts& dataparts, int index)
+{
+  if constexpr (IsFlatContainer<Container>::value) {
+    ReceivedData_t<Container> elements(dataparts, index);
+    return new Container(elements.begin(), elements.end());
+  } else {
+    return decodeTMessage<Container*>(dataparts, index);
+  }
+}
+
 void attachDetIDHeaderMessage(int id, fair::mq::Channel& channel, fair::mq::Parts& parts);
 
 template <typename T>
@@ -347,7 +469,7 @@ class DetImpl : public o2::base::Detector
 
     while (auto hits = static_cast<Det*>(this)->Det::getHits(probe++)) {
       if (!UseShm<Det>::value || !o2::utils::ShmManager::Instance().isOperational()) {
-        attachTMessage(*hits, channel, parts);
+        attachData(*hits, channel, parts);
       } else {
         // this is the shared mem variant
         // we will just send the sharedmem ID and the offset inside
@@ -438,8 +560,11 @@ class DetImpl : public o2::base::Detector
     auto targetdata = new T;  // used to collect data inside a single container
     T* filladdress = nullptr; // pointer used for final ROOT IO
     if (entries == 1) {
-      filladdress = hitbuffervector[0].get();
-      // nothing to do; we can directly do IO from the existing buffer
+      // nothing to adjust; we can directly do IO from the received data
+      // (only copied out if it is kept in its message)
+      if (auto incomingdata = hitbuffervector[0].get()) {
+        filladdress = asContainer<T>(*incomingdata, *targetdata);
+      }
     } else {
       // here we need to do merging and index adjustment
       int nprimTot = 0;
@@ -508,7 +633,7 @@ class DetImpl : public o2::base::Detector
     int probe = 0;
     using Hit_t = typename std::remove_pointer<decltype(static_cast<Det*>(this)->Det::getHits(0))>::type;
     // remove buffered event from the hit store
-    using Collector_t = tbb::concurrent_unordered_map<int, std::vector<std::vector<std::unique_ptr<Hit_t>>>>;
+    using Collector_t = tbb::concurrent_unordered_map<int, std::vector<std::vector<std::unique_ptr<ReceivedData_t<Hit_t>>>>>;
     auto hitbufferPtr = reinterpret_cast<Collector_t*>(mHitCollectorBufferPtr);
     auto iter = hitbufferPtr->find(eventID);
     if (iter == hitbufferPtr->end()) {
@@ -534,7 +659,8 @@ class DetImpl : public o2::base::Detector
   void collectHits(int eventID, fair::mq::Parts& parts, int& index) override
   {
     using Hit_t = typename std::remove_pointer<decltype(static_cast<Det*>(this)->Det::getHits(0))>::type;
-    using Collector_t = tbb::concurrent_unordered_map<int, std::vector<std::vector<std::unique_ptr<Hit_t>>>>;
+    using Data_t = ReceivedData_t<Hit_t>;
+    using Collector_t = tbb::concurrent_unordered_map<int, std::vector<std::vector<std::unique_ptr<Data_t>>>>;
     static Collector_t hitcollector; // note: we can't put this as member because
     // decltype type deduction doesn't seem to work for class members; so we use a static member
     // and will use some pointer member to communicate this data to other functions
@@ -545,40 +671,37 @@ class DetImpl : public o2::base::Detector
     using HitPtr_t = decltype(static_cast<Det*>(this)->Det::getHits(probe));
     std::string name = static_cast<Det*>(this)->getHitBranchNames(probe);
 
-    auto copyToBuffer = [this, eventID](HitPtr_t hitdata, Collector_t& collectbuffer, int probe) {
-      std::vector<std::vector<std::unique_ptr<Hit_t>>>* hitvector = nullptr;
+    auto moveToBuffer = [this, eventID](std::unique_ptr<Data_t> hitdata, Collector_t& collectbuffer, int probe) {
+      std::vector<std::vector<std::unique_ptr<Data_t>>>* hitvector = nullptr;
       {
         auto eventIter = collectbuffer.find(eventID);
         if (eventIter == collectbuffer.end()) {
           // key insertion and traversal are thread-safe with tbb so no need
           // to protect
-          collectbuffer[eventID] = std::vector<std::vector<std::unique_ptr<Hit_t>>>();
+          collectbuffer[eventID] = std::vector<std::vector<std::unique_ptr<Data_t>>>();
         }
         hitvector = &(collectbuffer[eventID]);
       }
       if (probe >= hitvector->size()) {
         hitvector->resize(probe + 1);
       }
-      // add empty hit bucket to list for this event and probe
-      (*hitvector)[probe].emplace_back(new Hit_t());
-      // copy the data into this bucket
-      *((*hitvector)[probe].back()) = *hitdata;
+      // add the hit bucket to list for this event and probe
+      (*hitvector)[probe].emplace_back(std::move(hitdata));
     };
 
     while (name.size() > 0) {
       if (!UseShm<Det>::value || !o2::utils::ShmManager::Instance().isOperational()) {
-        // for each branch name we extract/decode hits from the message parts ...
-        auto hitsptr = decodeTMessage<HitPtr_t>(parts, index++);
+        // for each branch name we take the hits from the message parts ...
+        auto hitsptr = receiveData<Hit_t>(parts, index++);
         if (hitsptr) {
-          // ... and copy them to the buffer
-          copyToBuffer(hitsptr, hitcollector, probe);
-          delete hitsptr;
+          // ... and hand them (still in their message if sent flat) to the buffer
+          moveToBuffer(std::move(hitsptr), hitcollector, probe);
         }
       } else {
         // for each branch name we extract/decode hits from the message parts ...
         auto hitsptr = decodeShmMessage<HitPtr_t>(parts, index++, busy);
         // ... and copy them to the buffer
-        copyToBuffer(hitsptr, hitcollector, probe);
+        moveToBuffer(std::make_unique<Data_t>(*hitsptr), hitcollector, probe);
       }
       // next name
       probe++;
@@ -601,7 +724,7 @@ class DetImpl : public o2::base::Detector
       if (!UseShm<Det>::value || !o2::utils::ShmManager::Instance().isOperational()) {
 
         // for each branch name we extract/decode hits from the message parts ...
-        auto hitsptr = decodeTMessage<Hit_t>(parts, index++);
+        auto hitsptr = decodeData<std::remove_pointer_t<Hit_t>>(parts, index++);
         if (hitsptr) {
           // ... and fill the tree branch
           auto br = getOrMakeBranch(tr, name.c_str(), hitsptr);
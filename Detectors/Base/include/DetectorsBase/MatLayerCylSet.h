@@ -22,6 +22,7 @@
 
 #ifndef GPUCA_ALIGPUCODE // this part is unvisible on GPU version
 #include "MathUtils/Cartesian.h"
+#include <vector>
 #endif // !GPUCA_ALIGPUCODE
 
 /**********************************************************************
@@ -47,6 +48,41 @@ struct MatLayerCylSetLayout {
   int* mInterval2LrID;  //[mNRIntervals] mapping from r2 interval to layer ID
 };
 
+#ifndef GPUCA_ALIGPUCODE // this part is unvisible on GPU version
+/// SoA container of straight segments for the batched material budget query
+struct MatRaySet {
+  std::vector<float> x0, y0, z0; ///< start points
+  std::vector<float> x1, y1, z1; ///< end points
+
+  void add(float xs, float ys, float zs, float xe, float ye, float ze)
+  {
+    x0.push_back(xs);
+    y0.push_back(ys);
+    z0.push_back(zs);
+    x1.push_back(xe);
+    y1.push_back(ye);
+    z1.push_back(ze);
+  }
+  void add(const math_utils::Point3D<float>& point0, const math_utils::Point3D<float>& point1)
+  {
+    add(point0.X(), point0.Y(), point0.Z(), point1.X(), point1.Y(), point1.Z());
+  }
+  void reserve(size_t n)
+  {
+    for (auto* v : {&x0, &y0, &z0, &x1, &y1, &z1}) {
+      v->reserve(n);
+    }
+  }
+  void clear()
+  {
+    for (auto* v : {&x0, &y0, &z0, &x1, &y1, &z1}) {
+      v->clear();
+    }
+  }
+  size_t size() const { return x0.size(); }
+};
+#endif // !GPUCA_ALIGPUCODE
+
 class MatLayerCylSet : public o2::gpu::FlatObject
 {
 
@@ -96,6 +132,15 @@ class MatLayerCylSet : public o2::gpu::FlatObject
     // get material budget traversed on the line between point0 and point1
     return getMatBudget(point0.X(), point0.Y(), point0.Z(), point1.X(), point1.Y(), point1.Z());
   }
+
+  // get material budgets for all segments of the set, budgets must have room for rays.size() entries
+  void getMatBudget(const MatRaySet& rays, MatBudget* budgets) const;
+  std::vector<MatBudget> getMatBudget(const MatRaySet& rays) const
+  {
+    std::vector<MatBudget> budgets(rays.size());
+    getMatBudget(rays, budgets.data());
+    return budgets;
+  }
 #endif // !GPUCA_ALIGPUCODE
   GPUd() MatBudget getMatBudget(float x0, float y0, float z0, float x1, float y1, float z1) const;
 
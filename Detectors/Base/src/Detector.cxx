@@ -196,6 +196,9 @@ int Detector::registerSensitiveVolumeAndGetVolID(std::string const& name)
 #include <fairmq/Message.h>
 #include <fairmq/Parts.h>
 #include <fairmq/Channel.h>
+#include <fairmq/TransportFactory.h>
+#include <cstdint>
+#include <cstring>
 namespace o2
 {
 namespace base
@@ -207,6 +210,24 @@ void attachMessageBufferToParts(fair::mq::Parts& parts, fair::mq::Channel& chann
   std::unique_ptr<fair::mq::Message> message(channel.NewMessage(data, size, free_func, hint));
   parts.AddPart(std::move(message));
 }
+void attachFlatMessageCore(void const* data, size_t size, fair::mq::Channel& channel, fair::mq::Parts& parts)
+{
+  std::unique_ptr<fair::mq::Message> message(channel.NewMessage(size, fair::mq::Alignment{64}));
+  if (size > 0) {
+    std::memcpy(message->GetData(), data, size);
+  }
+  parts.AddPart(std::move(message));
+}
+FlatMessageBuffer takeFlatMessageCore(fair::mq::Parts& dataparts, int index, size_t alignment)
+{
+  std::shared_ptr<fair::mq::Message> message(std::move(dataparts.At(index)));
+  if (reinterpret_cast<std::uintptr_t>(message->GetData()) % alignment != 0) {
+    std::shared_ptr<fair::mq::Message> aligned(message->GetTransport()->CreateMessage(message->GetSize(), fair::mq::Alignment{alignment}));
+    std::memcpy(aligned->GetData(), message->GetData(), message->GetSize());
+    message = std::move(aligned);
+  }
+  return {message, message->GetData(), message->GetSize()};
+}
 void attachDetIDHeaderMessage(int id, fair::mq::Channel& channel, fair::mq::Parts& parts)
 {
   std::unique_ptr<fair::mq::Message> message(channel.NewSimpleMessage(id));
@@ -256,6 +256,40 @@ void MatLayerCylSet::print(bool data) const
          float(getFlatBufferSize()) / 1024 / 1024);
 }
 
+//________________________________________________________________________________
+void MatLayerCylSet::getMatBudget(const MatRaySet& rays, MatBudget* budgets) const
+{
+  // get material budget for a set of rays.
+  // The radial span of all rays is computed first in a vectorizable loop (same arithmetics as in the Ray class),
+  // rays which are too short or do not reach the radial range of the LUT are resolved without constructing the Ray,
+  // the remaining ones are traversed with the standard single ray method, so that the results are identical
+  const int n = rays.size();
+  const float *x0 = rays.x0.data(), *y0 = rays.y0.data(), *z0 = rays.z0.data();
+  const float *x1 = rays.x1.data(), *y1 = rays.y1.data(), *z1 = rays.z1.data();
+  std::vector<float> dist(n), rmin2(n), rmax2(n);
+  for (int i = 0; i < n; i++) {
+    float dx = x1[i] - x0[i], dy = y1[i] - y0[i], dz = z1[i] - z0[i];
+    float distXY2 = dx * dx + dy * dy;
+    float distXY2i = distXY2 > Ray::Tiny ? 1.f / distXY2 : 0.f;
+    float xDxPlusYDyRed = -(x0[i] * dx + y0[i] * dy) * distXY2i;
+    float r02 = x0[i] * x0[i] + y0[i] * y0[i], r12 = x1[i] * x1[i] + y1[i] * y1[i];
+    float xMin = x0[i] + xDxPlusYDyRed * dx, yMin = y0[i] + xDxPlusYDyRed * dy;
+    bool pcaInside = xDxPlusYDyRed > 0.f && xDxPlusYDyRed < 1.f; // closest approach to the origin is within the segment
+    dist[i] = o2::gpu::CAMath::Sqrt(distXY2 + dz * dz);
+    rmax2[i] = r02 > r12 ? r02 : r12;
+    rmin2[i] = pcaInside ? xMin * xMin + yMin * yMin : (r02 > r12 ? r12 : r02);
+  }
+  const float lutRMin2 = getRMin2(), lutRMax2 = getRMax2();
+  for (int i = 0; i < n; i++) {
+    if (dist[i] < Ray::MinDistToConsider || rmin2[i] >= lutRMax2 || rmax2[i] <= lutRMin2) {
+      budgets[i] = MatBudget{};
+      budgets[i].length = dist[i];
+    } else {
+      budgets[i] = getMatBudget(x0[i], y0[i], z0[i], x1[i], y1[i], z1[i]);
+    }
+  }
+}
+
 #endif //!GPUCA_ALIGPUCODE
 
 #ifndef GPUCA_GPUCODE
@@ -16,9 +16,56 @@
 #include <unistd.h>
 
 #include "buildMatBudLUT.C"
+#include <TRandom.h>
+#include <TStopwatch.h>
 
 namespace o2
 {
+#ifndef GPUCA_ALIGPUCODE // this part is unvisible on GPU version
+// compare batched and single ray material budget queries on random track steps and report their timing
+bool testMBLUTBatch(const std::string& lutFile)
+{
+  std::unique_ptr<o2::base::MatLayerCylSet> mbr(o2::base::MatLayerCylSet::loadFromFile(lutFile));
+  if (!mbr) {
+    LOG(error) << "Failed to read LUT from " << lutFile;
+    return false;
+  }
+  const int nRays = 100000;
+  o2::base::MatRaySet rays;
+  rays.reserve(nRays);
+  for (int i = 0; i < nRays; i++) {
+    float r = gRandom->Uniform(0., mbr->getRMax() * 1.1), phi = gRandom->Uniform(0., 2. * M_PI), z = gRandom->Uniform(-mbr->getZMax(), mbr->getZMax());
+    float step = gRandom->Uniform(0., 10.), dphi = gRandom->Uniform(0., 2. * M_PI), tgl = gRandom->Uniform(-1., 1.);
+    float x0 = r * std::cos(phi), y0 = r * std::sin(phi);
+    rays.add(x0, y0, z, x0 + step * std::cos(dphi), y0 + step * std::sin(dphi), z + step * tgl);
+  }
+
+  TStopwatch swSingle;
+  std::vector<o2::base::MatBudget> single(nRays);
+  for (int i = 0; i < nRays; i++) {
+    single[i] = mbr->getMatBudget(rays.x0[i], rays.y0[i], rays.z0[i], rays.x1[i], rays.y1[i], rays.z1[i]);
+  }
+  swSingle.Stop();
+
+  TStopwatch swBatch;
+  auto batch = mbr->getMatBudget(rays);
+  swBatch.Stop();
+
+  LOG(info) << "Material budget for " << nRays << " rays: single ray queries " << swSingle.CpuTime() << " s, batched query " << swBatch.CpuTime() << " s";
+  bool ok = batch.size() == single.size();
+  for (int i = 0; ok && i < nRays; i++) {
+    ok = std::abs(batch[i].meanRho - single[i].meanRho) <= 1e-6 * std::abs(single[i].meanRho) &&
+         std::abs(batch[i].meanX2X0 - single[i].meanX2X0) <= 1e-6 * std::abs(single[i].meanX2X0) &&
+         std::abs(batch[i].length - single[i].length) <= 1e-6 * std::abs(single[i].length);
+    if (!ok) {
+      LOG(error) << "Mismatch for ray " << i << ": batched " << batch[i].meanRho << " " << batch[i].meanX2X0 << " " << batch[i].length
+                 << " single " << single[i].meanRho << " " << single[i].meanX2X0 << " " << single[i].length;
+    }
+  }
+  return ok;
+}
+#endif //!GPUCA_ALIGPUCODE
+
 BOOST_AUTO_TEST_CASE(MatBudLUT)
 {
 #ifndef GPUCA_ALIGPUCODE // this part is unvisible on GPU version
@@ -30,6 +77,7 @@ BOOST_AUTO_TEST_CASE(MatBudLUT)
   matBudFile += std::to_string(getpid()) + ".root";
   BOOST_CHECK(buildMatBudLUT(2, 20, matBudFile, geomPrefix + std::to_string(getpid()))); // generate LUT
   BOOST_CHECK(testMBLUT(matBudFile));                                                    // test LUT manipulations
+  BOOST_CHECK(testMBLUTBatch(matBudFile));                                               // test batched queries
 
 #endif //!GPUCA_ALIGPUCODE
 }
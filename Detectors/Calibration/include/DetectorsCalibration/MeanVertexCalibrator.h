@@ -45,7 +45,7 @@ class MeanVertexCalibrator final : public o2::calibration::TimeSlotCalibration<o
   };
 
   MeanVertexCalibrator() = default;
-  ~MeanVertexCalibrator() final = default;
+  ~MeanVertexCalibrator() final { stopAsyncFinalization(); } // finalizeSlot must not run on a destroyed calibrator
 
   bool hasEnoughData(const Slot& slot) const final;
   void initOutput() final;
@@ -34,6 +34,7 @@ struct MeanVertexParams : public o2::conf::ConfigurableParamHelper<MeanVertexPar
   uint32_t nPointsForSlope = 5;
   bool dumpNonEmptyBins = false;
   bool skipObjectSending = false;
+  uint32_t maxSlotsInFlight = 0; // if > 0, finalize the slots in background, blocking when this many are waiting
 
   O2ParamDef(MeanVertexParams, "MeanVertexCalib");
 };
@@ -12,6 +12,7 @@
 #ifndef DETECTOR_CALIB_TIMESLOT_H_
 #define DETECTOR_CALIB_TIMESLOT_H_
 
+#include <array>
 #include <memory>
 #include <Rtypes.h>
 #include "Framework/Logger.h"
@@ -35,10 +36,11 @@ class TimeSlot
  public:
   TimeSlot() = default;
   TimeSlot(TFType tfS, TFType tfE) : mTFStart(tfS), mTFEnd(tfE) {}
-  TimeSlot(const TimeSlot& src) : mTFStart(src.mTFStart), mTFEnd(src.mTFEnd), mEntries(src.mEntries), mRunStartOrbit(src.mRunStartOrbit), mTFStartMS(src.mTFStartMS)
+  TimeSlot(const TimeSlot& src) : mTFStart(src.mTFStart), mTFEnd(src.mTFEnd), mEntries(src.mEntries), mRunStartOrbit(src.mRunStartOrbit), mTFStartMS(src.mTFStartMS), mFrozenTimesMS(src.mFrozenTimesMS), mTimesFrozen(src.mTimesFrozen)
   {
     mContainer = src.mContainer ? std::make_unique<Container>(*src.mContainer) : nullptr;
   }
+  TimeSlot(TimeSlot&& src) = default;
   TimeSlot& operator=(TimeSlot&& src) = default;
 
   ~TimeSlot() = default;
@@ -47,8 +49,15 @@ class TimeSlot
   TFType getTFEnd() const { return mTFEnd; }
 
   long getStaticStartTimeMS() const { return mTFStartMS; }
-  long getStartTimeMS() const { return o2::base::GRPGeomHelper::instance().getOrbitResetTimeMS() + (mRunStartOrbit + long(o2::base::GRPGeomHelper::getNHBFPerTF()) * mTFStart) * o2::constants::lhc::LHCOrbitMUS / 1000; }
-  long getEndTimeMS() const { return o2::base::GRPGeomHelper::instance().getOrbitResetTimeMS() + (mRunStartOrbit + long(o2::base::GRPGeomHelper::getNHBFPerTF()) * (mTFEnd + 1)) * o2::constants::lhc::LHCOrbitMUS / 1000; }
+  long getStartTimeMS() const { return mTimesFrozen ? mFrozenTimesMS[0] : o2::base::GRPGeomHelper::instance().getOrbitResetTimeMS() + (mRunStartOrbit + long(o2::base::GRPGeomHelper::getNHBFPerTF()) * mTFStart) * o2::constants::lhc::LHCOrbitMUS / 1000; }
+  long getEndTimeMS() const { return mTimesFrozen ? mFrozenTimesMS[1] : o2::base::GRPGeomHelper::instance().getOrbitResetTimeMS() + (mRunStartOrbit + long(o2::base::GRPGeomHelper::getNHBFPerTF()) * (mTFEnd + 1)) * o2::constants::lhc::LHCOrbitMUS / 1000; }
+  // take the start and end times with the current GRPGeomHelper, so that they do not depend on its later updates
+  // (needed when the slot is finalized in background while the device keeps processing)
+  void freezeTimesMS()
+  {
+    mFrozenTimesMS = {getStartTimeMS(), getEndTimeMS()};
+    mTimesFrozen = true;
+  }
 
   const Container* getContainer() const { return mContainer.get(); }
   Container* getContainer() { return mContainer.get(); }
@@ -84,6 +93,8 @@ class TimeSlot
   long mRunStartOrbit = 0;
   std::unique_ptr<Container> mContainer; // user object to accumulate the calibration data for this slot
   long mTFStartMS = 0;                   // start time of the slot in ms that avoids to calculate it on the fly; needed when a slot covers more runs, otherwise the OrbitReset that is read is the one of the latest run, and the validity will be wrong
+  std::array<long, 2> mFrozenTimesMS{};  //! start and end times in ms taken by freezeTimesMS
+  bool mTimesFrozen = false;             //! getStartTimeMS and getEndTimeMS return mFrozenTimesMS
 
   ClassDefNV(TimeSlot, 2);
 };
@@ -20,11 +20,17 @@
 #include "DetectorsBase/GRPGeomHelper.h"
 #include "CommonDataFormat/TFIDInfo.h"
 #include <TFile.h>
+#include <atomic>
+#include <condition_variable>
 #include <filesystem>
 #include <deque>
 #include <gsl/gsl>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <type_traits>
+#include <utility>
 #include <unistd.h>
 
 namespace o2
@@ -46,7 +52,7 @@ class TimeSlotCalibration
   static constexpr TFType INFINITE_TF = o2::calibration::INFINITE_TF;
 
   TimeSlotCalibration() = default;
-  virtual ~TimeSlotCalibration() = default;
+  virtual ~TimeSlotCalibration();
   float getMaxSlotsDelay() const { return mMaxSlotsDelay; }
   void setMaxSlotsDelay(float v) { mMaxSlotsDelay = v > 0. ? v : 0.; }
 
@@ -106,11 +112,40 @@ class TimeSlotCalibration
 
   template <typename... DATA>
   bool process(const DATA&... data);
-  virtual void checkSlotsToFinalize(TFType tf = INFINITE_TF, int maxDelay = 0);
-  virtual void finalizeOldestSlot();
+  // not virtual: the end of run (tf = INFINITE_TF) and the forced finalization always stop the background finalization
+  void checkSlotsToFinalize(TFType tf = INFINITE_TF, int maxDelay = 0);
+  void finalizeOldestSlot();
+
+  // Opt-in: slots ready for finalization are moved out of the pool and finalized in order on a background thread,
+  // while new TFs keep filling fresh slots. At most maxInFlight slots (and, if maxInFlightBytes > 0, that much memory
+  // as estimated by getSlotMemorySize) can wait for finalization, beyond this the processing blocks.
+  // Since finalizeSlot then runs concurrently with process, the outputs of the derived class must be accessed
+  // under getOutputLock(), and finalizeSlot must not use anything the device updates: the slot times are frozen
+  // when it is handed over, see TimeSlot::freezeTimesMS.
+  // The thread is started with the first slot handed over and stopped, after finalizing all of them, at the end
+  // of run, in finalizeOldestSlot and in reset. Derived classes must call stopAsyncFinalization in their destructor.
+  void setAsyncFinalization(size_t maxInFlight = 2, size_t maxInFlightBytes = 0);
+  bool isAsyncFinalization() const { return mAsync != nullptr; }
+  // block until all the slots handed over to the background finalization are finalized
+  void waitForFinalization();
+  // finalize all the slots handed over and stop the background thread
+  void stopAsyncFinalization();
+  // lock to hold while accessing the outputs filled by finalizeSlot, owns nothing if the finalization is synchronous
+  std::unique_lock<std::mutex> getOutputLock()
+  {
+    return mAsync ? std::unique_lock<std::mutex>(mAsync->outputMutex) : std::unique_lock<std::mutex>();
+  }
+  // number of slots finalized so far, a device can compare it with the value at its last sending
+  // to know without locking whether new outputs are available
+  size_t getNFinalizedSlots() const { return mNFinalizedSlots + (mAsync ? mAsync->nFinalized.load() : 0); }
+  size_t getNSlotsInFlight() const;
+  size_t getInFlightMemory() const;
+  // estimate of the memory used by a slot, used for the accounting of the slots waiting for the finalization
+  virtual size_t getSlotMemorySize(const Slot& slot) const { return sizeof(Slot) + sizeof(Container); }
 
   virtual void reset()
   { // reset to virgin state (need for start - stop - start)
+    stopAsyncFinalization();
     mSlots.clear();
     mLastClosedTF = 0;
     mFirstTF = 0;
@@ -220,6 +255,9 @@ class TimeSlotCalibration
 
   TFType tf2SlotMin(TFType tf) const;
 
+  // finalize the slot or hand it over to the background finalization, the caller must remove it from mSlots afterwards
+  void finalizeOrEnqueueSlot(Slot& slot);
+
   std::deque<Slot> mSlots;
 
   o2::dataformats::TFIDInfo mCurrentTFInfo{};
@@ -249,6 +287,24 @@ class TimeSlotCalibration
   TimeSlotMetaData mSaveMetaData{};
   bool mSavedSlotAllowed = false;
 
+ private:
+  struct AsyncFinalization {
+    std::thread worker;
+    std::mutex mutex;                                // protects the queue and the counters
+    std::mutex outputMutex;                          // held while finalizeSlot is running
+    std::condition_variable condition;               // signals changes of the queue
+    std::deque<std::pair<Slot, size_t>> queue;       // slots waiting for or being finalized, with their memory size
+    std::atomic<size_t> nFinalized = 0;              // slots finalized in background
+    size_t maxInFlight = 2;
+    size_t maxInFlightBytes = 0;
+    size_t inFlightBytes = 0;
+    bool stop = false;
+  };
+  void asyncFinalizationLoop();
+
+  std::unique_ptr<AsyncFinalization> mAsync; //! state of the background finalization, if enabled
+  size_t mNFinalizedSlots = 0;               //! slots finalized synchronously
+
   ClassDef(TimeSlotCalibration, 1);
 };
 
@@ -320,7 +376,7 @@ void TimeSlotCalibration<Container>::checkSlotsToFinalize(TFType tf, int maxDela
         mSlots[0].setTFStart(mLastClosedTF);
         mSlots[0].setTFEnd(mMaxSeenTF);
         LOG(info) << "Finalizing slot for " << mSlots[0].getTFStart() << " <= TF <= " << mSlots[0].getTFEnd();
-        finalizeSlot(mSlots[0]);                  // will be removed after finalization
+        finalizeOrEnqueueSlot(mSlots[0]);         // will be removed after finalization
         mLastClosedTF = mSlots[0].getTFEnd() < INFINITE_TF ? (mSlots[0].getTFEnd() + 1) : mSlots[0].getTFEnd() < INFINITE_TF; // will not accept any TF below this
         mSlots.erase(mSlots.begin());
         // creating a new slot if we are not at the end of run
@@ -344,7 +400,7 @@ void TimeSlotCalibration<Container>::checkSlotsToFinalize(TFType tf, int maxDela
       if (tfLim < tf) {
         if (hasEnoughData(*slot)) {
           LOG(debug) << "Finalizing slot for " << slot->getTFStart() << " <= TF <= " << slot->getTFEnd();
-          finalizeSlot(*slot); // will be removed after finalization
+          finalizeOrEnqueueSlot(*slot); // will be removed after finalization
         } else if ((slot + 1) != mSlots.end()) {
           LOG(info) << "Merging underpopulated slot " << slot->getTFStart() << " <= TF <= " << slot->getTFEnd()
                     << " to slot " << (slot + 1)->getTFStart() << " <= TF <= " << (slot + 1)->getTFEnd();
@@ -361,6 +417,9 @@ void TimeSlotCalibration<Container>::checkSlotsToFinalize(TFType tf, int maxDela
       }
     }
   }
+  if (tf == INFINITE_TF) { // end of run, the outputs must be complete
+    stopAsyncFinalization();
+  }
 }
 
 //_________________________________________________
@@ -372,9 +431,147 @@ void TimeSlotCalibration<Container>::finalizeOldestSlot()
     LOG(warning) << "There are no slots defined";
     return;
   }
-  finalizeSlot(mSlots.front());
+  finalizeOrEnqueueSlot(mSlots.front());
   mLastClosedTF = mSlots.front().getTFEnd() + 1; // do not accept any TF below this
   mSlots.erase(mSlots.begin());
+  stopAsyncFinalization();
+}
+
+//_________________________________________________
+template <typename Container>
+TimeSlotCalibration<Container>::~TimeSlotCalibration()
+{
+  if (mAsync && mAsync->worker.joinable()) {
+    // the derived class is already destroyed, the slots which are not finalized yet must be dropped
+    LOG(error) << "Background finalization still running when destroying the calibration, the derived class must call stopAsyncFinalization in its destructor";
+    {
+      std::lock_guard<std::mutex> lock(mAsync->mutex);
+      mAsync->stop = true;
+      mAsync->condition.notify_all();
+    }
+    mAsync->worker.join();
+  }
+}
+
+//_________________________________________________
+template <typename Container>
+void TimeSlotCalibration<Container>::finalizeOrEnqueueSlot(Slot& slot)
+{
+  if (!mAsync) {
+    finalizeSlot(slot);
+    mNFinalizedSlots++;
+    return;
+  }
+  size_t size = getSlotMemorySize(slot);
+  // the orbit reset time and the TF length might be updated while the slot is waiting
+  slot.freezeTimesMS();
+  std::unique_lock<std::mutex> lock(mAsync->mutex);
+  if (!mAsync->worker.joinable()) {
+    mAsync->stop = false;
+    mAsync->worker = std::thread([this]() { asyncFinalizationLoop(); });
+  }
+  auto hasRoom = [this, size]() {
+    return mAsync->queue.empty() || (mAsync->queue.size() < mAsync->maxInFlight && (!mAsync->maxInFlightBytes || mAsync->inFlightBytes + size <= mAsync->maxInFlightBytes));
+  };
+  if (!hasRoom()) {
+    LOGP(warning, "{} slots using {} bytes are waiting for finalization, blocking until the oldest one is done", mAsync->queue.size(), mAsync->inFlightBytes);
+    mAsync->condition.wait(lock, hasRoom);
+  }
+  // the slot left in mSlots keeps its TF range, only the container is moved
+  mAsync->queue.emplace_back(std::move(slot), size);
+  mAsync->inFlightBytes += size;
+  mAsync->condition.notify_all();
+}
+
+//_________________________________________________
+template <typename Container>
+void TimeSlotCalibration<Container>::asyncFinalizationLoop()
+{
+  std::unique_lock<std::mutex> lock(mAsync->mutex);
+  while (true) {
+    mAsync->condition.wait(lock, [this]() { return mAsync->stop || !mAsync->queue.empty(); });
+    if (mAsync->stop) { // stopAsyncFinalization waits for the queue to be empty, otherwise the derived class is gone
+      return;
+    }
+    // new slots are only appended, so the reference stays valid while we finalize without holding the lock
+    auto& [slot, size] = mAsync->queue.front();
+    lock.unlock();
+    {
+      std::lock_guard<std::mutex> outputLock(mAsync->outputMutex);
+      LOG(debug) << "Finalizing in background slot for " << slot.getTFStart() << " <= TF <= " << slot.getTFEnd();
+      finalizeSlot(slot);
+    }
+    mAsync->nFinalized++;
+    lock.lock();
+    mAsync->inFlightBytes -= size;
+    mAsync->queue.pop_front();
+    mAsync->condition.notify_all();
+  }
+}
+
+//_________________________________________________
+template <typename Container>
+void TimeSlotCalibration<Container>::setAsyncFinalization(size_t maxInFlight, size_t maxInFlightBytes)
+{
+  if (!mAsync) {
+    mAsync = std::make_unique<AsyncFinalization>();
+  }
+  std::lock_guard<std::mutex> lock(mAsync->mutex);
+  mAsync->maxInFlight = maxInFlight > 0 ? maxInFlight : 1;
+  mAsync->maxInFlightBytes = maxInFlightBytes;
+  LOGP(info, "Slots will be finalized asynchronously, with at most {} slots and {} in flight", mAsync->maxInFlight, maxInFlightBytes ? fmt::format("{} bytes", maxInFlightBytes) : "unlimited memory");
+}
+
+//_________________________________________________
+template <typename Container>
+void TimeSlotCalibration<Container>::waitForFinalization()
+{
+  if (!mAsync) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mAsync->mutex);
+  mAsync->condition.wait(lock, [this]() { return mAsync->queue.empty(); });
+}
+
+//_________________________________________________
+template <typename Container>
+void TimeSlotCalibration<Container>::stopAsyncFinalization()
+{
+  if (!mAsync) {
+    return;
+  }
+  {
+    std::unique_lock<std::mutex> lock(mAsync->mutex);
+    if (!mAsync->worker.joinable()) {
+      return;
+    }
+    mAsync->condition.wait(lock, [this]() { return mAsync->queue.empty(); });
+    mAsync->stop = true;
+    mAsync->condition.notify_all();
+  }
+  mAsync->worker.join();
+}
+
+//_________________________________________________
+template <typename Container>
+size_t TimeSlotCalibration<Container>::getNSlotsInFlight() const
+{
+  if (!mAsync) {
+    return 0;
+  }
+  std::lock_guard<std::mutex> lock(mAsync->mutex);
+  return mAsync->queue.size();
+}
+
+//_________________________________________________
+template <typename Container>
+size_t TimeSlotCalibration<Container>::getInFlightMemory() const
+{
+  if (!mAsync) {
+    return 0;
+  }
+  std::lock_guard<std::mutex> lock(mAsync->mutex);
+  return mAsync->inFlightBytes;
 }
 
 //________________________________________
@@ -0,0 +1,166 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test TimeSlotCalibration
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "DetectorsCalibration/TimeSlotCalibration.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace o2::calibration;
+
+namespace
+{
+struct SumData {
+  long sum = 0;
+  size_t entries = 0;
+  void fill(const std::vector<int>& data)
+  {
+    for (auto v : data) {
+      sum += v;
+    }
+    entries += data.size();
+  }
+  void merge(const SumData* prev)
+  {
+    sum += prev->sum;
+    entries += prev->entries;
+  }
+  void print() const {}
+};
+
+// <first TF, sum, start time> of a finalized slot
+using SlotResult = std::tuple<TFType, long, long>;
+
+class SumCalibration final : public TimeSlotCalibration<SumData>
+{
+ public:
+  SumCalibration(bool async, std::atomic<int>& nFinalized) : mNFinalized(nFinalized)
+  {
+    if (async) {
+      setAsyncFinalization(2);
+    }
+  }
+  ~SumCalibration() final { stopAsyncFinalization(); }
+
+  bool hasEnoughData(const Slot& slot) const final { return slot.getContainer()->entries > 0; }
+  void initOutput() final { mResults.clear(); }
+  void finalizeSlot(Slot& slot) final
+  {
+    // a slow fit, so that the processing runs ahead of the finalization
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    mResults.emplace_back(slot.getTFStart(), slot.getContainer()->sum, slot.getStartTimeMS());
+    mNFinalized++;
+  }
+  Slot& emplaceNewSlot(bool front, TFType tstart, TFType tend) final
+  {
+    auto& cont = getSlots();
+    auto& slot = front ? cont.emplace_front(tstart, tend) : cont.emplace_back(tstart, tend);
+    slot.setContainer(std::make_unique<SumData>());
+    return slot;
+  }
+
+  std::vector<SlotResult> mResults;
+
+ private:
+  std::atomic<int>& mNFinalized;
+};
+
+void setTF(SumCalibration& calib, TFType tf)
+{
+  calib.getCurrentTFInfo().tfCounter = tf;
+  calib.getCurrentTFInfo().firstTForbit = tf * o2::base::GRPGeomHelper::getNHBFPerTF();
+}
+
+// the same as a device: process the TFs, sending the outputs as soon as they are available
+std::vector<SlotResult> runCalibration(bool async, int nTFs)
+{
+  std::atomic<int> nFinalized = 0;
+  SumCalibration calib(async, nFinalized);
+  calib.setSlotLength(5);
+  std::vector<SlotResult> sent;
+  size_t nFinalizedSent = 0;
+  auto send = [&]() {
+    auto n = calib.getNFinalizedSlots();
+    if (n == nFinalizedSent) {
+      return;
+    }
+    auto lock = calib.getOutputLock();
+    nFinalizedSent = n;
+    sent.insert(sent.end(), calib.mResults.begin(), calib.mResults.end());
+    calib.initOutput();
+  };
+  for (int tf = 0; tf < nTFs; tf++) {
+    setTF(calib, tf);
+    calib.process(std::vector<int>{tf, 2 * tf});
+    BOOST_CHECK(calib.getNSlotsInFlight() <= 2);
+    send();
+  }
+  calib.checkSlotsToFinalize(INFINITE_TF);
+  BOOST_CHECK_EQUAL(calib.getNSlotsInFlight(), 0);
+  BOOST_CHECK_EQUAL(calib.getNFinalizedSlots(), nFinalized.load());
+  send();
+  return sent;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(TimeSlotCalibrationAsync_test)
+{
+  auto sync = runCalibration(false, 200);
+  auto async = runCalibration(true, 200);
+  BOOST_REQUIRE(!sync.empty());
+  // all the slots are finalized and sent, in order and with the same results
+  BOOST_REQUIRE_EQUAL(sync.size(), async.size());
+  for (size_t i = 0; i < sync.size(); i++) {
+    BOOST_CHECK(sync[i] == async[i]);
+  }
+  long total = 0;
+  for (const auto& result : async) {
+    total += std::get<1>(result);
+  }
+  BOOST_CHECK_EQUAL(total, 3 * 199 * 200 / 2);
+}
+
+BOOST_AUTO_TEST_CASE(TimeSlotCalibrationAsyncDestruction_test)
+{
+  auto processTFs = [](SumCalibration& calib, int nTFs) {
+    calib.setSlotLength(1);
+    for (int tf = 0; tf < nTFs; tf++) {
+      setTF(calib, tf);
+      calib.process(std::vector<int>{tf});
+    }
+  };
+  // destroyed before the end of run: the slots handed over are finalized before the calibration is gone
+  std::atomic<int> nFinalizedSync = 0, nFinalizedAsync = 0;
+  {
+    SumCalibration sync(false, nFinalizedSync), async(true, nFinalizedAsync);
+    processTFs(sync, 20);
+    processTFs(async, 20);
+  }
+  BOOST_CHECK(nFinalizedSync.load() > 0);
+  BOOST_CHECK_EQUAL(nFinalizedAsync.load(), nFinalizedSync.load());
+
+  // the background thread is started again after the end of run
+  std::atomic<int> nFinalized = 0;
+  SumCalibration calib(true, nFinalized);
+  for (int run = 0; run < 2; run++) {
+    processTFs(calib, 10);
+    calib.checkSlotsToFinalize(INFINITE_TF);
+    BOOST_CHECK_EQUAL(calib.getNSlotsInFlight(), 0);
+    BOOST_CHECK_EQUAL(nFinalized.load(), 10 * (run + 1));
+    calib.reset();
+  }
+}
@@ -39,6 +39,7 @@ class MeanVertexCalibDevice : public Task
   void sendOutput(DataAllocator& output);
 
   std::unique_ptr<o2::calibration::MeanVertexCalibrator> mCalibrator;
+  size_t mNFinalizedSlotsSent = 0; // number of finalized slots at the last sending
   std::shared_ptr<o2::base::GRPGeomRequest> mCCDBRequest;
 };
 
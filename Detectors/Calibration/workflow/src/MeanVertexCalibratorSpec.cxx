@@ -33,6 +33,9 @@ void MeanVertexCalibDevice::init(InitContext& ic)
   mCalibrator = std::make_unique<o2::calibration::MeanVertexCalibrator>();
   mCalibrator->setSlotLength(params.tfPerSlot);
   mCalibrator->setMaxSlotsDelay(float(params.maxTFdelay) / params.tfPerSlot);
+  if (params.maxSlotsInFlight > 0) {
+    mCalibrator->setAsyncFinalization(params.maxSlotsInFlight);
+  }
   bool useVerboseMode = ic.options().get<bool>("use-verbose-mode");
   LOG(info) << " ************************* Verbose? " << useVerboseMode;
   if (useVerboseMode) {
@@ -50,8 +53,7 @@ void MeanVertexCalibDevice::run(o2::framework::ProcessingContext& pc)
   LOG(debug) << "Processing TF " << mCalibrator->getCurrentTFInfo().tfCounter << " with " << data.size() << " vertices";
   mCalibrator->process(data);
   sendOutput(pc.outputs());
-  const auto& infoVec = mCalibrator->getMeanVertexObjectInfoVector();
-  LOG(detail) << "Processed TF " << mCalibrator->getCurrentTFInfo().tfCounter << " with " << data.size() << " vertices, for which we created " << infoVec.size() << " objects for TF " << mCalibrator->getCurrentTFInfo().tfCounter;
+  LOG(detail) << "Processed TF " << mCalibrator->getCurrentTFInfo().tfCounter << " with " << data.size() << " vertices";
 }
 
 //_________________________________________________________________
@@ -78,6 +80,13 @@ void MeanVertexCalibDevice::sendOutput(DataAllocator& output)
   // extract CCDB infos and calibration objects, convert it to TMemFile and send them to the output
   // TODO in principle, this routine is generic, can be moved to Utils.h
   using clbUtils = o2::calibration::Utils;
+  // the slots might be finalized in background: take the lock, which is held during a fit, only once one is done
+  auto nFinalizedSlots = mCalibrator->getNFinalizedSlots();
+  if (nFinalizedSlots == mNFinalizedSlotsSent) {
+    return;
+  }
+  auto outputLock = mCalibrator->getOutputLock();
+  mNFinalizedSlotsSent = nFinalizedSlots;
   const auto& payloadVec = mCalibrator->getMeanVertexObjectVector();
   auto& infoVec = mCalibrator->getMeanVertexObjectInfoVector(); // use non-const version as we update it
   assert(payloadVec.size() == infoVec.size());
@@ -0,0 +1,126 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#ifndef O2_DCS_DATAPOINT_INDEXER_H
+#define O2_DCS_DATAPOINT_INDEXER_H
+
+#include <cstdint>
+#include <vector>
+#include <gsl/span>
+#include "DetectorsDCS/DataPointIdentifier.h"
+#include "DetectorsDCS/DataPointValue.h"
+#include "DetectorsDCS/DataPointCompositeObject.h"
+
+namespace o2::dcs
+{
+
+/**
+ * Data point carrying the dense index assigned by a DataPointIndexer instead
+ * of the 64 byte DataPointIdentifier. The index is only meaningful together
+ * with the indexer which produced it.
+ */
+struct IndexedDataPoint {
+  uint32_t index = 0;    ///< dense index of the data point identifier
+  uint32_t reserved = 0; ///< padding, keeps the value 8 byte aligned
+  DataPointValue data;   ///< value of the data point
+
+  IndexedDataPoint() = default;
+  IndexedDataPoint(uint32_t idx, const DataPointValue& val) : index(idx), data(val) {}
+};
+
+/**
+ * DataPointIndexer maps the configured DataPointIdentifiers to dense integer
+ * indices in [0, size()), in the order in which they were given to init().
+ * The table is built once (e.g. per run, when the list of aliases is fetched
+ * from the CCDB), afterwards every look-up hashes the raw identifier words
+ * instead of rebuilding the alias string, so that processors can keep their
+ * per data point state in flat arrays indexed by getIndex().
+ */
+class DataPointIndexer
+{
+ public:
+  using Index = uint32_t;
+  static constexpr Index INVALID = 0xffffffff;
+
+  DataPointIndexer() = default;
+  DataPointIndexer(const std::vector<DataPointIdentifier>& pids) { init(pids); }
+
+  /// build the table, duplicated identifiers get the index of their first occurrence
+  void init(const std::vector<DataPointIdentifier>& pids);
+  void clear();
+
+  /// number of distinct identifiers
+  size_t size() const { return mIDs.size(); }
+  bool empty() const { return mIDs.empty(); }
+
+  /// dense index of the identifier, INVALID if it was not configured
+  Index getIndex(const DataPointIdentifier& id) const
+  {
+    if (mTable.empty()) {
+      return INVALID;
+    }
+    const size_t mask = mTable.size() - 1;
+    for (size_t slot = hash(id) & mask;; slot = (slot + 1) & mask) {
+      const auto idx = mTable[slot];
+      if (idx == INVALID || mIDs[idx] == id) {
+        return idx;
+      }
+    }
+  }
+  bool contains(const DataPointIdentifier& id) const { return getIndex(id) != INVALID; }
+
+  const DataPointIdentifier& getID(Index idx) const { return mIDs[idx]; }
+  const std::vector<DataPointIdentifier>& getIDs() const { return mIDs; }
+
+  /// convert data points to the indexed format, data points which were not configured are skipped
+  /// \return number of skipped data points
+  size_t index(gsl::span<const DataPointCompositeObject> dps, std::vector<IndexedDataPoint>& out) const;
+
+  /// hash of the raw identifier, consistent with DataPointIdentifier::operator==
+  static uint64_t hash(const DataPointIdentifier& id)
+  {
+    const auto* w = reinterpret_cast<const uint64_t*>(&id);
+    uint64_t h = 0;
+    for (int i = 0; i < 7; i++) {
+      h = (h ^ w[i]) * 0x9e3779b97f4a7c15ULL;
+      h ^= h >> 29;
+    }
+    // the most significant bit of the type is ignored by the comparison
+    h = (h ^ (w[7] & 0x7fffffffffffffffULL)) * 0x9e3779b97f4a7c15ULL;
+    return h ^ (h >> 32);
+  }
+
+ private:
+  std::vector<DataPointIdentifier> mIDs; ///< identifiers in index order
+  std::vector<Index> mTable;             ///< open addressing table with linear probing, size is a power of 2
+};
+
+} // namespace o2::dcs
+
+/// Defining IndexedDataPoint explicitly as messageable
+namespace o2::framework
+{
+template <typename T>
+struct is_messageable;
+template <>
+struct is_messageable<o2::dcs::IndexedDataPoint> : std::true_type {
+};
+} // namespace o2::framework
+
+/// Defining IndexedDataPoint explicitly as copiable
+namespace std
+{
+template <>
+struct is_trivially_copyable<o2::dcs::IndexedDataPoint> : std::true_type {
+};
+} // namespace std
+
+#endif
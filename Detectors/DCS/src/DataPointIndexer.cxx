@@ -0,0 +1,68 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include "DetectorsDCS/DataPointIndexer.h"
+#include <stdexcept>
+
+namespace o2::dcs
+{
+
+void DataPointIndexer::init(const std::vector<DataPointIdentifier>& pids)
+{
+  clear();
+  if (pids.size() >= INVALID) {
+    throw std::runtime_error("too many data point identifiers to index");
+  }
+  // keep the load factor below 1/2
+  size_t tableSize = 16;
+  while (tableSize < 2 * pids.size()) {
+    tableSize <<= 1;
+  }
+  mTable.assign(tableSize, INVALID);
+  mIDs.reserve(pids.size());
+  const size_t mask = tableSize - 1;
+  for (const auto& id : pids) {
+    for (size_t slot = hash(id) & mask;; slot = (slot + 1) & mask) {
+      auto& idx = mTable[slot];
+      if (idx == INVALID) {
+        idx = mIDs.size();
+        mIDs.push_back(id);
+        break;
+      }
+      if (mIDs[idx] == id) {
+        break;
+      }
+    }
+  }
+}
+
+void DataPointIndexer::clear()
+{
+  mIDs.clear();
+  mTable.clear();
+}
+
+size_t DataPointIndexer::index(gsl::span<const DataPointCompositeObject> dps, std::vector<IndexedDataPoint>& out) const
+{
+  size_t nSkipped = 0;
+  out.reserve(out.size() + dps.size());
+  for (const auto& dp : dps) {
+    const auto idx = getIndex(dp.id);
+    if (idx == INVALID) {
+      nSkipped++;
+      continue;
+    }
+    out.emplace_back(idx, dp.data);
+  }
+  return nSkipped;
+}
+
+} // namespace o2::dcs
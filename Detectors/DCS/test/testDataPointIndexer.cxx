@@ -0,0 +1,113 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test DCS DataPointIndexer
+#define BOOST_TEST_MAIN
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include "DetectorsDCS/DataPointIndexer.h"
+#include "DetectorsDCS/DataPointGenerator.h"
+#include <fairlogger/Logger.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <unordered_map>
+
+using namespace o2::dcs;
+
+namespace
+{
+// stream of data points resembling the TOF HV/LV configuration
+std::vector<DataPointCompositeObject> generateStream()
+{
+  std::vector<DataPointCompositeObject> dps;
+  for (const auto& alias : {"tof_hv_vp_[00..89]", "tof_hv_vn_[00..89]", "tof_hv_ip_[00..89]", "tof_hv_in_[00..89]"}) {
+    auto gen = generateRandomDataPoints<double>({alias}, 0., 6000., "2022-November-18 12:34:56");
+    dps.insert(dps.end(), gen.begin(), gen.end());
+  }
+  auto feac = generateRandomDataPoints<int32_t>({"TOF_FEACSTATUS_[00..71]", "TOF_HVSTATUS_SM[00..17]PLATE[0..4]"}, 0, 255, "2022-November-18 12:34:56");
+  dps.insert(dps.end(), feac.begin(), feac.end());
+  return dps;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(IndexOfConfiguredIDs)
+{
+  const auto dps = generateStream();
+  std::vector<DataPointIdentifier> pids;
+  for (const auto& dp : dps) {
+    pids.push_back(dp.id);
+  }
+  pids.push_back(pids.front()); // duplicates keep the first index
+
+  DataPointIndexer indexer(pids);
+  BOOST_CHECK_EQUAL(indexer.size(), dps.size());
+  for (size_t i = 0; i < dps.size(); i++) {
+    BOOST_CHECK_EQUAL(indexer.getIndex(dps[i].id), i);
+    BOOST_CHECK(indexer.getID(i) == dps[i].id);
+  }
+
+  // unknown identifiers and identifiers of a different type are not found
+  BOOST_CHECK_EQUAL(indexer.getIndex(DataPointIdentifier("tof_hv_vp_90", DPVAL_DOUBLE)), DataPointIndexer::INVALID);
+  BOOST_CHECK_EQUAL(indexer.getIndex(DataPointIdentifier("tof_hv_vp_00", DPVAL_INT)), DataPointIndexer::INVALID);
+  BOOST_CHECK_EQUAL(DataPointIndexer().getIndex(dps[0].id), DataPointIndexer::INVALID);
+
+  // conversion to the indexed format
+  std::vector<DataPointCompositeObject> stream(dps.begin(), dps.end());
+  stream.emplace_back(DataPointIdentifier("TOF_UNKNOWN", DPVAL_INT), DataPointValue());
+  std::vector<IndexedDataPoint> indexed;
+  BOOST_CHECK_EQUAL(indexer.index(stream, indexed), 1);
+  BOOST_REQUIRE_EQUAL(indexed.size(), dps.size());
+  for (size_t i = 0; i < dps.size(); i++) {
+    BOOST_CHECK_EQUAL(indexed[i].index, i);
+    BOOST_CHECK(indexed[i].data == dps[i].data);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(IndexerReplayTiming)
+{
+  // replay the stream in random order and compare the look-up time with the hash map keyed by the identifier
+  using timer = std::chrono::high_resolution_clock;
+  const auto dps = generateStream();
+  std::vector<DataPointIdentifier> pids;
+  std::unordered_map<DataPointIdentifier, size_t> map;
+  for (const auto& dp : dps) {
+    map[dp.id] = pids.size();
+    pids.push_back(dp.id);
+  }
+  DataPointIndexer indexer(pids);
+
+  std::vector<DataPointCompositeObject> stream;
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<size_t> dist(0, dps.size() - 1);
+  const size_t nReplay = 200000;
+  stream.reserve(nReplay);
+  for (size_t i = 0; i < nReplay; i++) {
+    stream.push_back(dps[dist(gen)]);
+  }
+
+  size_t sumMap = 0, sumIndexer = 0;
+  auto start = timer::now();
+  for (const auto& dp : stream) {
+    sumMap += map.find(dp.id)->second;
+  }
+  const std::chrono::duration<double, std::nano> timeMap = timer::now() - start;
+  start = timer::now();
+  for (const auto& dp : stream) {
+    sumIndexer += indexer.getIndex(dp.id);
+  }
+  const std::chrono::duration<double, std::nano> timeIndexer = timer::now() - start;
+  BOOST_CHECK_EQUAL(sumMap, sumIndexer);
+  LOGP(info, "look-up of {} DPs out of {}: unordered_map {:.1f} ns/DP, DataPointIndexer {:.1f} ns/DP",
+       nReplay, dps.size(), timeMap.count() / nReplay, timeIndexer.count() / nReplay);
+}
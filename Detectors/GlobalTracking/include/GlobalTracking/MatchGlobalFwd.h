@@ -119,6 +119,8 @@ class MatchGlobalFwd
   void finalize();
   void clear();
   void setBz(float bz) { mBz = bz; }
+  ///< number of threads for the matching and the fit of the global tracks
+  void setNThreads(int n);
 
   void setMFTDictionary(const o2::itsmft::TopologyDictionary* d) { mMFTDict = d; }
   void setMatchingPlaneZ(float z) { mMatchingPlaneZ = z; };
@@ -166,6 +168,8 @@ class MatchGlobalFwd
   ///< Matches MFT tracks in one MFT ROFrame with all MCH tracks in the overlapping MCH ROFrames
   template <int saveMode>
   void ROFMatch(int MFTROFId, int firstMCHROFId, int lastMCHROFId);
+  ///< Matches one MCH track with the MFT tracks of one MFT ROFrame keeping the best candidate, independent of the other MCH tracks
+  void bestMatchInROF(int MCHId, int MFTROFId, const MatchingFunc_t& matchAllChi2);
 
   void fitTracks();                                          ///< Fit all matched tracks
   void fitGlobalMuonTrack(o2::dataformats::GlobalFwdTrack&); ///< Kalman filter fit global Forward track by attaching MFT clusters
@@ -340,6 +344,9 @@ class MatchGlobalFwd
   int mSaveMode = 0;            ///< Output mode [0 = SaveBestMatch; 1 = SaveAllMatches; 2 = SaveTrainingData]
   MatchingType mMatchingType = MATCHINGUNDEFINED;
   TGeoManager* mGeoManager;
+  int mNThreads = 1;         ///< number of OMP threads
+  TStopwatch mTimerMatching; ///< time spent in the matching of the current TF
+  TStopwatch mTimerFit;      ///< time spent in the fit of the global tracks of the current TF
 };
 
 } // namespace globaltracking
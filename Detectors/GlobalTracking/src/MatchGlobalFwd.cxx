@@ -83,6 +83,7 @@ void MatchGlobalFwd::run(const o2::globaltracking::RecoContainer& inp)
     return;
   }
 
+  mTimerMatching.Start();
   if (matchingParam.MCMatching) { // MC Label matching
     mMCTruthON ? doMCMatching() : throw std::runtime_error("Label matching requries MC Labels!");
   } else {
@@ -109,8 +110,11 @@ void MatchGlobalFwd::run(const o2::globaltracking::RecoContainer& inp)
         LOG(fatal) << "Invalid MFTMCH matching mode";
     }
   }
+  mTimerMatching.Stop();
 
+  mTimerFit.Start();
   fitTracks();
+  mTimerFit.Stop();
   finalize();
 }
 
@@ -118,6 +122,7 @@ void MatchGlobalFwd::run(const o2::globaltracking::RecoContainer& inp)
 void MatchGlobalFwd::finalize()
 {
   LOG(info) << " Finalizing GlobalForwardMatch. Pushing " << mMatchedTracks.size() << " matched tracks";
+  LOGP(info, "Matching took {:.3f} s, fit took {:.3f} s (real time) with {} threads", mTimerMatching.RealTime(), mTimerFit.RealTime(), mNThreads);
 }
 
 //_________________________________________________________
@@ -335,6 +340,12 @@ void MatchGlobalFwd::doMatching()
   int nMCHROFs = mMCHROFTimes.size();
 
   LOG(info) << "Running MCH-MFT Track Matching.";
+  // in best match mode every MCH track keeps its best candidate independently of the others:
+  // the MFT ROFs to match with are collected for each MCH ROF and the MCH ROFs are processed in parallel
+  std::vector<std::vector<int>> MFTROFsPerMCHROF;
+  if constexpr (saveAllMode == SaveMode::kBestMatch) {
+    MFTROFsPerMCHROF.resize(nMCHROFs);
+  }
   // ROFrame of first MFT track
   auto firstMFTTrackIdInROF = 0;
   auto MFTROFId = mMFTWork.front().roFrame;
@@ -376,10 +387,30 @@ void MatchGlobalFwd::doMatching()
                << mMCHROFTimes[mchROFMatchLast].getMin() << ","
                << mMCHROFTimes[mchROFMatchLast].getMax() << "]  size: " << mMCHTrackROFRec[mchROFMatchLast].getNEntries();
 
-    ROFMatch<saveAllMode>(MFTROFId, mchROFMatchFirst, mchROFMatchLast);
+    if constexpr (saveAllMode == SaveMode::kBestMatch) {
+      for (int mchROF = mchROFMatchFirst; mchROF <= mchROFMatchLast; mchROF++) {
+        MFTROFsPerMCHROF[mchROF].push_back(MFTROFId);
+      }
+    } else {
+      ROFMatch<saveAllMode>(MFTROFId, mchROFMatchFirst, mchROFMatchLast);
+    }
   }
 
   if constexpr (saveAllMode == SaveMode::kBestMatch) { // Otherwise output container is filled by ROFMatch()
+    const auto& matchAllChi2 = mMatchingFunctionMap["matchALL"];
+    // the MFT ROFs are visited in the same order for each MCH track, whatever the number of threads
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+    for (int mchROF = 0; mchROF < nMCHROFs; mchROF++) {
+      const auto& thisMCHROF = mMCHTrackROFRec[mchROF];
+      for (auto MCHId = thisMCHROF.getFirstIdx(); MCHId <= thisMCHROF.getLastIdx(); MCHId++) {
+        for (auto MFTROFId : MFTROFsPerMCHROF[mchROF]) {
+          bestMatchInROF(MCHId, MFTROFId, matchAllChi2);
+        }
+      }
+    }
+
     int nFakes = 0, nTrue = 0;
     for (auto& thisMCHTrack : mMCHWork) {
       auto bestMFTMatchID = thisMCHTrack.getMFTTrackID();
@@ -489,6 +520,35 @@ void MatchGlobalFwd::ROFMatch(int MFTROFId, int firstMCHROFId, int lastMCHROFId)
   }
 }
 
+//_________________________________________________________
+void MatchGlobalFwd::bestMatchInROF(int MCHId, int MFTROFId, const MatchingFunc_t& matchAllChi2)
+{
+  /// Matches one MCH track with the MFT tracks on a given ROF, keeping the best candidate
+  const auto& thisMFTROF = mMFTTrackROFRec[MFTROFId];
+  auto firstMFTTrackID = thisMFTROF.getFirstEntry();
+  auto lastMFTTrackID = firstMFTTrackID + thisMFTROF.getNEntries() - 1;
+
+  auto& thisMCHTrack = mMCHWork[MCHId];
+  for (auto MFTId = firstMFTTrackID; MFTId <= lastMFTTrackID; MFTId++) {
+    auto& thisMFTTrack = mMFTWork[MFTId];
+    if (mCutFunc(thisMCHTrack, thisMFTTrack)) {
+      thisMCHTrack.countMFTCandidate();
+      if (mMCTruthON) {
+        if (computeLabel(MCHId, MFTId).isCorrect()) {
+          thisMCHTrack.setCloseMatch();
+        }
+      }
+      auto score = mMatchFunc(thisMCHTrack, thisMFTTrack);
+      if (score < thisMCHTrack.getMFTMCHMatchingScore()) {
+        thisMCHTrack.setMFTTrackID(MFTId);
+        auto chi2 = matchAllChi2(thisMCHTrack, thisMFTTrack); // Matching chi2 is stored independently
+        thisMCHTrack.setMFTMCHMatchingScore(score);
+        thisMCHTrack.setMFTMCHMatchingChi2(chi2);
+      }
+    }
+  }
+}
+
 //_________________________________________________________
 o2::MCCompLabel MatchGlobalFwd::computeLabel(const int MCHId, const int MFTId)
 {
@@ -550,12 +610,14 @@ void MatchGlobalFwd::fitTracks()
 {
   LOG(info) << "Fitting global muon tracks...";
 
-  auto GTrackID = 0;
-
-  for (auto& track : mMatchedTracks) {
+  // the tracks are fitted independently, the propagation and Kalman filter state is carried by the track itself
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 16) num_threads(mNThreads)
+#endif
+  for (int GTrackID = 0; GTrackID < (int)mMatchedTracks.size(); GTrackID++) {
+    auto& track = mMatchedTracks[GTrackID];
     LOG(debug) << "  ==> Fitting Global Track # " << GTrackID << " with MFT track # " << track.getMFTTrackID() << ":";
     fitGlobalMuonTrack(track);
-    GTrackID++;
   }
 
   LOG(info) << "Finished fitting global muon tracks.";
@@ -635,6 +697,17 @@ bool MatchGlobalFwd::computeCluster(o2::dataformats::GlobalFwdTrack& track, cons
   return false;
 }
 
+//_________________________________________________________
+void MatchGlobalFwd::setNThreads(int n)
+{
+#ifdef WITH_OPENMP
+  mNThreads = n > 0 ? n : 1;
+#else
+  LOG(warning) << "Multithreading is not supported, imposing single thread";
+  mNThreads = 1;
+#endif
+}
+
 //_________________________________________________________
 void MatchGlobalFwd::setMFTROFrameLengthMUS(float fums)
 {
@@ -0,0 +1,78 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// @file   SCurveFitter.h
+/// @brief  Thread safe fit of the S-curves of threshold scans, several pixels at once
+
+#ifndef O2_ITS_SCURVEFITTER
+#define O2_ITS_SCURVEFITTER
+
+#include <vector>
+
+namespace o2
+{
+namespace its
+{
+
+/// Fits n(x) = A * (1 + erf((x - threshold) / (sqrt(2) * noise))) (or A * (1 - erf(...)) for reversed
+/// curves, e.g. ITHR scans) to the number of hits per injected charge with a binned Poisson likelihood,
+/// i.e. the same model as TH1::Fit("RQL") with the erf TF1 used by the threshold calibration.
+/// The starting values come from the derivative of the curve (closed form), then a few Levenberg-Marquardt
+/// steps are done on NLanes pixels at once, with the loops running across the pixels so that they vectorize.
+/// The fitter has no mutable state, fit() can be called concurrently from several threads.
+class SCurveFitter
+{
+ public:
+  static constexpr int NLanes = 8; ///< number of S-curves fitted together
+
+  struct Result {
+    float threshold = 0.f;
+    float noise = 0.f;
+    float chi2 = 0.f; ///< likelihood chi2 (Baker-Cousins) per degree of freedom, as TF1::GetChisquare() / TF1::GetNDF()
+    bool converged = false;
+  };
+
+  SCurveFitter() = default;
+
+  /// \param x abscissa of the points of every S-curve
+  /// \param nPoints number of points of every S-curve
+  /// \param xmin, xmax only the points within [xmin, xmax] are fitted
+  /// \param amplitude half of the plateau value, A in the formula above
+  /// \param reversed the curve decreases with x
+  void init(const float* x, int nPoints, float xmin, float xmax, float amplitude, bool reversed);
+
+  void setMaxIterations(int n) { mMaxIterations = n; }
+  int getNPoints() const { return mNPoints; }
+  /// number of fitted points (within the range)
+  int getNFitPoints() const { return mLast - mFirst; }
+
+  /// fit nCurves S-curves, the nPoints counts of curve i are at counts[i * nPoints]
+  void fit(const unsigned short* counts, int nCurves, Result* results) const;
+
+  /// value of the S-curve function
+  double evaluate(double x, double threshold, double noise) const;
+
+ private:
+  void fitLanes(const unsigned short* counts, int nCurves, Result* results) const;
+
+  std::vector<double> mX; ///< abscissa of the fitted points
+  int mNPoints = 0;       ///< number of points of the S-curves
+  int mFirst = 0;         ///< first fitted point
+  int mLast = 0;          ///< last fitted point + 1
+  double mAmplitude = 0.;
+  double mSign = 1.;      ///< -1 for reversed curves
+  int mMaxIterations = 30;
+};
+
+} // namespace its
+} // namespace o2
+
+#endif
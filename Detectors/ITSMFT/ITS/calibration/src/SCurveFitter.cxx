@@ -0,0 +1,294 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// @file   SCurveFitter.cxx
+
+#include "ITSCalibration/SCurveFitter.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+using namespace o2::its;
+
+namespace
+{
+constexpr int NL = SCurveFitter::NLanes;
+constexpr double MinValue = 1e-30; ///< added to the model, avoids log(0)
+
+// The math functions below only use arithmetic and bit operations, so that the loops over the lanes vectorize
+// also with SSE2: std::exp, std::log and std::erf are library calls, and comparisons of doubles or of 64 bit
+// integers would prevent the if-conversion or are not available.
+// Rounding with this constant gives the nearest integer in the low bits of the mantissa.
+constexpr double RoundMagic = 6755399441055744.0; // 1.5 * 2^52
+
+inline uint64_t asBits(double x)
+{
+  uint64_t b;
+  std::memcpy(&b, &x, sizeof(b));
+  return b;
+}
+
+inline double asDouble(uint64_t b)
+{
+  double x;
+  std::memcpy(&x, &b, sizeof(x));
+  return x;
+}
+
+/// min(a, b) without comparison
+inline double minArith(double a, double b)
+{
+  return 0.5 * (a + b - std::fabs(a - b));
+}
+
+/// exp(x) for -700 < x <= 1
+inline double fastExp(double x)
+{
+  constexpr double Log2E = 1.4426950408889634, Ln2Hi = 0.6931471803691238, Ln2Lo = 1.9082149292705877e-10;
+  const double kr = x * Log2E + RoundMagic;
+  const double k = kr - RoundMagic;
+  const double r = x - k * Ln2Hi - k * Ln2Lo; // |r| <= ln(2) / 2
+  double p = 1. / 39916800.;
+  p = p * r + 1. / 3628800.;
+  p = p * r + 1. / 362880.;
+  p = p * r + 1. / 40320.;
+  p = p * r + 1. / 5040.;
+  p = p * r + 1. / 720.;
+  p = p * r + 1. / 120.;
+  p = p * r + 1. / 24.;
+  p = p * r + 1. / 6.;
+  p = p * r + 0.5;
+  p = p * r + 1.;
+  p = p * r + 1.;
+  return p * asDouble((asBits(kr) + 1023) << 52); // 2^k
+}
+
+/// log(x) for positive normal x
+inline double logPos(double x)
+{
+  constexpr double Ln2 = 0.6931471805599453;
+  const uint64_t b = asBits(x);
+  // mantissa in [sqrt(2)/2, sqrt(2)), large = mant > mantissa of sqrt(2) obtained from the carry into bit 52
+  const uint64_t mant = b & 0x000fffffffffffffULL;
+  const uint64_t large = (mant + (0x0010000000000000ULL - 0x6a09e667f3bcdULL - 1)) >> 52;
+  const double e = asDouble(((b >> 52) + large) | 0x4330000000000000ULL) - 4503599627370496. - 1023.;
+  const double m = asDouble(mant | (0x3ff0000000000000ULL - (large << 52)));
+  const double z = (m - 1.) / (m + 1.), z2 = z * z; // |z| < 0.172
+  double s = 1. / 17.;
+  s = s * z2 + 1. / 15.;
+  s = s * z2 + 1. / 13.;
+  s = s * z2 + 1. / 11.;
+  s = s * z2 + 1. / 9.;
+  s = s * z2 + 1. / 7.;
+  s = s * z2 + 1. / 5.;
+  s = s * z2 + 1. / 3.;
+  s = s * z2 + 1.;
+  return e * Ln2 + 2. * z * s;
+}
+
+/// erfc(z) for z >= 0 given exp(-z^2), Chebyshev fit with relative error < 1.2e-7 (Numerical Recipes erfcc),
+/// the relative accuracy in the tail matters for the likelihood
+inline double erfcFromExp(double z, double expmz2)
+{
+  const double t = 1. / (1. + 0.5 * z);
+  double p = 0.17087277;
+  p = p * t - 0.82215223;
+  p = p * t + 1.48851587;
+  p = p * t - 1.13520398;
+  p = p * t + 0.27886807;
+  p = p * t - 0.18628806;
+  p = p * t + 0.09678418;
+  p = p * t + 0.37409196;
+  p = p * t + 1.00002368;
+  p = p * t - 1.26551223;
+  return t * expmz2 * fastExp(p);
+}
+
+/// sums over the points of the negative log-likelihood, its gradient and the Fisher information
+struct LaneSums {
+  double nll[NL], g0[NL], g1[NL], h00[NL], h01[NL], h11[NL];
+};
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////
+void SCurveFitter::init(const float* x, int nPoints, float xmin, float xmax, float amplitude, bool reversed)
+{
+  mX.assign(x, x + nPoints);
+  mNPoints = nPoints;
+  mFirst = 0;
+  while (mFirst < nPoints && mX[mFirst] < xmin) {
+    mFirst++;
+  }
+  mLast = mFirst;
+  while (mLast < nPoints && mX[mLast] <= xmax) {
+    mLast++;
+  }
+  mAmplitude = amplitude;
+  mSign = reversed ? -1. : 1.;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+double SCurveFitter::evaluate(double x, double threshold, double noise) const
+{
+  return mAmplitude * (1. + mSign * std::erf((x - threshold) / (std::sqrt(2.) * noise)));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SCurveFitter::fit(const unsigned short* counts, int nCurves, Result* results) const
+{
+  for (int i = 0; i < nCurves; i += NLanes) {
+    fitLanes(counts + i * mNPoints, std::min(NLanes, nCurves - i), results + i);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SCurveFitter::fitLanes(const unsigned short* counts, int nCurves, Result* results) const
+{
+  const int nFit = mLast - mFirst;
+  if (nFit < 3) {
+    for (int l = 0; l < nCurves; l++) {
+      results[l] = Result{};
+    }
+    return;
+  }
+  const double* x = mX.data() + mFirst;
+
+  // counts of the lanes next to each other, unused lanes are left empty
+  std::vector<double> n(nFit * NL, 0.);
+  for (int l = 0; l < nCurves; l++) {
+    for (int p = 0; p < nFit; p++) {
+      n[p * NL + l] = counts[l * mNPoints + mFirst + p];
+    }
+  }
+
+  // starting values: mean and RMS of the derivative of the S-curve
+  const double step = (x[nFit - 1] - x[0]) / (nFit - 1);
+  double thr[NL], noise[NL];
+  for (int l = 0; l < NL; l++) {
+    double sw = 0., swx = 0., swx2 = 0.;
+    for (int p = 0; p < nFit - 1; p++) {
+      const double w = mSign * (n[(p + 1) * NL + l] - n[p * NL + l]);
+      const double xm = 0.5 * (x[p] + x[p + 1]);
+      sw += w;
+      swx += w * xm;
+      swx2 += w * xm * xm;
+    }
+    if (sw > 0.) {
+      thr[l] = std::clamp(swx / sw, x[0], x[nFit - 1]);
+      const double var = swx2 / sw - thr[l] * thr[l] - step * step / 12.;
+      noise[l] = std::sqrt(std::max(var, 0.0625 * step * step));
+    } else {
+      thr[l] = 0.5 * (x[0] + x[nFit - 1]);
+      noise[l] = step;
+    }
+  }
+
+  const double minNoise = 1e-3 * step;
+  const double ampl = mAmplitude, sign = mSign;
+  constexpr double TwoOverSqrtPi = 1.1283791670955126, InvSqrt2 = 0.7071067811865476;
+
+  // negative log-likelihood sum(f - n * log(f)), gradient and Fisher information sum(f'_i f'_j / f)
+  auto evaluateSums = [&](const double* t, const double* s, LaneSums& sums) {
+    double invs[NL];
+    for (int l = 0; l < NL; l++) {
+      invs[l] = InvSqrt2 / s[l];
+      sums.nll[l] = sums.g0[l] = sums.g1[l] = sums.h00[l] = sums.h01[l] = sums.h11[l] = 0.;
+    }
+    for (int p = 0; p < nFit; p++) {
+      const double xp = x[p];
+      const double* np = &n[p * NL];
+#ifdef WITH_OPENMP
+#pragma omp simd
+#endif
+      for (int l = 0; l < NL; l++) {
+        const double u = (xp - t[l]) * invs[l];
+        const double e = fastExp(-minArith(u * u, 80.)); // far tails are cut to avoid denormals
+        const double ec = erfcFromExp(std::fabs(u), e);
+        const double rising = 0.5 + std::copysign(0.5, sign * u);                   // 1 on the plateau side, else 0
+        const double f = ampl * (ec + rising * 2. * (1. - ec)) + MinValue;           // ampl * (1 + sign * erf(u))
+        const double dfdu = ampl * sign * TwoOverSqrtPi * e;
+        const double dft = -dfdu * invs[l];    // df/dthreshold
+        const double dfs = -dfdu * u / s[l];   // df/dnoise
+        const double w = 1. / f;
+        const double r = 1. - np[l] * w;
+        sums.nll[l] += f - np[l] * logPos(f);
+        sums.g0[l] += r * dft;
+        sums.g1[l] += r * dfs;
+        sums.h00[l] += w * dft * dft;
+        sums.h01[l] += w * dft * dfs;
+        sums.h11[l] += w * dfs * dfs;
+      }
+    }
+  };
+
+  // Levenberg-Marquardt iterations
+  LaneSums cur, trial;
+  double lambda[NL], trialThr[NL], trialNoise[NL];
+  bool done[NL];
+  evaluateSums(thr, noise, cur);
+  for (int l = 0; l < NL; l++) {
+    lambda[l] = 1e-3;
+    done[l] = l >= nCurves;
+  }
+  for (int it = 0; it < mMaxIterations; it++) {
+    for (int l = 0; l < NL; l++) {
+      const double a = cur.h00[l] * (1. + lambda[l]), b = cur.h01[l], c = cur.h11[l] * (1. + lambda[l]);
+      const double det = a * c - b * b;
+      const double dt = det > 0. ? -(c * cur.g0[l] - b * cur.g1[l]) / det : 0.;
+      const double ds = det > 0. ? -(a * cur.g1[l] - b * cur.g0[l]) / det : 0.;
+      trialThr[l] = done[l] ? thr[l] : thr[l] + dt;
+      trialNoise[l] = done[l] ? noise[l] : std::max(noise[l] + ds, minNoise);
+    }
+    evaluateSums(trialThr, trialNoise, trial);
+    bool allDone = true;
+    for (int l = 0; l < NL; l++) {
+      if (done[l]) {
+        continue;
+      }
+      if (trial.nll[l] <= cur.nll[l]) {
+        // a change of the likelihood of 1e-6 is far below the statistical precision of the parameters
+        const bool small = cur.nll[l] - trial.nll[l] < 1e-6;
+        thr[l] = trialThr[l];
+        noise[l] = trialNoise[l];
+        cur.nll[l] = trial.nll[l];
+        cur.g0[l] = trial.g0[l];
+        cur.g1[l] = trial.g1[l];
+        cur.h00[l] = trial.h00[l];
+        cur.h01[l] = trial.h01[l];
+        cur.h11[l] = trial.h11[l];
+        lambda[l] = std::max(0.1 * lambda[l], 1e-9);
+        done[l] = small;
+      } else {
+        lambda[l] *= 10.;
+        done[l] = lambda[l] > 1e9; // no further improvement possible
+      }
+      allDone &= done[l];
+    }
+    if (allDone) {
+      break;
+    }
+  }
+
+  // likelihood chi2: 2 * (nll - nll of the saturated model)
+  for (int l = 0; l < nCurves; l++) {
+    double nllSat = 0.;
+    for (int p = 0; p < nFit; p++) {
+      const double np = n[p * NL + l];
+      nllSat += np > 0. ? np - np * std::log(np) : 0.;
+    }
+    auto& res = results[l];
+    res.threshold = thr[l];
+    res.noise = noise[l];
+    res.chi2 = 2. * (cur.nll[l] - nllSat) / (nFit - 2);
+    res.converged = done[l];
+  }
+}
@@ -0,0 +1,138 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   testSCurveFitter.cxx
+/// \brief  SCurveFitter compared to the TF1 likelihood fit on simulated S-curves, results and timing
+///
+
+#define BOOST_TEST_MODULE Test ITS SCurveFitter
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "ITSCalibration/SCurveFitter.h"
+#include <fairlogger/Logger.h>
+#include <TF1.h>
+#include <TH1F.h>
+#include <TMath.h>
+#include <TRandom.h>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+using namespace o2::its;
+
+namespace
+{
+constexpr int NPoints = 51;
+constexpr int NInj = 50;
+constexpr float XMin = 3.f, XMax = 50.f;
+
+/// negative Poisson log-likelihood of the curve in the fit range, up to a constant
+double nll(const SCurveFitter& fitter, const float* x, const unsigned short* n, double thr, double noise)
+{
+  double sum = 0.;
+  for (int i = 0; i < NPoints; i++) {
+    if (x[i] < XMin || x[i] > XMax) {
+      continue;
+    }
+    const double f = std::max(fitter.evaluate(x[i], thr, noise), 1e-30);
+    sum += f - n[i] * std::log(f);
+  }
+  return sum;
+}
+
+void compareWithTF1(bool reversed, int nCurves)
+{
+  gRandom->SetSeed(reversed ? 123 : 321);
+  float x[NPoints];
+  for (int i = 0; i < NPoints; i++) {
+    x[i] = i;
+  }
+  std::vector<unsigned short> counts(nCurves * NPoints);
+  std::vector<float> trueThr(nCurves);
+  for (int c = 0; c < nCurves; c++) {
+    trueThr[c] = gRandom->Gaus(20, 2);
+    const float noise = gRandom->Uniform(0.3, 1.);
+    for (int i = 0; i < NPoints; i++) {
+      const double p = 0.5 * (1. + (reversed ? -1 : 1) * TMath::Erf((x[i] - trueThr[c]) / (std::sqrt(2.) * noise)));
+      counts[c * NPoints + i] = gRandom->Binomial(NInj, p);
+    }
+  }
+
+  using timer = std::chrono::high_resolution_clock;
+  SCurveFitter fitter;
+  fitter.init(x, NPoints, XMin, XMax, NInj / 2., reversed);
+  std::vector<SCurveFitter::Result> results(nCurves);
+  auto start = timer::now();
+  fitter.fit(counts.data(), nCurves, results.data());
+  const std::chrono::duration<double, std::micro> timeFitter = timer::now() - start;
+
+  // reference: the TF1 fit done by the threshold calibration, with the bins centred on the injected charges
+  TH1F hist("scurve", "", NPoints, x[0] - 0.5, x[NPoints - 1] + 0.5);
+  TF1 func("fit", reversed ? "[2]*(1-TMath::Erf((x-[0])/(sqrt(2)*[1])))" : "[2]*(1+TMath::Erf((x-[0])/(sqrt(2)*[1])))", XMin, XMax);
+  std::chrono::duration<double, std::micro> timeTF1{0};
+  int nConverged = 0;
+  for (int c = 0; c < nCurves; c++) {
+    const unsigned short* n = &counts[c * NPoints];
+    for (int i = 0; i < NPoints; i++) {
+      hist.SetBinContent(i + 1, n[i]);
+    }
+    start = timer::now();
+    func.SetParameter(0, trueThr[c]);
+    func.SetParameter(1, 0.5);
+    func.FixParameter(2, NInj / 2.);
+    hist.Fit("fit", "RQL");
+    timeTF1 += timer::now() - start;
+
+    const auto& res = results[c];
+    nConverged += res.converged;
+    const double nllFitter = nll(fitter, x, n, res.threshold, res.noise);
+    const double nllTF1 = nll(fitter, x, n, func.GetParameter(0), func.GetParameter(1));
+    // both are maximum likelihood estimates: the fitter must be at least as good, the parameters agree within
+    // a small fraction of their uncertainty unless the likelihood is flat (noise much smaller than the step)
+    BOOST_CHECK_LE(nllFitter, nllTF1 + 1e-3);
+    if (res.noise > 0.4) {
+      BOOST_CHECK_SMALL(res.threshold - func.GetParameter(0), 0.1);
+    }
+    BOOST_CHECK_SMALL(res.threshold - trueThr[c], 1.f);
+  }
+  BOOST_CHECK_GE(nConverged, 0.99 * nCurves);
+  LOGP(info, "{} S-curves ({}): SCurveFitter {:.2f} us/curve, TF1 {:.2f} us/curve", nCurves, reversed ? "reversed" : "rising",
+       timeFitter.count() / nCurves, timeTF1.count() / nCurves);
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(SCurveFitter_rising)
+{
+  compareWithTF1(false, 1000);
+}
+
+BOOST_AUTO_TEST_CASE(SCurveFitter_reversed)
+{
+  compareWithTF1(true, 1000);
+}
+
+BOOST_AUTO_TEST_CASE(SCurveFitter_noS)
+{
+  // a curve without S shape must not give a good chi2
+  float x[NPoints];
+  unsigned short counts[NPoints];
+  for (int i = 0; i < NPoints; i++) {
+    x[i] = i;
+    counts[i] = i % 2 ? NInj : 0;
+  }
+  SCurveFitter fitter;
+  fitter.init(x, NPoints, XMin, XMax, NInj / 2., false);
+  SCurveFitter::Result result;
+  fitter.fit(counts, 1, &result);
+  BOOST_CHECK_GT(result.chi2, 5.f);
+}
@@ -47,6 +47,7 @@
 #include "CCDB/CcdbApi.h"
 #include "CommonUtils/MemFileHelper.h"
 #include "DataFormatsDCS/DCSConfigObject.h"
+#include "ITSCalibration/SCurveFitter.h"
 
 // ROOT includes
 #include "TTree.h"
@@ -176,6 +177,11 @@ class ITSThresholdCalibrator : public Task
   // Initialize pointers for doing error function fits
   TH1F* mFitHist = nullptr;
   TF1* mFitFunction = nullptr;
+  // Thread safe fitter doing the same fit as mFitFunction, the TF1 is kept for the dumped s-curves
+  SCurveFitter mFitter;
+  std::vector<short int> mFitColumns;
+  std::vector<unsigned short int> mFitCounts;
+  std::vector<SCurveFitter::Result> mFitResults;
 
   // Some private helper functions
   // Helper functions related to the running over data
@@ -189,11 +195,11 @@ class ITSThresholdCalibrator : public Task
 
   // Helper functions related to threshold extraction
   void initThresholdTree(bool recreate = true);
-  bool findUpperLower(std::vector<std::vector<unsigned short int>>, const short int&, short int&, short int&, bool, int);
-  bool findThreshold(const short int&, std::vector<std::vector<unsigned short int>>, const float*, short int&, float&, float&, int&, int);
-  bool findThresholdFit(const short int&, std::vector<std::vector<unsigned short int>>, const float*, const short int&, float&, float&, int&, int);
-  bool findThresholdDerivative(std::vector<std::vector<unsigned short int>>, const float*, const short int&, float&, float&, int&, int);
-  bool findThresholdHitcounting(std::vector<std::vector<unsigned short int>>, const float*, const short int&, float&, int);
+  bool findUpperLower(const std::vector<std::vector<unsigned short int>>&, const short int&, short int&, short int&, bool, int);
+  bool findThreshold(const short int&, const std::vector<std::vector<unsigned short int>>&, const float*, short int&, float&, float&, int&, int);
+  void findThresholdFitRow(const short int&, const short int&, int);
+  bool findThresholdDerivative(const std::vector<std::vector<unsigned short int>>&, const float*, const short int&, float&, float&, int&, int);
+  bool findThresholdHitcounting(const std::vector<std::vector<unsigned short int>>&, const float*, const short int&, float&, int);
   bool isScanFinished(const short int&, const short int&, const short int&);
   void findAverage(const std::array<long int, 6>&, float&, float&, float&, float&);
   void saveThreshold();
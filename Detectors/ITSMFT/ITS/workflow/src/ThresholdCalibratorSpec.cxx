@@ -116,11 +116,6 @@ void ITSThresholdCalibrator::init(InitContext& ic)
   // Get number of threads
   this->mNThreads = ic.options().get<int>("nthreads");
 
-  // Check fit type vs nthreads (fit option is not thread safe!)
-  if (mFitType == FIT && mNThreads > 1) {
-    throw std::runtime_error("Multiple threads are requested with fit method which is not thread safe");
-  }
-
   // Machine hostname
   this->mHostname = boost::asio::ip::host_name();
 
@@ -405,7 +400,7 @@ void ITSThresholdCalibrator::initThresholdTree(bool recreate /*=true*/)
 // x is the array of charge injected values;
 // NPoints is the length of both arrays.
 bool ITSThresholdCalibrator::findUpperLower(
-  std::vector<std::vector<unsigned short int>> data, const short int& NPoints,
+  const std::vector<std::vector<unsigned short int>>& data, const short int& NPoints,
   short int& lower, short int& upper, bool flip, int iloop2)
 {
   // Initialize (or re-initialize) upper and lower
@@ -463,9 +458,10 @@ bool ITSThresholdCalibrator::findUpperLower(
 }
 
 //////////////////////////////////////////////////////////////////////////////
-// Main findThreshold function which calls one of the three methods
+// Main findThreshold function which calls the derivative or hit-counting method,
+// the fit is done for the whole row at once in findThresholdFitRow
 bool ITSThresholdCalibrator::findThreshold(
-  const short int& chipID, std::vector<std::vector<unsigned short int>> data, const float* x, short int& NPoints,
+  const short int& chipID, const std::vector<std::vector<unsigned short int>>& data, const float* x, short int& NPoints,
   float& thresh, float& noise, int& spoints, int iloop2)
 {
   bool success = false;
@@ -475,10 +471,6 @@ bool ITSThresholdCalibrator::findThreshold(
       success = this->findThresholdDerivative(data, x, NPoints, thresh, noise, spoints, iloop2);
       break;
 
-    case FIT: // Fit method
-      success = this->findThresholdFit(chipID, data, x, NPoints, thresh, noise, spoints, iloop2);
-      break;
-
     case HITCOUNTING: // Hit-counting method
       success = this->findThresholdHitcounting(data, x, NPoints, thresh, iloop2);
       // noise = 0;
@@ -489,76 +481,103 @@ bool ITSThresholdCalibrator::findThreshold(
 }
 
 //////////////////////////////////////////////////////////////////////////////
-// Use ROOT to find the threshold and noise via S-curve fit
-// data is the number of trigger counts per charge injected;
-// x is the array of charge injected values;
-// NPoints is the length of both arrays.
-// thresh, noise, chi2 pointers are updated with results from the fit
+// Find the threshold and noise of all pixels of the row via S-curve fit,
+// fills the per column output arrays.
+// The pixels with a S-shaped curve are fitted SCurveFitter::NLanes at a time,
+// the chunks are distributed over the threads.
 // spoints: number of points in the S of the S-curve (with n_hits between 0 and 50, excluding first and last point)
-// iloop2 is 0 for thr scan but is equal to vresetd index in 2D vresetd scan
-bool ITSThresholdCalibrator::findThresholdFit(
-  const short int& chipID, std::vector<std::vector<unsigned short int>> data, const float* x, const short int& NPoints,
-  float& thresh, float& noise, int& spoints, int iloop2)
+// scan_i is 0 for thr scan but is equal to vresetd index in 2D vresetd scan
+void ITSThresholdCalibrator::findThresholdFitRow(const short int& chipID, const short int& row, int scan_i)
 {
+  const short int NPoints = mScanType == 'r' ? N_RANGE2 : N_RANGE;
+  const bool flip = (this->mScanType == 'I');
+  const auto& rowHits = this->mPixelHits[chipID][row];
+
   // Find lower & upper values of the S-curve region
-  short int lower, upper;
-  bool flip = (this->mScanType == 'I');
-  auto fndVal = std::find(chipDumpList.begin(), chipDumpList.end(), chipID);
+  short int lower[N_COL], upper[N_COL];
+  bool isS[N_COL];
+#ifdef WITH_OPENMP
+  omp_set_num_threads(mNThreads);
+#pragma omp parallel for schedule(static)
+#endif
+  for (short int col_i = 0; col_i < this->N_COL; col_i++) {
+    isS[col_i] = this->findUpperLower(rowHits.at(col_i), NPoints, lower[col_i], upper[col_i], flip, scan_i) && lower[col_i] != upper[col_i] &&
+                 (this->mX[upper[col_i]] + this->mX[lower[col_i]]) / 2 >= 0;
+  }
 
-  if (!this->findUpperLower(data, NPoints, lower, upper, flip, iloop2) || lower == upper) {
-    if (this->mVerboseOutput) {
+  // Copy the counts of the selected pixels next to each other
+  mFitColumns.clear();
+  for (short int col_i = 0; col_i < this->N_COL; col_i++) {
+    if (isS[col_i]) {
+      mFitColumns.push_back(col_i);
+    } else if (this->mVerboseOutput) {
       LOG(warning) << "Start-finding unsuccessful: (lower, upper) = ("
-                   << lower << ", " << upper << ")";
-    }
-
-    if (isDumpS && (dumpCounterS[chipID] < maxDumpS || maxDumpS < 0) && (fndVal != chipDumpList.end() || !chipDumpList.size())) { // save bad s-curves
-      for (int i = 0; i < NPoints; i++) {
-        this->mFitHist->SetBinContent(i + 1, mScanType != 'r' ? data[iloop2][i] : data[i][iloop2]);
-      }
-      fileDumpS->cd();
-      mFitHist->Write();
-    }
-    if (isDumpS) {
-      dumpCounterS[chipID]++;
+                   << lower[col_i] << ", " << upper[col_i] << ")";
     }
-
-    return false;
   }
-  float start = (this->mX[upper] + this->mX[lower]) / 2;
-
-  if (start < 0) {
-    if (this->mVerboseOutput) {
-      LOG(warning) << "Start-finding unsuccessful: Start = " << start;
+  const int nFit = mFitColumns.size();
+  mFitCounts.resize(nFit * NPoints);
+  mFitResults.resize(nFit);
+  for (int k = 0; k < nFit; k++) {
+    const auto& data = rowHits.at(mFitColumns[k]);
+    for (int i = 0; i < NPoints; i++) {
+      mFitCounts[k * NPoints + i] = mScanType != 'r' ? data[scan_i][i] : data[i][scan_i];
     }
-    return false;
   }
 
-  for (int i = 0; i < NPoints; i++) {
-    this->mFitHist->SetBinContent(i + 1, mScanType != 'r' ? data[iloop2][i] : data[i][iloop2]);
-  }
-
-  // Initialize starting parameters
-  this->mFitFunction->SetParameter(0, start);
-  this->mFitFunction->SetParameter(1, 8);
-
-  this->mFitHist->Fit("mFitFunction", "RQL");
-  if (isDumpS && (dumpCounterS[chipID] < maxDumpS || maxDumpS < 0) && (fndVal != chipDumpList.end() || !chipDumpList.size())) { // save good s-curves
-    fileDumpS->cd();
-    mFitHist->Write();
-  }
+  constexpr int NLanes = SCurveFitter::NLanes;
+  const int nChunks = (nFit + NLanes - 1) / NLanes;
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (int chunk = 0; chunk < nChunks; chunk++) {
+    const int first = chunk * NLanes;
+    mFitter.fit(&mFitCounts[first * NPoints], std::min(NLanes, nFit - first), &mFitResults[first]);
+  }
+
+  // Fill the output, pixels without S-curve are unsuccessful
+  for (short int col_i = 0; col_i < this->N_COL; col_i++) {
+    vChipid[col_i] = chipID;
+    vRow[col_i] = row;
+    vThreshold[col_i] = 0;
+    vNoise[col_i] = 0.;
+    vSuccess[col_i] = false;
+    vPoints[col_i] = 0;
+  }
+  for (int k = 0; k < nFit; k++) {
+    const short int col_i = mFitColumns[k];
+    const auto& res = mFitResults[k];
+    const int spoints = upper[col_i] - lower[col_i] - 1;
+    vThreshold[col_i] = (mScanType == 'T' || mScanType == 'r') ? (short int)(res.threshold * 10.) : (short int)(res.threshold);
+    vNoise[col_i] = (float)(res.noise * 10.); // always factor 10 also for ITHR/VCASN to not have all zeros
+    vSuccess[col_i] = res.chi2 < 5;
+    vPoints[col_i] = spoints > 0 ? (unsigned char)(spoints) : 0;
+  }
+
+  // Save good and bad s-curves, with the fit function for the fitted ones
   if (isDumpS) {
-    dumpCounterS[chipID]++;
+    bool isChipDumped = !chipDumpList.size() || std::find(chipDumpList.begin(), chipDumpList.end(), chipID) != chipDumpList.end();
+    for (int col_i = 0, k = 0; col_i < this->N_COL; col_i++) {
+      const bool isFitted = k < nFit && mFitColumns[k] == col_i;
+      if (isChipDumped && (dumpCounterS[chipID] < maxDumpS || maxDumpS < 0)) {
+        const auto& data = rowHits.at(col_i);
+        for (int i = 0; i < NPoints; i++) {
+          this->mFitHist->SetBinContent(i + 1, mScanType != 'r' ? data[scan_i][i] : data[i][scan_i]);
+        }
+        mFitHist->SetName(Form("scurve_chip%d_row%d_col%d_scani%d", chipID, row, col_i, scan_i));
+        if (isFitted) {
+          this->mFitFunction->SetParameters(mFitResults[k].threshold, mFitResults[k].noise);
+          mFitHist->GetListOfFunctions()->Add(mFitFunction);
+        }
+        fileDumpS->cd();
+        mFitHist->Write();
+        mFitHist->GetListOfFunctions()->Remove(mFitFunction);
+        this->mFitHist->Reset();
+      }
+      dumpCounterS[chipID]++;
+      k += isFitted;
+    }
   }
-
-  noise = this->mFitFunction->GetParameter(1);
-  thresh = this->mFitFunction->GetParameter(0);
-  float chi2 = this->mFitFunction->GetChisquare() / this->mFitFunction->GetNDF();
-  spoints = upper - lower - 1;
-
-  // Clean up histogram for next time it is used
-  this->mFitHist->Reset();
-
-  return (chi2 < 5);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -568,7 +587,7 @@ bool ITSThresholdCalibrator::findThresholdFit(
 // NPoints is the length of both arrays.
 // spoints: number of points in the S of the S-curve (with n_hits between 0 and 50, excluding first and last point)
 // iloop2 is 0 for thr scan but is equal to vresetd index in 2D vresetd scan
-bool ITSThresholdCalibrator::findThresholdDerivative(std::vector<std::vector<unsigned short int>> data, const float* x, const short int& NPoints,
+bool ITSThresholdCalibrator::findThresholdDerivative(const std::vector<std::vector<unsigned short int>>& data, const float* x, const short int& NPoints,
                                                      float& thresh, float& noise, int& spoints, int iloop2)
 {
   // Find lower & upper values of the S-curve region
@@ -614,7 +633,7 @@ bool ITSThresholdCalibrator::findThresholdDerivative(std::vector<std::vector<uns
 // NPoints is the length of both arrays.
 // iloop2 is 0 for thr scan but is equal to vresetd index in 2D vresetd scan
 bool ITSThresholdCalibrator::findThresholdHitcounting(
-  std::vector<std::vector<unsigned short int>> data, const float* x, const short int& NPoints, float& thresh, int iloop2)
+  const std::vector<std::vector<unsigned short int>>& data, const float* x, const short int& NPoints, float& thresh, int iloop2)
 {
   unsigned short int numberOfHits = 0;
   bool is50 = false;
@@ -737,36 +756,36 @@ void ITSThresholdCalibrator::extractThresholdRow(const short int& chipID, const
 
     for (int scan_i = 0; scan_i < ((mScanType == 'r') ? N_RANGE : N_RANGE2); scan_i++) {
 
+      if (mFitType == FIT) {
+        this->findThresholdFitRow(chipID, row, scan_i);
+      } else {
 #ifdef WITH_OPENMP
-      omp_set_num_threads(mNThreads);
+        omp_set_num_threads(mNThreads);
 #pragma omp parallel for schedule(dynamic)
 #endif
-      // Loop over all columns (pixels) in the row
-      for (short int col_i = 0; col_i < this->N_COL; col_i++) {
-
-        // Do the threshold fit
-        float thresh = 0., noise = 0.;
-        bool success = false;
-        int spoints = 0;
-        if (isDumpS) { // already protected for multi-thread in the init
-          mFitHist->SetName(Form("scurve_chip%d_row%d_col%d_scani%d", chipID, row, col_i, scan_i));
-        }
+        // Loop over all columns (pixels) in the row
+        for (short int col_i = 0; col_i < this->N_COL; col_i++) {
 
-        success = this->findThreshold(chipID, mPixelHits[chipID][row][col_i],
-                                      this->mX, mScanType == 'r' ? N_RANGE2 : N_RANGE, thresh, noise, spoints, scan_i);
+          // Extract the threshold
+          float thresh = 0., noise = 0.;
+          bool success = false;
+          int spoints = 0;
 
-        vChipid[col_i] = chipID;
-        vRow[col_i] = row;
-        vThreshold[col_i] = (mScanType == 'T' || mScanType == 'r') ? (short int)(thresh * 10.) : (short int)(thresh);
-        vNoise[col_i] = (float)(noise * 10.); // always factor 10 also for ITHR/VCASN to not have all zeros
-        vSuccess[col_i] = success;
-        vPoints[col_i] = spoints > 0 ? (unsigned char)(spoints) : 0;
+          success = this->findThreshold(chipID, mPixelHits[chipID][row][col_i],
+                                        this->mX, mScanType == 'r' ? N_RANGE2 : N_RANGE, thresh, noise, spoints, scan_i);
 
-        if (mScanType == 'r') {
-          vMixData[col_i] = (scan_i * this->mStep) + mMin;
+          vChipid[col_i] = chipID;
+          vRow[col_i] = row;
+          vThreshold[col_i] = (mScanType == 'T' || mScanType == 'r') ? (short int)(thresh * 10.) : (short int)(thresh);
+          vNoise[col_i] = (float)(noise * 10.); // always factor 10 also for ITHR/VCASN to not have all zeros
+          vSuccess[col_i] = success;
+          vPoints[col_i] = spoints > 0 ? (unsigned char)(spoints) : 0;
         }
       }
       if (mScanType == 'r') {
+        for (short int col_i = 0; col_i < this->N_COL; col_i++) {
+          vMixData[col_i] = (scan_i * this->mStep) + mMin;
+        }
         this->saveThreshold(); // save before moving to the next vresetd
       }
     }
@@ -1066,6 +1085,14 @@ void ITSThresholdCalibrator::setRunType(const short int& runtype)
                            : new TF1("mFitFunction", erf, (mScanType == 'T' || mScanType == 'r') ? 3 : mMin, mScanType == 'r' ? mMax2 : mMax, 2);
     this->mFitFunction->SetParName(0, "Threshold");
     this->mFitFunction->SetParName(1, "Noise");
+
+    // Same fit for the thread safe fitter, on the bin centers of the histogram
+    const int nPoints = mFitHist->GetNbinsX();
+    std::vector<float> centers(nPoints);
+    for (int i = 0; i < nPoints; i++) {
+      centers[i] = mFitHist->GetXaxis()->GetBinCenter(i + 1);
+    }
+    this->mFitter.init(centers.data(), nPoints, mFitFunction->GetXmin(), mFitFunction->GetXmax(), nInjScaled / 2, mScanType == 'I');
   }
 
   return;
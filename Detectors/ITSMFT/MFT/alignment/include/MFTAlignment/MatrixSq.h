@@ -133,6 +133,10 @@ class MatrixSq : public TMatrixDBase
 
   static Bool_t IsZero(Double_t x, Double_t thresh = 1e-64) { return x > 0 ? (x < thresh) : (x > -thresh); }
 
+  /// \brief number of threads used by the matrix-vector products and decompositions (when compiled with OpenMP)
+  static void SetNThreads(Int_t n) { fgNThreads = n > 0 ? n : 1; }
+  static Int_t GetNThreads() { return fgNThreads; }
+
  protected:
   void Swap(int& r, int& c) const
   {
@@ -144,6 +148,8 @@ class MatrixSq : public TMatrixDBase
  protected:
   Bool_t fSymmetric; ///< is the matrix symmetric? Only lower triangle is filled
 
+  static Int_t fgNThreads; ///< number of threads for the matrix operations
+
   ClassDefOverride(MatrixSq, 1);
 };
 
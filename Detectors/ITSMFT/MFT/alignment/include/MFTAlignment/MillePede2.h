@@ -197,6 +197,8 @@ class MillePede2
   static void SetMinResMaxIter(const int val = 2000) { fgMinResMaxIter = val; }
   static void SetIterSolverType(const int val = MinResSolve::kSolMinRes) { fgIterSol = val; }
   static void SetNKrylovV(const int val = 60) { fgNKrylovV = val; }
+  /// \brief number of threads for the solution of the global matrix equation
+  static void SetNThreads(const int val = 1) { MatrixSq::SetNThreads(val); }
 
   static bool GetInvChol() { return fgInvChol; }
   static int GetMinResPrecondType() { return fgMinResCondType; }
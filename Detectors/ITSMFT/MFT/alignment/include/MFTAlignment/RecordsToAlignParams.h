@@ -72,6 +72,7 @@ class RecordsToAlignParams : public Aligner
  protected:
   bool mWithControl;                                   ///< boolean to set the use of the control tree = chi2 per track filled by MillePede LocalFit()
   long mNEntriesAutoSave = 10000;                      ///< number of entries needed to cyclically call AutoSave for the output control tree
+  int mNThreads = 1;                                   ///< number of threads used by MillePede to solve the global matrix equation, from AlignConfig
   std::vector<o2::detectors::AlignParam> mAlignParams; ///< vector of alignment parameters computed by MillePede simultaneous fit
   o2::mft::MilleRecordReader* mRecordReader;           ///< utility that handles the reading of the data records used to feed MillePede solver
   bool mWithConstraintsRecReader;                      ///< boolean to set to true if one wants to also read constraints records
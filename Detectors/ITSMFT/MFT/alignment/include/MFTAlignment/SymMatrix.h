@@ -79,6 +79,8 @@ class SymMatrix : public MatrixSq
 
   /// \brief get pointer on the row
   Double_t* GetRow(Int_t r);
+  /// \brief get pointer on the existing row r < GetSize()
+  const Double_t* GetRow(Int_t r) const { return r < fNcols ? &fElems[GetIndex(r, 0)] : fElemsAdd[r - fNcols]; }
 
   /// \brief print itself
   void Print(const Option_t* option = "") const override;
@@ -12,11 +12,16 @@
 /// @file MatrixSparse.cxx
 
 #include <iomanip>
+#include <vector>
 #include <TStopwatch.h>
 
 #include "Framework/Logger.h"
 #include "MFTAlignment/MatrixSparse.h"
 
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
 using namespace o2::mft;
 
 ClassImp(MatrixSparse);
@@ -116,39 +121,66 @@ void MatrixSparse::Print(Option_t* opt) const
 //___________________________________________________________
 void MatrixSparse::MultiplyByVec(const Double_t* vecIn, Double_t* vecOut) const
 {
-  memset(vecOut, 0, GetSize() * sizeof(Double_t));
-
-  for (int rw = GetSize(); rw--;) { // loop over rows >>>
+  // For the symmetric matrix the row rw also contributes, transposed, to the other rows of vecOut:
+  // these contributions are accumulated per thread and summed at the end.
+  const int sz = GetSize();
+  const bool sym = IsSymmetric();
+#ifdef WITH_OPENMP
+  const int nThreads = fgNThreads;
+#else
+  const int nThreads = 1;
+#endif
+  std::vector<double> transp(sym ? size_t(nThreads) * sz : 0, 0.);
+
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nThreads)
+#endif
+  for (int rw = 0; rw < sz; rw++) { // loop over rows >>>
     const VectorSparse* rowV = GetRow(rw);
     Int_t nel = rowV->GetNElems();
+    double sum = 0.;
     if (!nel) {
+      vecOut[rw] = 0.;
       continue;
     }
 
     UShort_t* indV = rowV->GetIndices();
     Double_t* elmV = rowV->GetElems();
 
-    if (IsSymmetric()) {
+    if (sym) {
+#ifdef WITH_OPENMP
+      double* acc = &transp[size_t(omp_get_thread_num()) * sz];
+#else
+      double* acc = transp.data();
+#endif
       // treat diagonal term separately. If filled, it should be the last one
       if (indV[--nel] == rw) {
-        vecOut[rw] += vecIn[rw] * elmV[nel];
+        sum += vecIn[rw] * elmV[nel];
       } else {
         nel = rowV->GetNElems(); // diag elem was not filled
       }
       for (int iel = nel; iel--;) { // less element retrieval for symmetric case
         if (elmV[iel]) {
-          vecOut[rw] += vecIn[indV[iel]] * elmV[iel];
-          vecOut[indV[iel]] += vecIn[rw] * elmV[iel];
+          sum += vecIn[indV[iel]] * elmV[iel];
+          acc[indV[iel]] += vecIn[rw] * elmV[iel];
         }
       }
     } else {
       for (int iel = nel; iel--;) {
         if (elmV[iel]) {
-          vecOut[rw] += vecIn[indV[iel]] * elmV[iel];
+          sum += vecIn[indV[iel]] * elmV[iel];
         }
       }
     }
+    vecOut[rw] = sum;
   } // loop over rows <<<
+
+  for (int it = 0; sym && it < nThreads; it++) {
+    const double* acc = &transp[size_t(it) * sz];
+    for (int i = 0; i < sz; i++) {
+      vecOut[i] += acc[i];
+    }
+  }
 }
 
 //___________________________________________________________
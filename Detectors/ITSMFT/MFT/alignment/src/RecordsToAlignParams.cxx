@@ -16,6 +16,7 @@
 #include <string>
 
 #include "Framework/Logger.h"
+#include "MFTAlignment/AlignConfig.h"
 #include "MFTAlignment/AlignSensorHelper.h"
 #include "MFTAlignment/RecordsToAlignParams.h"
 
@@ -80,12 +81,15 @@ void RecordsToAlignParams::init()
                         mChi2CutNStdDev,
                         mResCut,
                         mResCutInitial);
+  mNThreads = AlignConfig::Instance().nThreads;
+  MillePede2::SetNThreads(mNThreads);
 
   LOG(info) << "-------------- RecordsToAlignParams configured with -----------------";
   LOGF(info, "Chi2CutNStdDev = %d", mChi2CutNStdDev);
   LOGF(info, "ResidualCutInitial = %.3f", mResCutInitial);
   LOGF(info, "ResidualCut = %.3f", mResCut);
   LOGF(info, "mStartFac = %.3f", mStartFac);
+  LOGF(info, "NThreads = %d", MatrixSq::GetNThreads());
   LOGF(info,
        "Allowed variation: dx = %.3f, dy = %.3f, dz = %.3f, dRz = %.4f",
        mAllowVar[0], mAllowVar[1], mAllowVar[3], mAllowVar[2]);
@@ -12,12 +12,17 @@
 /// @file SymMatrix.cxx
 
 #include <iostream>
+#include <vector>
 
 #include <TClass.h>
 #include <TMath.h>
 #include "MFTAlignment/SymMatrix.h"
 #include "Framework/Logger.h"
 
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
 using namespace o2::mft;
 
 ClassImp(SymMatrix);
@@ -218,10 +223,38 @@ void SymMatrix::Print(Option_t* option) const
 //___________________________________________________________
 void SymMatrix::MultiplyByVec(const Double_t* vecIn, Double_t* vecOut) const
 {
-  for (int i = GetSizeUsed(); i--;) {
-    vecOut[i] = 0.0;
-    for (int j = GetSizeUsed(); j--;) {
-      vecOut[i] += vecIn[j] * GetEl(i, j);
+  // The stored row i (lower triangle) gives its dot product with vecIn for vecOut[i] and, transposed,
+  // the contributions of the upper triangle to vecOut[j < i]. The latter are accumulated per thread
+  // and summed at the end, so that every element is read once and contiguously.
+  const int sz = GetSizeUsed();
+#ifdef WITH_OPENMP
+  const int nThreads = fgNThreads;
+#else
+  const int nThreads = 1;
+#endif
+  std::vector<double> upper(size_t(nThreads) * sz, 0.);
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nThreads)
+#endif
+  for (int i = 0; i < sz; i++) {
+#ifdef WITH_OPENMP
+    double* acc = &upper[size_t(omp_get_thread_num()) * sz];
+#else
+    double* acc = upper.data();
+#endif
+    const Double_t* rowi = GetRow(i);
+    const double vi = vecIn[i];
+    double sum = rowi[i] * vi;
+    for (int j = 0; j < i; j++) {
+      sum += rowi[j] * vecIn[j];
+      acc[j] += rowi[j] * vi;
+    }
+    vecOut[i] = sum;
+  }
+  for (int it = 0; it < nThreads; it++) {
+    const double* acc = &upper[size_t(it) * sz];
+    for (int i = 0; i < sz; i++) {
+      vecOut[i] += acc[i];
     }
   }
 }
@@ -265,28 +298,36 @@ SymMatrix* SymMatrix::DecomposeChol()
   }
 
   SymMatrix& mchol = *fgBuffer;
+  const int sz = GetSizeUsed();
 
-  for (int i = 0; i < GetSizeUsed(); i++) {
+  for (int i = 0; i < sz; i++) {
     Double_t* rowi = mchol.GetRow(i);
-    for (int j = i; j < GetSizeUsed(); j++) {
+    double sum = rowi[i];
+    for (int k = 0; k < i; k++) {
+      sum -= rowi[k] * rowi[k];
+    }
+    if (sum <= 0.0) { // not positive-definite
+      LOG(debug) << "The matrix is not positive definite [" << sum
+                 << "]: Choleski decomposition is not possible";
+      // Print("l");
+      return nullptr;
+    }
+    rowi[i] = TMath::Sqrt(sum);
+
+    // the elements of the column i below the diagonal are independent of each other
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static) num_threads(fgNThreads) if (sz - i > 128)
+#endif
+    for (int j = i + 1; j < sz; j++) {
       Double_t* rowj = mchol.GetRow(j);
-      double sum = rowj[i];
-      for (int k = i - 1; k >= 0; k--) {
-        if (rowi[k] && rowj[k]) {
-          sum -= rowi[k] * rowj[k];
-        }
-      }
-      if (i == j) {
-        if (sum <= 0.0) { // not positive-definite
-          LOG(debug) << "The matrix is not positive definite [" << sum
-                     << "]: Choleski decomposition is not possible";
-          // Print("l");
-          return nullptr;
-        }
-        rowi[i] = TMath::Sqrt(sum);
-      } else {
-        rowj[i] = sum / rowi[i];
+      double dot = 0.;
+#ifdef WITH_OPENMP
+#pragma omp simd reduction(+ : dot)
+#endif
+      for (int k = 0; k < i; k++) {
+        dot += rowi[k] * rowj[k];
       }
+      rowj[i] = (rowj[i] - dot) / rowi[i];
     }
   }
   return fgBuffer;
@@ -329,8 +370,13 @@ void SymMatrix::InvertChol(SymMatrix* pmchol)
     }
   }
 
-  // take product of the inverted Choleski L matrix with its transposed
-  for (int i = GetSizeUsed(); i--;) {
+  // take product of the inverted Choleski L matrix with its transposed,
+  // every i fills its own row of the result
+  const int sz = GetSizeUsed();
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 16) num_threads(fgNThreads) private(sum)
+#endif
+  for (int i = 0; i < sz; i++) {
     for (int j = i + 1; j--;) {
       sum = 0;
       for (int k = i; k < GetSizeUsed(); k++) {
@@ -0,0 +1,119 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test MFT Alignment MatrixThreads
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "MFTAlignment/MatrixSparse.h"
+#include "MFTAlignment/MillePede2.h"
+#include "MFTAlignment/SymMatrix.h"
+
+using namespace o2::mft;
+
+namespace
+{
+constexpr int Size = 500;
+constexpr int BandWidth = 40;
+constexpr int NThreads = 4;
+
+// symmetric positive-definite band matrix, as the global matrix of the MFT alignment
+template <typename M>
+void fillMatrix(M& mat)
+{
+  std::mt19937 gen(1234);
+  std::uniform_real_distribution<double> value(-1., 1.);
+  for (int i = 0; i < Size; i++) {
+    for (int j = std::max(0, i - BandWidth); j < i; j++) {
+      mat(i, j) = value(gen);
+    }
+    mat(i, i) = 2. * BandWidth + 1.;
+  }
+}
+
+std::vector<double> randomVector(unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> value(-1., 1.);
+  std::vector<double> v(Size);
+  for (auto& x : v) {
+    x = value(gen);
+  }
+  return v;
+}
+
+void checkClose(const std::vector<double>& v1, const std::vector<double>& vN)
+{
+  for (int i = 0; i < Size; i++) {
+    BOOST_CHECK_SMALL(v1[i] - vN[i], 1e-12 * (1. + std::abs(v1[i])));
+  }
+}
+
+// solution and inverse of the global matrix equation with the given number of threads
+void solve(int nThreads, std::vector<double>& sol, std::vector<double>& inv)
+{
+  MillePede2::SetNThreads(nThreads);
+  SymMatrix mat(Size);
+  fillMatrix(mat);
+  auto rhs = randomVector(42);
+  sol.resize(Size);
+  BOOST_REQUIRE(mat.SolveChol(rhs.data(), sol.data(), kTRUE));
+  inv.clear();
+  for (int i = 0; i < Size; i++) {
+    for (int j = 0; j <= i; j++) {
+      inv.push_back(mat(i, j));
+    }
+  }
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(SymMatrixSolveThreads_test)
+{
+  std::vector<double> sol1, inv1, solN, invN;
+  solve(1, sol1, inv1);
+  solve(NThreads, solN, invN);
+  BOOST_CHECK_EQUAL(MatrixSq::GetNThreads(), NThreads);
+  checkClose(sol1, solN);
+  BOOST_REQUIRE_EQUAL(inv1.size(), invN.size());
+  for (size_t i = 0; i < inv1.size(); i++) {
+    BOOST_CHECK_SMALL(inv1[i] - invN[i], 1e-12 * (1. + std::abs(inv1[i])));
+  }
+  MillePede2::SetNThreads(1);
+}
+
+BOOST_AUTO_TEST_CASE(MultiplyByVecThreads_test)
+{
+  SymMatrix sym(Size);
+  fillMatrix(sym);
+  MatrixSparse sparse(Size);
+  sparse.SetSymmetric(kTRUE);
+  fillMatrix(sparse);
+  auto vin = randomVector(7);
+
+  std::vector<double> sym1(Size), symN(Size), sparse1(Size), sparseN(Size);
+  MillePede2::SetNThreads(1);
+  sym.MultiplyByVec(vin.data(), sym1.data());
+  sparse.MultiplyByVec(vin.data(), sparse1.data());
+  MillePede2::SetNThreads(NThreads);
+  sym.MultiplyByVec(vin.data(), symN.data());
+  sparse.MultiplyByVec(vin.data(), sparseN.data());
+  MillePede2::SetNThreads(1);
+
+  checkClose(sym1, symN);
+  checkClose(sparse1, sparseN);
+  // both storages describe the same matrix
+  checkClose(sym1, sparse1);
+}
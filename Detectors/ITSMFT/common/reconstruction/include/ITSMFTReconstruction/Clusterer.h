@@ -257,6 +257,7 @@ class Clusterer
 
   TStopwatch mTimer;
   TStopwatch mTimerMerge;
+  size_t mNClusTimed = 0; ///< number of clusters produced while mTimer was running
 };
 
 template <typename VCLUS, typename VPAT>
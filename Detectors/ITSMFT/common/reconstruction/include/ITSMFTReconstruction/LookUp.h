@@ -17,12 +17,17 @@
 /// Short LookUp descritpion
 ///
 /// This class is for the association of the cluster topology with the corresponding
-/// entry in the dictionary
+/// entry in the dictionary.
+/// When the dictionary is loaded, its maps are flattened to an open addressing table for the common
+/// topologies and to a direct-indexed table for the groups of rare topologies, so that the look-up
+/// of a cluster touches only a couple of contiguous cache lines.
 ///
 
 #ifndef ALICEO2_ITSMFT_LOOKUP_H
 #define ALICEO2_ITSMFT_LOOKUP_H
 #include <array>
+#include <utility>
+#include <vector>
 #include "DataFormatsITSMFT/ClusterTopology.h"
 #include "DataFormatsITSMFT/TopologyDictionary.h"
 
@@ -46,11 +51,64 @@ class LookUp
   auto getDictionaty() const { return mDictionary; }
 
  private:
+  static constexpr unsigned long HashMultiplier = 0x9e3779b97f4a7c15UL; ///< Fibonacci hashing, spreads also the pattern bits in the low word of the topology hash
+
+  void buildLookUpTables();
+  size_t getCommonSlot(unsigned long hash) const { return (hash * HashMultiplier) >> mCommonTableShift; }
+  int findCommonTopology(unsigned long hash) const;
+  int findGroup(int nRow, int nCol) const;
+
   TopologyDictionary mDictionary;
   int mTopologiesOverThreshold;
 
+  std::vector<std::pair<unsigned long, int>> mCommonTable;          //! pairs <hash, position in the dictionary> of the common topologies, linear probing, empty slots have position -1
+  int mCommonTableShift = 63;                                       //! 64 - log2 of the size of mCommonTable
+  std::array<int, TopologyDictionary::NumberOfRareGroups> mGroupTable; //! position in the dictionary of the groups of rare topologies, -1 if absent
+  bool mHasGroups = false;                                          //! dictionary contains groups of rare topologies
+
   ClassDefNV(LookUp, 3);
 };
+
+inline int LookUp::findCommonTopology(unsigned long hash) const
+{
+  const size_t mask = mCommonTable.size() - 1;
+  for (size_t slot = getCommonSlot(hash);; slot = (slot + 1) & mask) {
+    const auto& entry = mCommonTable[slot];
+    if (entry.first == hash && entry.second >= 0) {
+      return entry.second;
+    }
+    if (entry.second < 0) {
+      return -1;
+    }
+  }
+}
+
+inline int LookUp::findGroup(int nRow, int nCol) const
+{
+  if (!mHasGroups) {
+    return CompCluster::InvalidPatternID;
+  }
+  int index = groupFinder(nRow, nCol);
+  int id = (index >= 0 && index < TopologyDictionary::NumberOfRareGroups) ? mGroupTable[index] : -1;
+  return id < 0 ? CompCluster::InvalidPatternID : id;
+}
+
+inline int LookUp::findGroupID(int nRow, int nCol, const unsigned char patt[ClusterPattern::MaxPatternBytes]) const
+{
+  int nBits = nRow * nCol;
+  if (nBits < 9) { // Small unique topology
+    int ID = mDictionary.mSmallTopologiesLUT[(nCol - 1) * 255 + (int)patt[0]];
+    if (ID >= 0) {
+      return ID;
+    }
+  } else { // Big unique topology
+    int ID = findCommonTopology(ClusterTopology::getCompleteHash(nRow, nCol, patt));
+    if (ID >= 0) {
+      return ID;
+    }
+  }
+  return findGroup(nRow, nCol); // rare valid topology group
+}
 } // namespace itsmft
 } // namespace o2
 
@@ -30,6 +30,7 @@ void Clusterer::process(int nThreads, PixelReader& reader, CompClusCont* compClu
 {
 #ifdef _PERFORM_TIMING_
   mTimer.Start(kFALSE);
+  size_t nClusStart = compClus->size();
 #endif
   if (nThreads < 1) {
     nThreads = 1;
@@ -164,6 +165,7 @@ void Clusterer::process(int nThreads, PixelReader& reader, CompClusCont* compClu
   reader.setDecodeNextAuto(autoDecode); // restore setting
 #ifdef _PERFORM_TIMING_
   mTimer.Stop();
+  mNClusTimed += compClus->size() - nClusStart;
 #endif
 }
 
@@ -440,6 +442,7 @@ void Clusterer::clear()
 {
   // reset
 #ifdef _PERFORM_TIMING_
+  mNClusTimed = 0;
   mTimer.Stop();
   mTimer.Reset();
   mTimerMerge.Stop();
@@ -459,7 +462,8 @@ void Clusterer::print() const
   auto& tmr = const_cast<TStopwatch&>(mTimer); // ugly but this is what root does internally
   auto& tmrm = const_cast<TStopwatch&>(mTimerMerge);
   LOG(info) << "Inclusive clusterization timing (w/o disk IO): Cpu: " << tmr.CpuTime()
-            << " Real: " << tmr.RealTime() << " s in " << tmr.Counter() << " slots";
+            << " Real: " << tmr.RealTime() << " s in " << tmr.Counter() << " slots, "
+            << (tmr.RealTime() > 0 ? mNClusTimed / tmr.RealTime() : 0.) << " clusters/s";
   LOG(info) << "Threads output merging timing                : Cpu: " << tmrm.CpuTime()
             << " Real: " << tmrm.RealTime() << " s in " << tmrm.Counter() << " slots";
 
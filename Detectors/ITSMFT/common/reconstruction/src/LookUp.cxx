@@ -26,7 +26,10 @@ namespace o2
 namespace itsmft
 {
 
-LookUp::LookUp() : mDictionary{}, mTopologiesOverThreshold{0} {}
+LookUp::LookUp() : mDictionary{}, mTopologiesOverThreshold{0}
+{
+  buildLookUpTables();
+}
 
 LookUp::LookUp(std::string fileName)
 {
@@ -37,6 +40,7 @@ void LookUp::loadDictionary(std::string fileName)
 {
   mDictionary.readFromFile(fileName);
   mTopologiesOverThreshold = mDictionary.mCommonMap.size();
+  buildLookUpTables();
 }
 
 void LookUp::setDictionary(const TopologyDictionary* dict)
@@ -45,6 +49,33 @@ void LookUp::setDictionary(const TopologyDictionary* dict)
     mDictionary = *dict;
   }
   mTopologiesOverThreshold = mDictionary.mCommonMap.size();
+  buildLookUpTables();
+}
+
+void LookUp::buildLookUpTables()
+{
+  // keep the load factor below 1/2, so that the probing sequences stay short
+  size_t size = 16;
+  mCommonTableShift = 60;
+  while (size < 2 * mDictionary.mCommonMap.size()) {
+    size <<= 1;
+    mCommonTableShift--;
+  }
+  mCommonTable.assign(size, {0, -1});
+  for (const auto& [hash, id] : mDictionary.mCommonMap) {
+    size_t slot = getCommonSlot(hash);
+    while (mCommonTable[slot].second >= 0) {
+      slot = (slot + 1) & (size - 1);
+    }
+    mCommonTable[slot] = {hash, id};
+  }
+  mGroupTable.fill(-1);
+  for (const auto& [group, id] : mDictionary.mGroupMap) {
+    if (group >= 0 && group < TopologyDictionary::NumberOfRareGroups) {
+      mGroupTable[group] = id;
+    }
+  }
+  mHasGroups = !mDictionary.mGroupMap.empty();
 }
 
 int LookUp::groupFinder(int nRow, int nCol)
@@ -66,28 +97,5 @@ int LookUp::groupFinder(int nRow, int nCol)
   return grNum;
 }
 
-int LookUp::findGroupID(int nRow, int nCol, const unsigned char patt[ClusterPattern::MaxPatternBytes]) const
-{
-  int nBits = nRow * nCol;
-  if (nBits < 9) { // Small unique topology
-    int ID = mDictionary.mSmallTopologiesLUT[(nCol - 1) * 255 + (int)patt[0]];
-    if (ID >= 0) {
-      return ID;
-    }
-  } else { // Big unique topology
-    unsigned long hash = ClusterTopology::getCompleteHash(nRow, nCol, patt);
-    auto ret = mDictionary.mCommonMap.find(hash);
-    if (ret != mDictionary.mCommonMap.end()) {
-      return ret->second;
-    }
-  }
-  if (!mDictionary.mGroupMap.empty()) { // rare valid topology group
-    int index = groupFinder(nRow, nCol);
-    auto res = mDictionary.mGroupMap.find(index);
-    return res == mDictionary.mGroupMap.end() ? CompCluster::InvalidPatternID : res->second;
-  }
-  return CompCluster::InvalidPatternID;
-}
-
 } // namespace itsmft
 } // namespace o2
@@ -0,0 +1,142 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test ITSMFT LookUp
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <array>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "DataFormatsITSMFT/CompCluster.h"
+#include "ITSMFTReconstruction/BuildTopologyDictionary.h"
+#include "ITSMFTReconstruction/LookUp.h"
+
+using namespace o2::itsmft;
+
+namespace
+{
+using Pattern = std::array<unsigned char, ClusterPattern::kExtendedPatternBytes>;
+
+// random topology with at most 12x12 pixels
+Pattern randomPattern(std::mt19937& gen)
+{
+  std::uniform_int_distribution<int> span(1, 12), byte(0, 255);
+  Pattern patt{};
+  int nRow = span(gen), nCol = span(gen), nBits = nRow * nCol;
+  patt[0] = nRow;
+  patt[1] = nCol;
+  for (int i = 0; i < (nBits + 7) / 8; i++) {
+    patt[2 + i] = byte(gen);
+  }
+  if (nBits % 8) {
+    patt[2 + nBits / 8] &= 0xff << (8 - nBits % 8);
+  }
+  // fire the first and the last pixel, so that the pattern fills its bounding box
+  patt[2] |= 0x80;
+  patt[2 + (nBits - 1) / 8] |= 0x80 >> ((nBits - 1) % 8);
+  return patt;
+}
+
+// the look-up through the maps of the dictionary, as done before the flat tables
+struct MapLookUp {
+  std::unordered_map<unsigned long, int> commonMap;
+  std::unordered_map<int, int> groupMap;
+
+  MapLookUp(const TopologyDictionary& dict)
+  {
+    for (int id = 0; id < dict.getSize(); id++) {
+      if (dict.isGroup(id)) {
+        groupMap[dict.getHash(id) >> 32] = id;
+      } else {
+        commonMap[dict.getHash(id)] = id;
+      }
+    }
+  }
+
+  int findGroupID(int nRow, int nCol, const unsigned char patt[ClusterPattern::MaxPatternBytes]) const
+  {
+    auto ret = commonMap.find(ClusterTopology::getCompleteHash(nRow, nCol, patt));
+    if (ret != commonMap.end()) {
+      return ret->second;
+    }
+    if (!groupMap.empty()) {
+      auto res = groupMap.find(LookUp::groupFinder(nRow, nCol));
+      return res == groupMap.end() ? CompCluster::InvalidPatternID : res->second;
+    }
+    return CompCluster::InvalidPatternID;
+  }
+};
+} // namespace
+
+BOOST_AUTO_TEST_CASE(LookUpFlatTables_test)
+{
+  std::mt19937 gen(1234);
+  std::vector<Pattern> patterns;
+  std::unordered_set<unsigned long> hashes;
+  while (patterns.size() < 3000) {
+    auto patt = randomPattern(gen);
+    if (hashes.insert(ClusterTopology::getCompleteHash(patt[0], patt[1], patt.data() + 2)).second) {
+      patterns.push_back(patt);
+    }
+  }
+  // a steeply falling frequency, so that the dictionary has both common topologies and groups
+  BuildTopologyDictionary builder;
+  for (size_t k = 0; k < patterns.size(); k++) {
+    ClusterTopology topology(patterns[k][0], patterns[k][1], patterns[k].data() + 2);
+    for (size_t n = 0; n < 1 + 1000 / (k + 1); n++) {
+      builder.accountTopology(topology);
+    }
+  }
+  builder.setThreshold(2.5 / builder.getTotClusters());
+  builder.groupRareTopologies();
+  const auto dict = builder.getDictionary();
+
+  LookUp lookUp;
+  lookUp.setDictionary(&dict);
+  MapLookUp reference(dict);
+  BOOST_REQUIRE(!reference.commonMap.empty());
+  BOOST_REQUIRE(!reference.groupMap.empty());
+
+  // every common topology of the dictionary is found at its own position
+  for (int id = 0; id < dict.getSize(); id++) {
+    if (dict.isGroup(id)) {
+      continue;
+    }
+    const auto& patt = dict.getPattern(id);
+    auto found = lookUp.findGroupID(patt.getRowSpan(), patt.getColumnSpan(), patt.getPattern().data() + 2);
+    BOOST_CHECK_EQUAL(found, id);
+    BOOST_CHECK_EQUAL(found, reference.findGroupID(patt.getRowSpan(), patt.getColumnSpan(), patt.getPattern().data() + 2));
+  }
+  // the rare topologies which were accounted end up in their group
+  int nInGroups = 0;
+  for (const auto& patt : patterns) {
+    auto found = lookUp.findGroupID(patt[0], patt[1], patt.data() + 2);
+    BOOST_CHECK_EQUAL(found, reference.findGroupID(patt[0], patt[1], patt.data() + 2));
+    nInGroups += dict.isGroup(found);
+  }
+  BOOST_CHECK(nInGroups > 0);
+  // topologies which are not in the dictionary fall back to the groups as well
+  for (int i = 0; i < 10000; i++) {
+    auto patt = randomPattern(gen);
+    auto found = lookUp.findGroupID(patt[0], patt[1], patt.data() + 2);
+    BOOST_CHECK_EQUAL(found, reference.findGroupID(patt[0], patt[1], patt.data() + 2));
+  }
+
+  // without groups, the topologies which are not common are invalid
+  LookUp emptyLookUp;
+  for (const auto& patt : patterns) {
+    BOOST_CHECK_EQUAL(emptyLookUp.findGroupID(patt[0], patt[1], patt.data() + 2), CompCluster::InvalidPatternID);
+  }
+}
@@ -89,6 +89,16 @@ class TrackExtrap
   static void addMCSEffect(TrackParam& trackParam, double dZ, double x0);
 
   static void printNCalls();
+  /// return the number of times the method extrapToZCov(...) is called in this thread
+  static std::size_t getNCallExtrapToZCov() { return sNCallExtrapToZCov; }
+  /// return the number of times the method Field(...) is called in this thread
+  static std::size_t getNCallField() { return sNCallField; }
+  /// add calls made in other threads to the counters of this thread
+  static void addNCalls(std::size_t nCallExtrapToZCov, std::size_t nCallField)
+  {
+    sNCallExtrapToZCov += nCallExtrapToZCov;
+    sNCallField += nCallField;
+  }
 
  private:
   static bool extrapToVertex(TrackParam& trackParam, double xVtx, double yVtx, double zVtx,
@@ -140,8 +150,8 @@ class TrackExtrap
   static double sSimpleBValue; ///< Magnetic field value at the centre
   static bool sFieldON;        ///< true if the field is switched ON
 
-  static std::size_t sNCallExtrapToZCov; ///< number of times the method extrapToZCov(...) is called
-  static std::size_t sNCallField;        ///< number of times the method Field(...) is called
+  static thread_local std::size_t sNCallExtrapToZCov; ///< number of times the method extrapToZCov(...) is called
+  static thread_local std::size_t sNCallField;        ///< number of times the method Field(...) is called
 };
 
 } // namespace mch
@@ -22,6 +22,7 @@
 #include <unordered_set>
 #include <list>
 #include <array>
+#include <memory>
 #include <vector>
 #include <utility>
 
@@ -60,6 +61,9 @@ class TrackFinder
   /// set the debug level defining the verbosity
   void debug(int debugLevel) { mDebugLevel = debugLevel; }
 
+  /// set the number of threads used to follow the track candidates, to be called before init()
+  void setNThreads(int n);
+
   void printStats() const;
   void printTimers() const;
 
@@ -70,6 +74,7 @@ class TrackFinder
   void findTrackCandidatesInSt5();
   void findTrackCandidatesInSt4();
   void findMoreTrackCandidates();
+  void followTracksInParallel();
   std::list<Track>::iterator findTrackCandidates(int plane1, int plane2, bool skipUsedPairs, const std::list<Track>::iterator& itFirstTrack);
 
   std::list<Track>::iterator followTrackInOverlapDE(const std::list<Track>::iterator& itTrack, int currentDE, int plane);
@@ -157,6 +162,10 @@ class TrackFinder
 
   int mDebugLevel = 0; ///< debug level defining the verbosity
 
+  int mNThreads = 1;                                    ///< number of OMP threads
+  std::vector<std::unique_ptr<TrackFinder>> mWorkers{}; ///< finders used by each thread to follow the candidates
+  int mMaxNTracksAtAdd = -1;                            ///< largest number of tracks in the list when adding a new one
+
   std::size_t mNCandidates = 0;            ///< counter
   std::size_t mNCallTryOneCluster = 0;     ///< counter
   std::size_t mNCallTryOneClusterFast = 0; ///< counter
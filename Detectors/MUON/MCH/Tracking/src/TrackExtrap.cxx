@@ -35,8 +35,8 @@ namespace mch
 bool TrackExtrap::sExtrapV2 = false;
 double TrackExtrap::sSimpleBValue = 0.;
 bool TrackExtrap::sFieldON = false;
-std::size_t TrackExtrap::sNCallExtrapToZCov = 0;
-std::size_t TrackExtrap::sNCallField = 0;
+thread_local std::size_t TrackExtrap::sNCallExtrapToZCov = 0;
+thread_local std::size_t TrackExtrap::sNCallField = 0;
 
 //__________________________________________________________________________
 void TrackExtrap::setField()
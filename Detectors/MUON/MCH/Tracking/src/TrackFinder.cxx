@@ -16,10 +16,14 @@
 
 #include "MCHTracking/TrackFinder.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
+#include <exception>
 #include <iostream>
 #include <stdexcept>
+#include <string>
 
 #include <TGeoGlobalMagField.h>
 #include <TMatrixD.h>
@@ -30,6 +34,10 @@
 #include "MCHBase/TrackerParam.h"
 #include "MCHTracking/TrackExtrap.h"
 
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
 namespace o2
 {
 namespace mch
@@ -136,6 +144,27 @@ void TrackFinder::init()
     mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 17, nullptr);
     mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 19, nullptr);
   }
+
+  // prepare one finder per thread to follow the track candidates in parallel
+  mWorkers.clear();
+  if (mNThreads > 1) {
+    for (int i = 0; i < mNThreads; ++i) {
+      auto& worker = mWorkers.emplace_back(std::make_unique<TrackFinder>());
+      worker->init();
+    }
+  }
+}
+
+//_________________________________________________________________________________________________
+void TrackFinder::setNThreads(int n)
+{
+  /// set the number of threads used to follow the track candidates
+#ifdef WITH_OPENMP
+  mNThreads = n > 0 ? n : 1;
+#else
+  LOG(warning) << "Multithreading is not supported, imposing single thread";
+  mNThreads = 1;
+#endif
 }
 
 //_________________________________________________________________________________________________
@@ -198,11 +227,15 @@ const std::list<Track>& TrackFinder::findTracks(const std::unordered_map<int, st
 
     // track each candidate down to chamber 1 and remove it
     tStart = std::chrono::high_resolution_clock::now();
-    for (auto itTrack = mTracks.begin(); itTrack != mTracks.end();) {
-      std::unordered_map<int, std::unordered_set<uint32_t>> excludedClusters{};
-      followTrackInChamber(itTrack, 5, 0, false, excludedClusters);
-      print("findTracks: removing candidate at position #", getTrackIndex(itTrack));
-      itTrack = mTracks.erase(itTrack);
+    if (mWorkers.empty() || mDebugLevel > 0) {
+      for (auto itTrack = mTracks.begin(); itTrack != mTracks.end();) {
+        std::unordered_map<int, std::unordered_set<uint32_t>> excludedClusters{};
+        followTrackInChamber(itTrack, 5, 0, false, excludedClusters);
+        print("findTracks: removing candidate at position #", getTrackIndex(itTrack));
+        itTrack = mTracks.erase(itTrack);
+      }
+    } else {
+      followTracksInParallel();
     }
     tEnd = std::chrono::high_resolution_clock::now();
     mTimeFollowTracks += tEnd - tStart;
@@ -1171,6 +1204,116 @@ std::list<Track>::iterator TrackFinder::addClustersAndFollowTrack(std::list<Trac
   return itFirstNewTrack;
 }
 
+//_________________________________________________________________________________________________
+void TrackFinder::followTracksInParallel()
+{
+  /// Track each candidate down to chamber 1 and remove it, as in the serial tracking, but several candidates at a time.
+  /// Every thread follows its candidates with its own finder, sharing the clusters, and the tracks found from each
+  /// candidate are put back in the order of the candidates, so that the result does not depend on the number of threads
+  /// Throw an exception in the same conditions as the serial tracking
+
+  struct FollowResult {
+    std::list<Track> tracks{};         // candidate, then tracks found from it
+    int maxNTracksAtAdd = -1;          // largest number of tracks in the list of the worker when adding a new one
+    std::exception_ptr error{};        // exception thrown while following the candidate
+    ErrorMap errors{};                 // errors encountered while following the candidate
+    std::size_t nCallExtrapToZCov = 0; // calls made outside of the calling thread
+    std::size_t nCallField = 0;        // calls made outside of the calling thread
+  };
+
+  // move each candidate in its own list
+  std::vector<FollowResult> results(mTracks.size());
+  for (auto& result : results) {
+    result.tracks.splice(result.tracks.end(), mTracks, mTracks.begin());
+  }
+
+  for (auto& worker : mWorkers) {
+    for (int iPlane = 0; iPlane < 32; ++iPlane) {
+      for (std::size_t iDE = 0; iDE < mClusters[iPlane].size(); ++iDE) {
+        worker->mClusters[iPlane][iDE].second = mClusters[iPlane][iDE].second;
+      }
+    }
+    worker->mStartTime = mStartTime;
+    worker->mTrackFitter.useChamberResolution();
+  }
+
+  // skip the candidates after the first one that fails, the tracking is aborted anyway
+  const int nCandidates = results.size();
+  std::atomic<int> firstFailure{nCandidates};
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+  for (int iCandidate = 0; iCandidate < nCandidates; ++iCandidate) {
+    if (iCandidate > firstFailure) {
+      continue;
+    }
+#ifdef WITH_OPENMP
+    int iThread = omp_get_thread_num();
+#else
+    int iThread = 0;
+#endif
+    auto& worker = *mWorkers[iThread];
+    auto& result = results[iCandidate];
+    auto nCallExtrapToZCov = TrackExtrap::getNCallExtrapToZCov();
+    auto nCallField = TrackExtrap::getNCallField();
+    worker.mTracks.swap(result.tracks);
+    worker.mMaxNTracksAtAdd = -1;
+    worker.mErrorMap.clear();
+    try {
+      auto itTrack = worker.mTracks.begin();
+      std::unordered_map<int, std::unordered_set<uint32_t>> excludedClusters{};
+      worker.followTrackInChamber(itTrack, 5, 0, false, excludedClusters);
+      worker.mTracks.erase(itTrack);
+    } catch (...) {
+      result.error = std::current_exception();
+      result.errors.add(worker.mErrorMap);
+      int first = firstFailure;
+      while (iCandidate < first && !firstFailure.compare_exchange_weak(first, iCandidate)) {
+      }
+    }
+    worker.mTracks.swap(result.tracks);
+    result.maxNTracksAtAdd = worker.mMaxNTracksAtAdd;
+    if (iThread != 0) { // the calls made in the calling thread are already counted
+      result.nCallExtrapToZCov = TrackExtrap::getNCallExtrapToZCov() - nCallExtrapToZCov;
+      result.nCallField = TrackExtrap::getNCallField() - nCallField;
+    }
+  }
+
+  for (auto& worker : mWorkers) {
+    mNCallTryOneCluster += worker->mNCallTryOneCluster;
+    mNCallTryOneClusterFast += worker->mNCallTryOneClusterFast;
+    worker->mNCallTryOneCluster = 0;
+    worker->mNCallTryOneClusterFast = 0;
+  }
+  for (const auto& result : results) {
+    TrackExtrap::addNCalls(result.nCallExtrapToZCov, result.nCallField);
+  }
+
+  // check the results in the order of the serial tracking, in which the list contains the tracks found from the
+  // previous candidates and the next candidates in addition to the ones of the worker when adding a new track
+  const auto maxCandidates = TrackerParam::Instance().maxCandidates;
+  std::size_t nTracks = 0;
+  for (int iCandidate = 0; iCandidate < nCandidates; ++iCandidate) {
+    auto& result = results[iCandidate];
+    if (result.error) {
+      mErrorMap.add(result.errors);
+      std::rethrow_exception(result.error);
+    }
+    if (result.maxNTracksAtAdd >= 0) {
+      std::size_t nTracksAtAdd = nTracks + result.maxNTracksAtAdd + (nCandidates - iCandidate - 1);
+      if (nTracksAtAdd >= maxCandidates) {
+        mErrorMap.add(ErrorType::Tracking_TooManyCandidates, 0, 0);
+        throw length_error(string("Too many track candidates (") + std::to_string(nTracksAtAdd) + ")");
+      }
+    }
+    nTracks += result.tracks.size();
+  }
+
+  for (auto& result : results) {
+    mTracks.splice(mTracks.end(), result.tracks);
+  }
+}
+
 //_________________________________________________________________________________________________
 void TrackFinder::improveTracks()
 {
@@ -1383,6 +1526,7 @@ std::list<Track>::iterator TrackFinder::addTrack(const std::list<Track>::iterato
     mErrorMap.add(ErrorType::Tracking_TooManyCandidates, 0, 0);
     throw length_error(string("Too many track candidates (") + mTracks.size() + ")");
   }
+  mMaxNTracksAtAdd = std::max(mMaxNTracksAtAdd, static_cast<int>(mTracks.size()));
   return mTracks.emplace(pos, track);
 }
 
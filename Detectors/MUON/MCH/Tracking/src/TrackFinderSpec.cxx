@@ -16,12 +16,14 @@
 
 #include "MCHTracking/TrackFinderSpec.h"
 
+#include <algorithm>
 #include <chrono>
 #include <filesystem>
 #include <list>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 
 #include <gsl/span>
@@ -95,6 +97,9 @@ class TrackFinderTask
     if (!config.empty()) {
       o2::conf::ConfigurableParam::updateFromFile(config, "MCHTracking", true);
     }
+    if constexpr (std::is_same_v<T, TrackFinder>) {
+      mTrackFinder.setNThreads(std::max(1, ic.options().get<int>("nthreads")));
+    }
     mTrackFinder.init();
 
     auto debugLevel = ic.options().get<int>("mch-debug");
@@ -316,7 +321,8 @@ o2::framework::DataProcessorSpec getTrackFinderSpec(const char* specName, bool c
             {"dipoleCurrent", VariantType::Float, -6000.0f, {"Dipole current"}},
             {"grp-file", VariantType::String, o2::base::NameConf::getGRPFileName(), {"Name of the grp file"}},
             {"mch-config", VariantType::String, "", {"JSON or INI file with tracking parameters"}},
-            {"mch-debug", VariantType::Int, 0, {"debug level"}}}};
+            {"mch-debug", VariantType::Int, 0, {"debug level"}},
+            {"nthreads", VariantType::Int, 1, {"number of threads to follow the track candidates (new algorithm only)"}}}};
 }
 
 } // namespace mch
@@ -0,0 +1,158 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file track-finder-benchmark.cxx
+/// \brief Duration of the track finding for recorded clusters, serial and with several threads.
+///        The tracks found in parallel are compared with the serial ones.
+///
+/// The input file has the format read by o2-mch-clusters-sampler-workflow, with the clusters in the global frame.
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "CommonUtils/ConfigurableParam.h"
+#include "DataFormatsMCH/Cluster.h"
+#include "DataFormatsMCH/Digit.h"
+#include "Framework/Logger.h"
+#include "MCHTracking/Track.h"
+#include "MCHTracking/TrackFinder.h"
+
+namespace po = boost::program_options;
+using namespace o2::mch;
+
+/// read the clusters of the next event, return false at the end of the file
+bool readOneEvent(std::ifstream& inFile, std::vector<Cluster>& clusters)
+{
+  int nClusters(-1);
+  int nDigits(-1);
+  inFile.read(reinterpret_cast<char*>(&nClusters), sizeof(int));
+  if (inFile.eof()) {
+    return false;
+  }
+  inFile.read(reinterpret_cast<char*>(&nDigits), sizeof(int));
+  if (inFile.fail() || nClusters < 0 || nDigits < 0) {
+    throw std::length_error("invalid input");
+  }
+  clusters.resize(nClusters);
+  inFile.read(reinterpret_cast<char*>(clusters.data()), nClusters * sizeof(Cluster));
+  inFile.seekg(nDigits * sizeof(Digit), std::ios::cur);
+  if (inFile.fail()) {
+    throw std::length_error("invalid input");
+  }
+  return true;
+}
+
+/// check that the two lists contain the same tracks, with the same clusters and parameters, in the same order
+bool areIdentical(const std::list<Track>& tracks1, const std::list<Track>& tracks2)
+{
+  if (tracks1.size() != tracks2.size()) {
+    return false;
+  }
+  for (auto itTrack1 = tracks1.begin(), itTrack2 = tracks2.begin(); itTrack1 != tracks1.end(); ++itTrack1, ++itTrack2) {
+    if (itTrack1->getNClusters() != itTrack2->getNClusters()) {
+      return false;
+    }
+    for (auto itParam1 = itTrack1->begin(), itParam2 = itTrack2->begin(); itParam1 != itTrack1->end(); ++itParam1, ++itParam2) {
+      if (itParam1->getClusterPtr() != itParam2->getClusterPtr() || itParam1->getTrackChi2() != itParam2->getTrackChi2() ||
+          !(itParam1->getParameters() == itParam2->getParameters())) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  po::options_description generic("options");
+  po::variables_map vm;
+
+  // clang-format off
+  generic.add_options()
+      ("help,h", "produce help message")
+      ("infile,i", po::value<std::string>()->required(), "input file with the clusters")
+      ("nthreads,n", po::value<int>()->default_value(8), "number of threads of the parallel track finding")
+      ("max-events,e", po::value<int>()->default_value(-1), "maximum number of events to process (-1 = all)")
+      ("l3Current", po::value<float>()->default_value(-30000.f), "L3 current")
+      ("dipoleCurrent", po::value<float>()->default_value(-6000.f), "dipole current")
+      ("configKeyValues", po::value<std::string>()->default_value(""), "tracking parameters, e.g. \"MCHTracking.moreCandidates=true\"");
+  // clang-format on
+
+  po::store(po::command_line_parser(argc, argv).options(generic).run(), vm);
+
+  if (vm.count("help")) {
+    std::cout << generic << "\n";
+    return 2;
+  }
+
+  try {
+    po::notify(vm);
+  } catch (boost::program_options::error& e) {
+    std::cout << "Error: " << e.what() << "\n";
+    return 1;
+  }
+
+  std::ifstream inFile(vm["infile"].as<std::string>(), std::ios::binary);
+  if (!inFile.is_open()) {
+    LOGP(fatal, "could not open input file {}", vm["infile"].as<std::string>());
+    return 1;
+  }
+
+  o2::conf::ConfigurableParam::updateFromString(vm["configKeyValues"].as<std::string>());
+
+  TrackFinder serial{};
+  TrackFinder parallel{};
+  serial.initField(vm["l3Current"].as<float>(), vm["dipoleCurrent"].as<float>());
+  serial.init();
+  parallel.setNThreads(vm["nthreads"].as<int>());
+  parallel.init();
+
+  const int maxEvents = vm["max-events"].as<int>();
+  std::chrono::duration<double> timeSerial{};
+  std::chrono::duration<double> timeParallel{};
+  std::size_t nClusters = 0;
+  std::size_t nTracks = 0;
+  int nEvents = 0;
+  int nDifferent = 0;
+  std::vector<Cluster> clusters{};
+  while ((maxEvents < 0 || nEvents < maxEvents) && readOneEvent(inFile, clusters)) {
+    auto tStart = std::chrono::high_resolution_clock::now();
+    const auto& tracksSerial = serial.findTracks(clusters);
+    auto tMid = std::chrono::high_resolution_clock::now();
+    const auto& tracksParallel = parallel.findTracks(clusters);
+    auto tEnd = std::chrono::high_resolution_clock::now();
+    timeSerial += tMid - tStart;
+    timeParallel += tEnd - tMid;
+    if (!areIdentical(tracksSerial, tracksParallel)) {
+      LOGP(error, "event {}: tracks differ ({} serial vs {} parallel)", nEvents, tracksSerial.size(), tracksParallel.size());
+      ++nDifferent;
+    }
+    nClusters += clusters.size();
+    nTracks += tracksSerial.size();
+    ++nEvents;
+  }
+
+  LOGP(info, "{} events with {} clusters, {} tracks", nEvents, nClusters, nTracks);
+  LOGP(info, "serial    : {:8.3f} s", timeSerial.count());
+  LOGP(info, "{:2} threads: {:8.3f} s, speedup {:.2f}", vm["nthreads"].as<int>(), timeParallel.count(),
+       timeSerial.count() / timeParallel.count());
+  parallel.printTimers();
+  LOGP(info, "tracks of the parallel finding are {}", nDifferent == 0 ? "identical" : "DIFFERENT");
+
+  return nDifferent == 0 ? 0 : 1;
+}
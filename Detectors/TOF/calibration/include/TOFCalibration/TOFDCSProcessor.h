@@ -17,11 +17,13 @@
 #include <unordered_map>
 #include <deque>
 #include <numeric>
+#include <algorithm>
 #include "Framework/Logger.h"
 #include "DetectorsDCS/DataPointCompositeObject.h"
 #include "DetectorsDCS/DataPointIdentifier.h"
 #include "DetectorsDCS/DataPointValue.h"
 #include "DetectorsDCS/DeliveryType.h"
+#include "DetectorsDCS/DataPointIndexer.h"
 #include "CCDB/CcdbObjectInfo.h"
 #include "CommonUtils/MemFileHelper.h"
 #include "CCDB/CcdbApi.h"
@@ -81,6 +83,7 @@ class TOFDCSProcessor
  public:
   using CcdbObjectInfo = o2::ccdb::CcdbObjectInfo;
   using DQDoubles = std::deque<double>;
+  using Index = o2::dcs::DataPointIndexer::Index;
 
   static constexpr int NFEACS = 8;
   static constexpr int NDDLS = Geo::kNDDL * Geo::NSECTORS;
@@ -92,6 +95,8 @@ class TOFDCSProcessor
 
   //int process(const std::vector<DPCOM>& dps);
   int process(const gsl::span<const DPCOM> dps);
+  /// process DPs which were already converted to the indices of getIndexer()
+  int process(const gsl::span<const o2::dcs::IndexedDataPoint> dps);
   int processDP(const DPCOM& dpcom);
   uint64_t processFlags(uint64_t flag, const char* pid);
 
@@ -126,28 +131,39 @@ class TOFDCSProcessor
   void useVerboseModeDP() { mVerboseDP = true; }
   void useVerboseModeHVLV() { mVerboseHVLV = true; }
 
+  const o2::dcs::DataPointIndexer& getIndexer() const { return mIndexer; }
+
   void clearDPsinfo()
   {
-    mDpsdoublesmap.clear();
+    for (auto& dvect : mDpsdoubles) {
+      dvect.clear();
+    }
     //    mTOFDCS.clear();
   }
 
   bool areAllDPsFilled()
   {
-    for (auto& it : mPids) {
-      if (!it.second) {
-        return false;
-      }
-    }
-    return true;
+    return std::find(mProcessed.begin(), mProcessed.end(), false) == mProcessed.end();
   }
 
  private:
-  std::unordered_map<DPID, TOFDCSinfo> mTOFDCS;                // this is the object that will go to the CCDB
-  std::unordered_map<DPID, bool> mPids;                        // contains all PIDs for the processor, the bool
-                                                               // will be true if the DP was processed at least once
-  std::unordered_map<DPID, std::vector<DPVAL>> mDpsdoublesmap; // this is the map that will hold the DPs for the
-                                                               // double type (voltages and currents)
+  // what a DP is used for, extracted from its alias in init()
+  struct DPInfo {
+    enum Kind : uint8_t { Other,
+                          FEACStatus,
+                          HVStatus };
+    Kind kind = Other;
+    int i0 = -1; // DDL for FEACSTATUS, sector for HVSTATUS
+    int i1 = -1; // plate for HVSTATUS
+  };
+
+  int processDP(Index idx, const DPVAL& val);
+
+  std::unordered_map<DPID, TOFDCSinfo> mTOFDCS; // this is the object that will go to the CCDB
+  o2::dcs::DataPointIndexer mIndexer;           // dense indices of all PIDs for the processor, the vectors below are indexed by it
+  std::vector<bool> mProcessed;                 // true if the DP was processed at least once
+  std::vector<DPInfo> mDPInfo;                  // role of the DP, from its alias
+  std::vector<std::vector<DPVAL>> mDpsdoubles;  // DPs of the double type (voltages and currents), empty for the others
 
   std::array<std::array<TOFFEACinfo, NFEACS>, NDDLS> mFeacInfo;                       // contains the strip/pad info per FEAC
   std::array<std::bitset<8>, NDDLS> mPrevFEACstatus;                                  // previous FEAC status
@@ -47,9 +47,41 @@ void TOFDCSProcessor::init(const std::vector<DPID>& pids)
   // fill the array of the DPIDs that will be used by TOF
   // pids should be provided by CCDB
 
-  for (const auto& it : pids) {
-    mPids[it] = false;
+  mIndexer.init(pids);
+  const auto nDPs = mIndexer.size();
+  mProcessed.assign(nDPs, false);
+  mDPInfo.assign(nDPs, DPInfo{});
+  mDpsdoubles.assign(nDPs, {});
+  for (Index idx = 0; idx < nDPs; ++idx) {
+    const auto& it = mIndexer.getID(idx);
     mTOFDCS[it].makeEmpty();
+    if (it.get_type() != DPVAL_INT) {
+      continue;
+    }
+    // the alias is parsed once here, rather than for every DP (regex is quite slow, using this way)
+    std::string aliasStr(it.get_alias());
+    auto& info = mDPInfo[idx];
+    if (std::strstr(it.get_alias(), "FEACSTATUS") != nullptr) { // DP is FEACSTATUS
+      // extracting DDL number
+      const auto offs = std::strlen("TOF_FEACSTATUS_");
+      std::size_t const nn = aliasStr.find_first_of("0123456789", offs);
+      std::size_t const mm = aliasStr.find_first_not_of("0123456789", nn);
+      std::string ddlStr = aliasStr.substr(nn, mm != std::string::npos ? mm - nn : mm);
+      info.kind = DPInfo::FEACStatus;
+      info.i0 = std::stoi(ddlStr);
+    } else if (std::strstr(it.get_alias(), "HVSTATUS") != nullptr) { // DP is HVSTATUS
+      // extracting SECTOR and PLATE number
+      const auto offs = std::strlen("TOF_HVSTATUS_SM");
+      std::size_t const nn = aliasStr.find_first_of("0123456789", offs);
+      std::size_t const mm = aliasStr.find_first_not_of("0123456789", nn);
+      std::size_t const oo = aliasStr.find_first_of("0123456789", mm);
+      std::size_t const pp = aliasStr.find_first_not_of("0123456789", oo);
+      std::string sectorStr = aliasStr.substr(nn, mm != std::string::npos ? mm - nn : mm);
+      std::string plateStr = aliasStr.substr(oo, pp != std::string::npos ? pp - oo : pp);
+      info.kind = DPInfo::HVStatus;
+      info.i0 = std::stoi(sectorStr);
+      info.i1 = std::stoi(plateStr);
+    }
   }
 
   for (int iddl = 0; iddl < NDDLS; ++iddl) {
@@ -69,20 +101,6 @@ int TOFDCSProcessor::process(const gsl::span<const DPCOM> dps)
   if (mVerboseDP || mVerboseHVLV) {
     LOG(info) << "\n\n\nProcessing new DCS DP map\n-----------------";
   }
-  if (false) {
-    std::unordered_map<DPID, DPVAL> mapin;
-    for (auto& it : dps) {
-      mapin[it.id] = it.data;
-    }
-    for (auto& it : mPids) {
-      const auto& el = mapin.find(it.first);
-      if (el == mapin.end()) {
-        LOG(debug) << "DP " << it.first << " not found in map";
-      } else {
-        LOG(debug) << "DP " << it.first << " found in map";
-      }
-    }
-  }
 
   mUpdateFeacStatus = false; // by default, we do not foresee a new entry in the CCDB for the FEAC
   mUpdateHVStatus = false;   // by default, we do not foresee a new entry in the CCDB for the HV
@@ -90,13 +108,46 @@ int TOFDCSProcessor::process(const gsl::span<const DPCOM> dps)
   // now we process all DPs, one by one
   for (const auto& it : dps) {
     // we process only the DPs defined in the configuration
-    const auto& el = mPids.find(it.id);
-    if (el == mPids.end()) {
+    const auto idx = mIndexer.getIndex(it.id);
+    if (idx == DataPointIndexer::INVALID) {
       LOG(info) << "DP " << it.id << " not found in TOFDCSProcessor, we will not process it";
       continue;
     }
-    processDP(it);
-    mPids[it.id] = true;
+    processDP(idx, it.data);
+    mProcessed[idx] = true;
+  }
+
+  if (mUpdateFeacStatus) {
+    updateFEACCCDB();
+  }
+
+  if (mUpdateHVStatus) {
+    updateHVCCDB();
+  }
+
+  return 0;
+}
+
+//__________________________________________________________________
+
+int TOFDCSProcessor::process(const gsl::span<const o2::dcs::IndexedDataPoint> dps)
+{
+
+  // same as above, for DPs already carrying the index of mIndexer
+  if (mVerboseDP || mVerboseHVLV) {
+    LOG(info) << "\n\n\nProcessing new indexed DCS DP map\n-----------------";
+  }
+
+  mUpdateFeacStatus = false;
+  mUpdateHVStatus = false;
+
+  for (const auto& it : dps) {
+    if (it.index >= mIndexer.size()) {
+      LOG(info) << "DP index " << it.index << " not known to TOFDCSProcessor, we will not process it";
+      continue;
+    }
+    processDP(it.index, it.data);
+    mProcessed[it.index] = true;
   }
 
   if (mUpdateFeacStatus) {
@@ -115,12 +166,32 @@ int TOFDCSProcessor::process(const gsl::span<const DPCOM> dps)
 int TOFDCSProcessor::processDP(const DPCOM& dpcom)
 {
 
-  // processing single DP
+  // processing single DP, it must be one of the DPs given to init()
 
-  auto& dpid = dpcom.id;
+  const auto idx = mIndexer.getIndex(dpcom.id);
+  if (idx == DataPointIndexer::INVALID) {
+    LOG(info) << "DP " << dpcom.id << " not found in TOFDCSProcessor, we will not process it";
+    return 1;
+  }
+  return processDP(idx, dpcom.data);
+}
+
+//__________________________________________________________________
+
+int TOFDCSProcessor::processDP(Index idx, const DPVAL& val)
+{
+
+  // processing single DP, identified by its index
+
+  auto& dpid = mIndexer.getID(idx);
   const auto& type = dpid.get_type();
-  auto& val = dpcom.data;
+  union Converter {
+    uint64_t raw_data;
+    int32_t int_value;
+  } converter;
+  converter.raw_data = val.payload_pt1;
   if (mVerboseDP || mVerboseHVLV) {
+    const DPCOM dpcom(dpid, val);
     if (type == DPVAL_DOUBLE) {
       LOG(info);
       LOG(info) << "Processing DP = " << dpcom << ", with value = " << o2::dcs::getValue<double>(dpcom) << ", epoch time = " << val.get_epoch_time();
@@ -134,9 +205,9 @@ int TOFDCSProcessor::processDP(const DPCOM& dpcom)
     // now I need to access the correct element
     if (type == DPVAL_DOUBLE) {
       // for these DPs, we will store the first, last, mid value, plus the value where the maximum variation occurred
-      auto& dvect = mDpsdoublesmap[dpid];
+      auto& dvect = mDpsdoubles[idx];
       if (mVerboseDP) {
-        LOG(debug) << "mDpsdoublesmap[dpid].size() = " << dvect.size();
+        LOG(debug) << "mDpsdoubles[idx].size() = " << dvect.size();
       }
       auto etime = val.get_epoch_time();
       if (dvect.size() == 0 ||
@@ -150,15 +221,10 @@ int TOFDCSProcessor::processDP(const DPCOM& dpcom)
 
     if (type == DPVAL_INT) {
       // for these DPs, we need some processing
-      if (std::strstr(dpid.get_alias(), "FEACSTATUS") != nullptr) { // DP is FEACSTATUS
-        std::string aliasStr(dpid.get_alias());
-        // extracting DDL number (regex is quite slow, using this way)
-        const auto offs = std::strlen("TOF_FEACSTATUS_");
-        std::size_t const nn = aliasStr.find_first_of("0123456789", offs);
-        std::size_t const mm = aliasStr.find_first_not_of("0123456789", nn);
-        std::string ddlStr = aliasStr.substr(nn, mm != std::string::npos ? mm - nn : mm);
-        auto iddl = std::stoi(ddlStr);
-        std::bitset<8> feacstatus(o2::dcs::getValue<int32_t>(dpcom));
+      const auto& info = mDPInfo[idx];
+      if (info.kind == DPInfo::FEACStatus) { // DP is FEACSTATUS
+        auto iddl = info.i0;
+        std::bitset<8> feacstatus(converter.int_value);
         if (mVerboseHVLV) {
           LOG(info) << "DDL: " << iddl << ": Prev FEAC = " << mPrevFEACstatus[iddl] << ", new = " << feacstatus;
         }
@@ -207,19 +273,10 @@ int TOFDCSProcessor::processDP(const DPCOM& dpcom)
         mPrevFEACstatus[iddl] = feacstatus;
       } // end processing current DP, when it is of type FEACSTATUS
 
-      if (std::strstr(dpid.get_alias(), "HVSTATUS") != nullptr) { // DP is HVSTATUS
-        std::string aliasStr(dpid.get_alias());
-        // extracting SECTOR and PLATE number (regex is quite slow, using this way)
-        const auto offs = std::strlen("TOF_HVSTATUS_SM");
-        std::size_t const nn = aliasStr.find_first_of("0123456789", offs);
-        std::size_t const mm = aliasStr.find_first_not_of("0123456789", nn);
-        std::size_t const oo = aliasStr.find_first_of("0123456789", mm);
-        std::size_t const pp = aliasStr.find_first_not_of("0123456789", oo);
-        std::string sectorStr = aliasStr.substr(nn, mm != std::string::npos ? mm - nn : mm);
-        auto isect = std::stoi(sectorStr);
-        std::string plateStr = aliasStr.substr(oo, pp != std::string::npos ? pp - oo : pp);
-        auto iplat = std::stoi(plateStr);
-        std::bitset<19> hvstatus(o2::dcs::getValue<int32_t>(dpcom));
+      if (info.kind == DPInfo::HVStatus) { // DP is HVSTATUS
+        auto isect = info.i0;
+        auto iplat = info.i1;
+        std::bitset<19> hvstatus(converter.int_value);
         if (mVerboseHVLV) {
           LOG(info) << "Sector: " << isect << ", plate = " << iplat << ": Prev HV = "
                     << mPrevHVstatus[iplat][isect] << ", new = " << hvstatus;
@@ -337,17 +394,18 @@ void TOFDCSProcessor::updateDPsCCDB()
     double double_value;
   } converter0, converter1;
 
-  for (auto& it : mPids) {
-    const auto& type = it.first.get_type();
+  for (Index idx = 0; idx < mIndexer.size(); ++idx) {
+    const auto& id = mIndexer.getID(idx);
+    const auto& type = id.get_type();
     if (type == o2::dcs::DPVAL_DOUBLE) {
-      auto& tofdcs = mTOFDCS[it.first];
-      if (it.second) {     // we processed the DP at least 1x
+      auto& tofdcs = mTOFDCS[id];
+      if (mProcessed[idx]) { // we processed the DP at least 1x
         if (mVerboseDP) {
-          LOG(info) << "Processing DP " << it.first.get_alias();
+          LOG(info) << "Processing DP " << id.get_alias();
         }
-        it.second = false; // reset for the next period
+        mProcessed[idx] = false; // reset for the next period
         tofdcs.updated = true;
-        auto& dpvect = mDpsdoublesmap[it.first];
+        auto& dpvect = mDpsdoubles[idx];
         tofdcs.firstValue.first = dpvect[0].get_epoch_time();
         converter0.raw_data = dpvect[0].payload_pt1;
         tofdcs.firstValue.second = converter0.double_value;
@@ -413,18 +471,18 @@ void TOFDCSProcessor::updateDPsCCDB()
         tofdcs.updated = false;
       }
       if (mVerboseDP) {
-        LOG(info) << "PID " << it.first.get_alias() << " was updated to:";
+        LOG(info) << "PID " << id.get_alias() << " was updated to:";
         tofdcs.print();
       }
     }
   }
   if (mVerboseDP) {
     LOG(info) << "Printing object to be sent to CCDB";
-    for (auto& it : mPids) {
-      const auto& type = it.first.get_type();
+    for (const auto& id : mIndexer.getIDs()) {
+      const auto& type = id.get_type();
       if (type == o2::dcs::DPVAL_DOUBLE) {
-        LOG(info) << "PID = " << it.first.get_alias();
-        auto& tofdcs = mTOFDCS[it.first];
+        LOG(info) << "PID = " << id.get_alias();
+        auto& tofdcs = mTOFDCS[id];
         tofdcs.print();
       }
     }
@@ -22,6 +22,7 @@
 #include "DetectorsDCS/DataPointValue.h"
 #include "DetectorsDCS/DataPointCompositeObject.h"
 #include "DetectorsDCS/DeliveryType.h"
+#include "DetectorsDCS/DataPointIndexer.h"
 #include "DetectorsDCS/AliasExpander.h"
 #include "TOFCalibration/TOFDCSProcessor.h"
 #include "DetectorsCalibration/Utils.h"
@@ -138,7 +139,13 @@ class TOFDCSDataProcessor : public o2::framework::Task
     }
     auto dps = pc.inputs().get<gsl::span<DPCOM>>("input");
 
-    mProcessor->process(dps);
+    // convert to the dense indices of the processor once, the DPs which were not configured are dropped here
+    mIndexedDPs.clear();
+    auto nSkipped = mProcessor->getIndexer().index(dps, mIndexedDPs);
+    if (nSkipped) {
+      LOG(info) << nSkipped << " out of " << dps.size() << " DPs are not configured for TOF, we will not process them";
+    }
+    mProcessor->process(gsl::span<const o2::dcs::IndexedDataPoint>(mIndexedDPs));
     Duration elapsedTime = timeNow - mTimer; // in seconds
     if (elapsedTime.count() >= mDPsUpdateInterval) {
       bool sendToCCDB = true;
@@ -171,6 +178,7 @@ class TOFDCSDataProcessor : public o2::framework::Task
  private:
   bool mReportTiming = false;
   std::unique_ptr<TOFDCSProcessor> mProcessor;
+  std::vector<o2::dcs::IndexedDataPoint> mIndexedDPs; // DPs of the current TF with the indices of the processor
   HighResClock::time_point mTimer;
   int64_t mDPsUpdateInterval;
   bool mStoreWhenAllDPs = false;
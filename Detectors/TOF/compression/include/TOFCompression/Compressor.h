@@ -20,6 +20,7 @@
 #include <fstream>
 #include <string>
 #include <cstdint>
+#include <cstring>
 #include "Headers/RAWDataHeader.h"
 #include "DataFormatsTOF/RawDataFormat.h"
 #include "DataFormatsTOF/CompressedDataFormat.h"
@@ -69,6 +70,18 @@ class Compressor
 
   void checkSummary();
   void resetCounters();
+  /// add the counters of another compressor, e.g. of the one of another thread
+  void addCounters(const Compressor& other);
+
+  /// drop what is left over from an aborted HBF or event (partial payload, unused hits),
+  /// so that the next buffer is compressed independently of the previous ones
+  void resetState()
+  {
+    mDecoderSaveBufferDataSize = 0;
+    mDecoderSummary = {nullptr};
+    std::memset(mSpiderSummary.nFramePackedHits, 0, sizeof(mSpiderSummary.nFramePackedHits));
+    std::memset(mSpiderSummary.filledFrames, 0, sizeof(mSpiderSummary.filledFrames));
+  };
 
   void setDecoderCONET(bool val)
   {
@@ -177,9 +190,9 @@ class Compressor
   bool checkerCheck();
   void checkerCheckRDH();
 
-  uint32_t mEventCounter;
-  uint32_t mFatalCounter;
-  uint32_t mErrorCounter;
+  uint32_t mEventCounter = 0;
+  uint32_t mFatalCounter = 0;
+  uint32_t mErrorCounter = 0;
   bool mCheckerVerbose = false;
 
   struct DRMCounters_t {
@@ -238,6 +251,7 @@ class Compressor
   struct SpiderSummary_t {
     uint32_t FramePackedHit[256][256];
     uint8_t nFramePackedHits[256];
+    uint64_t filledFrames[4]; ///< bit mask of the frames with packed hits
   } mSpiderSummary = {0};
 
   struct CheckerSummary_t {
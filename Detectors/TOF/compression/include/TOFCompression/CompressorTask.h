@@ -19,8 +19,12 @@
 
 #include "Framework/Task.h"
 #include "Framework/DataProcessorSpec.h"
+#include "Framework/DataRef.h"
 #include "TOFCompression/Compressor.h"
+#include "MemoryResources/MemoryResources.h"
 #include <fstream>
+#include <memory>
+#include <vector>
 
 using namespace o2::framework;
 
@@ -39,7 +43,18 @@ class CompressorTask : public Task
   void run(ProcessingContext& pc) final;
 
  private:
-  Compressor<RDH, verbose, paranoid> mCompressor;
+  /// input parts and output buffer of one subspec, the subspecs are compressed independently
+  struct LinkData {
+    std::vector<DataRef> parts;
+    o2::header::DataHeader headerOut;
+    long bufferSize;
+    o2::pmr::vector<char> buffer;
+  };
+
+  void compress(Compressor<RDH, verbose, paranoid>& compressor, LinkData& link);
+
+  std::vector<std::unique_ptr<Compressor<RDH, verbose, paranoid>>> mCompressors; ///< one compressor per thread
+  int mNThreads = 1;
   int mOutputBufferSize;
   long mPayloadLimit = -1;
 };
@@ -98,6 +98,27 @@
 #define GET_TRMDATAHIT_TDCID(x) TRM_TDCID(x)
 #define GET_TRMDATAHIT_EBIT(x) ((x & 0x10000000) >> 28)
 
+namespace
+{
+/// type of the words found in the TRM chain payload, the 4 most significant bits identify it
+enum ChainWord : uint8_t {
+  kChainOther,
+  kChainHit,
+  kChainError,
+  kChainTrailerA,
+  kChainTrailerB
+};
+
+// same classification as IS_TDC_HIT, IS_TDC_ERROR and IS_TRM_CHAINA/B_TRAILER
+constexpr uint8_t ChainWordType[16] = {
+  kChainOther, kChainTrailerA, kChainOther, kChainTrailerB, // 0x0 - 0x3: chain headers and trailers
+  kChainOther, kChainOther, kChainError, kChainOther,       // 0x4 - 0x7: global headers/trailers, TDC error, filler
+  kChainHit, kChainHit, kChainHit, kChainHit,               // 0x8 - 0xF: TDC hits
+  kChainHit, kChainHit, kChainHit, kChainHit};
+
+inline uint8_t getChainWordType(uint32_t word) { return ChainWordType[word >> 28]; }
+} // namespace
+
 namespace o2
 {
 namespace tof
@@ -758,36 +779,41 @@ bool Compressor<RDH, verbose, paranoid>::processTRMchain(int itrm, int ichain)
   }
 
   /** loop over TRM Chain payload **/
+  const uint8_t trailerType = ichain == 0 ? kChainTrailerA : kChainTrailerB;
   int nsteps = 0;
   while (true) {
     nsteps++;
     if (nsteps > 99 && !(nsteps % 100)) {
       LOG(debug) << "processTRMchain: nsteps in while loop = " << nsteps << ", infity loop?";
     }
-    /** TDC hit detected **/
-    if (IS_TDC_HIT(*mDecoderPointer)) {
+    const auto wordType = getChainWordType(*mDecoderPointer);
+
+    /** TDC hits detected, they come in sequence and are stored without going through the other checks **/
+    if (wordType == kChainHit) {
       mDecoderSummary.hasHits[itrm][ichain] = true;
-      auto itdc = GET_TRMDATAHIT_TDCID(*mDecoderPointer);
-      auto ihit = mDecoderSummary.trmDataHits[ichain][itdc];
-      mDecoderSummary.trmDataHit[ichain][itdc][ihit] = mDecoderPointer;
-      mDecoderSummary.trmDataHits[ichain][itdc]++;
-      if (verbose && mDecoderVerbose) {
-        auto trmDataHit = reinterpret_cast<const raw::TRMDataHit_t*>(mDecoderPointer);
-        auto time = trmDataHit->time;
-        auto chanId = trmDataHit->chanId;
-        auto tdcId = trmDataHit->tdcId;
-        auto dataId = trmDataHit->dataId;
-        printf(" %08x TRM Data Hit          (time=%d, chanId=%d, tdcId=%d, dataId=0x%x) \n", *mDecoderPointer, time, chanId, tdcId, dataId);
-      }
-      decoderNext();
-      if (paranoid && decoderParanoid()) {
-        return true;
-      }
+      auto& nHits = mDecoderSummary.trmDataHits[ichain];
+      auto& hits = mDecoderSummary.trmDataHit[ichain];
+      do {
+        auto itdc = GET_TRMDATAHIT_TDCID(*mDecoderPointer);
+        hits[itdc][nHits[itdc]++] = mDecoderPointer;
+        if (verbose && mDecoderVerbose) {
+          auto trmDataHit = reinterpret_cast<const raw::TRMDataHit_t*>(mDecoderPointer);
+          auto time = trmDataHit->time;
+          auto chanId = trmDataHit->chanId;
+          auto tdcId = trmDataHit->tdcId;
+          auto dataId = trmDataHit->dataId;
+          printf(" %08x TRM Data Hit          (time=%d, chanId=%d, tdcId=%d, dataId=0x%x) \n", *mDecoderPointer, time, chanId, tdcId, dataId);
+        }
+        decoderNext();
+        if (paranoid && decoderParanoid()) {
+          return true;
+        }
+      } while (IS_TDC_HIT(*mDecoderPointer));
       continue;
     }
 
     /** TDC error detected **/
-    if (IS_TDC_ERROR(*mDecoderPointer)) {
+    if (wordType == kChainError) {
       mDecoderSummary.hasErrors[itrm][ichain] = true;
       auto ierror = mDecoderSummary.trmErrors[itrm][ichain];
       mDecoderSummary.trmError[itrm][ichain][ierror] = mDecoderPointer;
@@ -803,7 +829,7 @@ bool Compressor<RDH, verbose, paranoid>::processTRMchain(int itrm, int ichain)
     }
 
     /** TRM Chain Trailer detected **/
-    if (IS_TRM_CHAIN_TRAILER(*mDecoderPointer, ichain)) {
+    if (wordType == trailerType) {
       mDecoderSummary.trmChainTrailer[itrm][ichain] = mDecoderPointer;
       if (verbose && mDecoderVerbose) {
         auto trmChainTrailer = reinterpret_cast<const raw::TRMChainTrailer_t*>(mDecoderPointer);
@@ -910,6 +936,7 @@ int Compressor<RDH, verbose, paranoid>::encoderSpider(int itrm)
         mSpiderSummary.FramePackedHit[iframe][phit] |= itdc << 27;
         mSpiderSummary.FramePackedHit[iframe][phit] |= ichain << 31;
         mSpiderSummary.nFramePackedHits[iframe]++;
+        mSpiderSummary.filledFrames[iframe >> 6] |= 1ULL << (iframe & 0x3F);
 
         if (iframe < firstFilledFrame) {
           firstFilledFrame = iframe;
@@ -923,50 +950,57 @@ int Compressor<RDH, verbose, paranoid>::encoderSpider(int itrm)
     }
   }
 
-  /** loop over frames **/
-  for (int iframe = firstFilledFrame; iframe < lastFilledFrame + 1; iframe++) {
-
-    /** check if frame is empty **/
-    if (mSpiderSummary.nFramePackedHits[iframe] == 0) {
-      continue;
-    }
+  /** loop over frames, only the filled ones are visited **/
+  for (int iword = firstFilledFrame >> 6; iword <= lastFilledFrame >> 6; ++iword) {
+    for (auto mask = mSpiderSummary.filledFrames[iword]; mask; mask &= mask - 1) {
+      int iframe = (iword << 6) + __builtin_ctzll(mask);
+      if (iframe < firstFilledFrame || iframe > lastFilledFrame) {
+        continue;
+      }
 
-    // encode Frame Header
-    *mEncoderPointer = 0x00000000;
-    *mEncoderPointer |= slotId << 24;
-    *mEncoderPointer |= iframe << 16;
-    *mEncoderPointer |= mSpiderSummary.nFramePackedHits[iframe];
-    if (verbose && mEncoderVerbose) {
-      auto FrameHeader = reinterpret_cast<const compressed::FrameHeader_t*>(mEncoderPointer);
-      auto NumberOfHits = FrameHeader->numberOfHits;
-      auto FrameID = FrameHeader->frameID;
-      auto TRMID = FrameHeader->trmID;
-      printf("%s %08x Frame header          (TRMID=%d, FrameID=%d, NumberOfHits=%d) %s \n", colorGreen, *mEncoderPointer, TRMID, FrameID, NumberOfHits, colorReset);
-    }
-    if (encoderNext()) {
-      encoderRewind();
-      return true;
-    }
+      /** check if frame is empty **/
+      if (mSpiderSummary.nFramePackedHits[iframe] == 0) {
+        continue;
+      }
 
-    // packed hits
-    for (int ihit = 0; ihit < mSpiderSummary.nFramePackedHits[iframe]; ++ihit) {
-      *mEncoderPointer = mSpiderSummary.FramePackedHit[iframe][ihit];
+      // encode Frame Header
+      *mEncoderPointer = 0x00000000;
+      *mEncoderPointer |= slotId << 24;
+      *mEncoderPointer |= iframe << 16;
+      *mEncoderPointer |= mSpiderSummary.nFramePackedHits[iframe];
       if (verbose && mEncoderVerbose) {
-        auto PackedHit = reinterpret_cast<const compressed::PackedHit_t*>(mEncoderPointer);
-        auto Chain = PackedHit->chain;
-        auto TDCID = PackedHit->tdcID;
-        auto Channel = PackedHit->channel;
-        auto Time = PackedHit->time;
-        auto TOT = PackedHit->tot;
-        printf("%s %08x Packed hit            (Chain=%d, TDCID=%d, Channel=%d, Time=%d, TOT=%d) %s \n", colorGreen, *mEncoderPointer, Chain, TDCID, Channel, Time, TOT, colorReset);
+        auto FrameHeader = reinterpret_cast<const compressed::FrameHeader_t*>(mEncoderPointer);
+        auto NumberOfHits = FrameHeader->numberOfHits;
+        auto FrameID = FrameHeader->frameID;
+        auto TRMID = FrameHeader->trmID;
+        printf("%s %08x Frame header          (TRMID=%d, FrameID=%d, NumberOfHits=%d) %s \n", colorGreen, *mEncoderPointer, TRMID, FrameID, NumberOfHits, colorReset);
       }
       if (encoderNext()) {
         encoderRewind();
         return true;
       }
-    }
 
-    mSpiderSummary.nFramePackedHits[iframe] = 0;
+      // packed hits
+      for (int ihit = 0; ihit < mSpiderSummary.nFramePackedHits[iframe]; ++ihit) {
+        *mEncoderPointer = mSpiderSummary.FramePackedHit[iframe][ihit];
+        if (verbose && mEncoderVerbose) {
+          auto PackedHit = reinterpret_cast<const compressed::PackedHit_t*>(mEncoderPointer);
+          auto Chain = PackedHit->chain;
+          auto TDCID = PackedHit->tdcID;
+          auto Channel = PackedHit->channel;
+          auto Time = PackedHit->time;
+          auto TOT = PackedHit->tot;
+          printf("%s %08x Packed hit            (Chain=%d, TDCID=%d, Channel=%d, Time=%d, TOT=%d) %s \n", colorGreen, *mEncoderPointer, Chain, TDCID, Channel, Time, TOT, colorReset);
+        }
+        if (encoderNext()) {
+          encoderRewind();
+          return true;
+        }
+      }
+
+      mSpiderSummary.nFramePackedHits[iframe] = 0;
+      mSpiderSummary.filledFrames[iword] &= ~(1ULL << (iframe & 0x3F));
+    }
   }
   return 0;
 }
@@ -1425,6 +1459,39 @@ void Compressor<RDH, verbose, paranoid>::resetCounters()
   }
 }
 
+template <typename RDH, bool verbose, bool paranoid>
+void Compressor<RDH, verbose, paranoid>::addCounters(const Compressor& other)
+{
+  mEventCounter += other.mEventCounter;
+  mFatalCounter += other.mFatalCounter;
+  mErrorCounter += other.mErrorCounter;
+  mIntegratedBytes += other.mIntegratedBytes;
+  mIntegratedTime += other.mIntegratedTime;
+  mDRMCounters.Headers += other.mDRMCounters.Headers;
+  mDRMCounters.EventWordsMismatch += other.mDRMCounters.EventWordsMismatch;
+  mDRMCounters.clockStatus += other.mDRMCounters.clockStatus;
+  mDRMCounters.Fault += other.mDRMCounters.Fault;
+  mDRMCounters.RTOBit += other.mDRMCounters.RTOBit;
+  for (int itrm = 0; itrm < 10; ++itrm) {
+    auto& trm = mTRMCounters[itrm];
+    const auto& otherTrm = other.mTRMCounters[itrm];
+    trm.Headers += otherTrm.Headers;
+    trm.Empty += otherTrm.Empty;
+    trm.EventCounterMismatch += otherTrm.EventCounterMismatch;
+    trm.EventWordsMismatch += otherTrm.EventWordsMismatch;
+    trm.EBit += otherTrm.EBit;
+    for (int ichain = 0; ichain < 2; ++ichain) {
+      auto& chain = mTRMChainCounters[itrm][ichain];
+      const auto& otherChain = other.mTRMChainCounters[itrm][ichain];
+      chain.Headers += otherChain.Headers;
+      chain.EventCounterMismatch += otherChain.EventCounterMismatch;
+      chain.BadStatus += otherChain.BadStatus;
+      chain.BunchIDMismatch += otherChain.BunchIDMismatch;
+      chain.TDCerror += otherChain.TDCerror;
+    }
+  }
+}
+
 template <typename RDH, bool verbose, bool paranoid>
 void Compressor<RDH, verbose, paranoid>::checkSummary()
 {
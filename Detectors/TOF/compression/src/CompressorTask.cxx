@@ -22,6 +22,12 @@
 #include "Framework/InputRecordWalker.h"
 #include "CommonUtils/VerbosityConfig.h"
 
+#include <algorithm>
+
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
 using namespace o2::framework;
 
 namespace o2::tof
@@ -42,13 +48,39 @@ void CompressorTask<RDH, verbose, paranoid>::init(InitContext& ic)
   auto checkerVerbose = ic.options().get<bool>("tof-compressor-checker-verbose");
   mOutputBufferSize = ic.options().get<int>("tof-compressor-output-buffer-size");
 
-  mCompressor.setDecoderCONET(decoderCONET);
-  mCompressor.setDecoderVerbose(decoderVerbose);
-  mCompressor.setEncoderVerbose(encoderVerbose);
-  mCompressor.setCheckerVerbose(checkerVerbose);
+  mNThreads = ic.options().get<int>("tof-compressor-threads");
+#ifdef WITH_OPENMP
+  if (mNThreads < 0) {
+    mNThreads = omp_get_max_threads();
+  }
+#else
+  if (mNThreads > 1) {
+    LOG(warning) << "Compressor built without OpenMP, using 1 thread instead of " << mNThreads;
+  }
+  mNThreads = 1;
+#endif
+  if (verbose && mNThreads > 1) {
+    LOG(warning) << "Verbose compressor, using 1 thread instead of " << mNThreads << " to keep the printout readable";
+    mNThreads = 1;
+  }
+  mNThreads = std::max(mNThreads, 1);
+  LOG(info) << "Compressor uses " << mNThreads << " thread(s)";
+
+  mCompressors.clear();
+  for (int ithread = 0; ithread < mNThreads; ++ithread) {
+    auto& compressor = *mCompressors.emplace_back(std::make_unique<Compressor<RDH, verbose, paranoid>>());
+    compressor.setDecoderCONET(decoderCONET);
+    compressor.setDecoderVerbose(decoderVerbose);
+    compressor.setEncoderVerbose(encoderVerbose);
+    compressor.setCheckerVerbose(checkerVerbose);
+  }
 
   auto finishFunction = [this]() {
-    mCompressor.checkSummary();
+    for (int ithread = 1; ithread < mNThreads; ++ithread) {
+      mCompressors[0]->addCounters(*mCompressors[ithread]);
+      mCompressors[ithread]->resetCounters();
+    }
+    mCompressors[0]->checkSummary();
   };
 
   ic.services().get<CallbackService>().set<CallbackService::Id::Stop>(finishFunction);
@@ -111,11 +143,13 @@ void CompressorTask<RDH, verbose, paranoid>::run(ProcessingContext& pc)
     //  }
   }
 
-  /** loop over subspecs **/
+  /** create the output of the subspecs in order, they are compressed independently, possibly in parallel **/
+  std::vector<LinkData> links;
+  links.reserve(subspecPartMap.size());
   for (auto& subspecPartEntry : subspecPartMap) {
 
     auto subspec = subspecPartEntry.first;
-    auto parts = subspecPartEntry.second;
+    auto& parts = subspecPartEntry.second;
     auto& firstPart = parts.at(0);
 
     /** use the first part to define output headers **/
@@ -128,45 +162,73 @@ void CompressorTask<RDH, verbose, paranoid>::run(ProcessingContext& pc)
     auto bufferSize = mOutputBufferSize >= 0 ? mOutputBufferSize + subspecBufferSize[subspec] : std::abs(mOutputBufferSize);
     auto bufferSizeDouble = bufferSize * 2;
     auto output = Output{headerOut.dataOrigin, "CRAWDATA", headerOut.subSpecification};
-    auto&& v = pc.outputs().makeVector<char>(output);
-    v.resize(bufferSizeDouble);
+    auto& link = links.emplace_back(LinkData{std::move(parts), headerOut, bufferSize, pc.outputs().makeVector<char>(output)});
+    link.buffer.resize(bufferSizeDouble);
     // Better way of doing this would be to used an offset, so that we can resize the vector
     // as well. However, this should be good enough because bufferSize overestimates the size
     // of the payload.
-    auto bufferPointer = v.data();
+  }
 
-    /** loop over subspec parts **/
-    for (const auto& ref : parts) {
-      /** input **/
-      auto payloadIn = ref.payload;
-      auto payloadInSize = DataRefUtils::getPayloadSize(ref);
+  /** loop over subspecs **/
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+  for (size_t ilink = 0; ilink < links.size(); ++ilink) {
+#ifdef WITH_OPENMP
+    auto& compressor = *mCompressors[omp_get_thread_num()];
+#else
+    auto& compressor = *mCompressors[0];
+#endif
+    compress(compressor, links[ilink]);
+  }
 
-      if (mPayloadLimit > -1 && payloadInSize > mPayloadLimit) {
-        LOG(error) << "Payload larger than limit (" << mPayloadLimit << "), payload = " << payloadInSize;
-        continue;
-      }
+  for (auto& link : links) {
+    auto output = Output{link.headerOut.dataOrigin, "CRAWDATA", link.headerOut.subSpecification};
+    pc.outputs().adoptContainer(output, std::move(link.buffer));
+  }
+}
 
-      /** prepare compressor **/
-      mCompressor.setDecoderBuffer(payloadIn);
-      mCompressor.setDecoderBufferSize(payloadInSize);
-      mCompressor.setEncoderBuffer(bufferPointer);
-      mCompressor.setEncoderBufferSize(bufferSize);
-
-      /** run **/
-      mCompressor.run();
-      auto payloadOutSize = mCompressor.getEncoderByteCounter();
-      bufferPointer += payloadOutSize;
-      bufferSize -= payloadOutSize;
-      headerOut.payloadSize += payloadOutSize;
-    }
+template <typename RDH, bool verbose, bool paranoid>
+void CompressorTask<RDH, verbose, paranoid>::compress(Compressor<RDH, verbose, paranoid>& compressor, LinkData& link)
+{
+  auto& headerOut = link.headerOut;
+  auto bufferSize = link.bufferSize;
+  auto bufferSizeDouble = link.buffer.size();
+  auto bufferPointer = link.buffer.data();
+
+  /** the subspec must not depend on what was compressed before by this compressor **/
+  compressor.resetState();
+
+  /** loop over subspec parts **/
+  for (const auto& ref : link.parts) {
+    /** input **/
+    auto payloadIn = ref.payload;
+    auto payloadInSize = DataRefUtils::getPayloadSize(ref);
 
-    if (headerOut.payloadSize > bufferSizeDouble) {
-      headerOut.payloadSize = 0; // put payload to zero, otherwise it will trigger a crash
+    if (mPayloadLimit > -1 && payloadInSize > mPayloadLimit) {
+      LOG(error) << "Payload larger than limit (" << mPayloadLimit << "), payload = " << payloadInSize;
+      continue;
     }
 
-    v.resize(headerOut.payloadSize);
-    pc.outputs().adoptContainer(output, std::move(v));
+    /** prepare compressor **/
+    compressor.setDecoderBuffer(payloadIn);
+    compressor.setDecoderBufferSize(payloadInSize);
+    compressor.setEncoderBuffer(bufferPointer);
+    compressor.setEncoderBufferSize(bufferSize);
+
+    /** run **/
+    compressor.run();
+    auto payloadOutSize = compressor.getEncoderByteCounter();
+    bufferPointer += payloadOutSize;
+    bufferSize -= payloadOutSize;
+    headerOut.payloadSize += payloadOutSize;
   }
+
+  if (headerOut.payloadSize > bufferSizeDouble) {
+    headerOut.payloadSize = 0; // put payload to zero, otherwise it will trigger a crash
+  }
+
+  link.buffer.resize(headerOut.payloadSize);
 }
 
 template class CompressorTask<o2::header::RAWDataHeader, false, false>;
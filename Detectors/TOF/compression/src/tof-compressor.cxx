@@ -120,6 +120,7 @@ WorkflowSpec defineDataProcessing(ConfigContext const& cfgc)
       Options{
         {"tof-compressor-output-buffer-size", VariantType::Int, 1048576, {"Encoder output buffer size (in bytes). Zero = automatic (careful)."}},
         {"tof-compressor-conet-mode", VariantType::Bool, false, {"Decoder CONET flag"}},
+        {"tof-compressor-threads", VariantType::Int, 1, {"Number of threads compressing the subspecs (links) in parallel, < 0 for all available"}},
         {"tof-compressor-decoder-verbose", VariantType::Bool, false, {"Decoder verbose flag"}},
         {"tof-compressor-encoder-verbose", VariantType::Bool, false, {"Encoder verbose flag"}},
         {"tof-compressor-checker-verbose", VariantType::Bool, false, {"Checker verbose flag"}}}});
@@ -0,0 +1,188 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// @file   benchCompressor.cxx
+/// @brief  Throughput of the TOF compressor on generated raw data of several links,
+///         compressed by one or more threads as in the CompressorTask
+
+#include <benchmark/benchmark.h>
+#include "TOFCompression/Compressor.h"
+#include "Headers/RAWDataHeader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
+using namespace o2::tof;
+
+using RDH = o2::header::RAWDataHeader;
+using TOFCompressor = Compressor<RDH, false, false>;
+
+namespace
+{
+constexpr int NLinks = 12;
+constexpr int NHBFs = 128;   // HBFs per TF
+constexpr int NHitPairs = 8; // leading/trailing hit pairs per TRM chain and event
+constexpr int PageSize = 8192;
+
+/// TOF data of one event (DRM readout window of one orbit), all TRMs participate
+void generateEvent(std::vector<uint32_t>& words, uint32_t drmId, uint32_t orbit, uint32_t bc, uint32_t evCnt, std::mt19937& gen)
+{
+  std::uniform_int_distribution<uint32_t> tdc(0, 14), chan(0, 7), time(0, (1 << 21) - 2048), width(1, 2000);
+  const auto first = words.size();
+  words.push_back(0x40000000); // TOF data header
+  words.push_back(orbit);      // TOF orbit
+  const auto drmHeader = words.size();
+  words.push_back(0x40000001 | (drmId << 20)); // DRM data header, event words are set at the end
+  words.push_back((0x7FE << 4) | (2 << 16));   // DRM header word 1: participating TRMs, clock status
+  words.push_back(0x7FE << 4);                 // DRM header word 2: enabled TRMs
+  words.push_back(bc << 4);                    // DRM header word 3: GBT bunch counter
+  words.push_back(0);                          // DRM header word 4
+  words.push_back(0);                          // DRM header word 5
+  for (uint32_t slotId = 3; slotId < 13; ++slotId) {
+    const auto trmHeader = words.size();
+    words.push_back(0x40000000 | ((evCnt % 1024) << 17) | slotId);
+    for (uint32_t ichain = 0; ichain < 2; ++ichain) {
+      words.push_back(((2 * ichain) << 28) | (bc << 4) | slotId); // chain header
+      for (int ihit = 0; ihit < NHitPairs; ++ihit) {
+        const uint32_t hit = (tdc(gen) << 24) | (chan(gen) << 21);
+        const uint32_t leading = time(gen);
+        words.push_back(0xA0000000 | hit | leading);
+        words.push_back(0xC0000000 | hit | (leading + width(gen)));
+      }
+      words.push_back(((2 * ichain + 1) << 28) | ((evCnt & 0xFFF) << 16)); // chain trailer
+    }
+    words.push_back(0x50000003); // TRM trailer
+    words[trmHeader] |= (words.size() - trmHeader) << 4;
+  }
+  words.push_back(0x50000001 | ((evCnt & 0xFFF) << 4)); // DRM trailer
+  words[drmHeader] |= (words.size() - drmHeader - 6) << 4;
+  if ((words.size() - first) % 2) {
+    words.push_back(0x70000000); // filler, every event starts with a new GBT word
+  }
+}
+
+/// raw data of one link for a TF, in padded CRU format (2 TOF words per 128 bit GBT word) and split in pages
+std::vector<char> generateLink(int feeId, std::mt19937& gen)
+{
+  std::vector<char> link;
+  std::vector<uint32_t> words;
+  std::vector<uint32_t> payload;
+  for (int ihbf = 0; ihbf < NHBFs; ++ihbf) {
+    words.clear();
+    generateEvent(words, feeId, ihbf, 0, ihbf, gen);
+    payload.clear();
+    for (size_t iword = 0; iword < words.size(); iword += 2) {
+      payload.insert(payload.end(), {words[iword], words[iword + 1], 0, 0});
+    }
+
+    RDH rdh;
+    rdh.feeId = feeId;
+    rdh.orbit = ihbf;
+    rdh.dataFormat = 0;
+    const size_t maxPagePayload = (PageSize - sizeof(RDH)) / 16 * 16;
+    const auto payloadBytes = payload.size() * sizeof(uint32_t);
+    for (size_t offset = 0; offset < payloadBytes; offset += maxPagePayload) {
+      const auto size = std::min(maxPagePayload, payloadBytes - offset);
+      rdh.memorySize = rdh.offsetToNext = sizeof(RDH) + size;
+      link.insert(link.end(), reinterpret_cast<const char*>(&rdh), reinterpret_cast<const char*>(&rdh) + sizeof(RDH));
+      link.insert(link.end(), reinterpret_cast<const char*>(payload.data()) + offset, reinterpret_cast<const char*>(payload.data()) + offset + size);
+      rdh.pageCnt++;
+    }
+    rdh.stop = 1;
+    rdh.memorySize = rdh.offsetToNext = sizeof(RDH);
+    link.insert(link.end(), reinterpret_cast<const char*>(&rdh), reinterpret_cast<const char*>(&rdh) + sizeof(RDH));
+  }
+  return link;
+}
+
+const std::vector<std::vector<char>>& getInput()
+{
+  static std::vector<std::vector<char>> links;
+  if (links.empty()) {
+    std::mt19937 gen(1234);
+    for (int ilink = 0; ilink < NLinks; ++ilink) {
+      links.push_back(generateLink(ilink, gen));
+    }
+  }
+  return links;
+}
+
+/// compress the links in parallel, every thread has its own compressor, the output of each link has its own buffer
+void compress(const std::vector<std::vector<char>>& input, std::vector<std::unique_ptr<TOFCompressor>>& compressors, std::vector<std::vector<char>>& output)
+{
+  const int nThreads = compressors.size();
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(nThreads)
+#endif
+  for (size_t ilink = 0; ilink < input.size(); ++ilink) {
+#ifdef WITH_OPENMP
+    auto& compressor = *compressors[omp_get_thread_num()];
+#else
+    auto& compressor = *compressors[0];
+#endif
+    auto& buffer = output[ilink];
+    buffer.resize(input[ilink].size() + 1048576);
+    compressor.resetState();
+    compressor.setDecoderBuffer(input[ilink].data());
+    compressor.setDecoderBufferSize(input[ilink].size());
+    compressor.setEncoderBuffer(buffer.data());
+    compressor.setEncoderBufferSize(buffer.size());
+    compressor.run();
+    buffer.resize(compressor.getEncoderByteCounter());
+  }
+}
+} // namespace
+
+static void BM_Compressor(benchmark::State& state)
+{
+  int nThreads = state.range(0);
+#ifndef WITH_OPENMP
+  nThreads = 1;
+#endif
+  const auto& input = getInput();
+  size_t inputSize = 0;
+  for (const auto& link : input) {
+    inputSize += link.size();
+  }
+
+  // reference: serial compression
+  std::vector<std::unique_ptr<TOFCompressor>> serial;
+  serial.emplace_back(std::make_unique<TOFCompressor>());
+  std::vector<std::vector<char>> reference(input.size());
+  compress(input, serial, reference);
+
+  std::vector<std::unique_ptr<TOFCompressor>> compressors;
+  for (int ithread = 0; ithread < nThreads; ++ithread) {
+    compressors.emplace_back(std::make_unique<TOFCompressor>());
+  }
+  std::vector<std::vector<char>> output(input.size());
+  for (auto _ : state) {
+    compress(input, compressors, output);
+  }
+  if (output != reference) {
+    state.SkipWithError("output differs from the one of the serial compression");
+  }
+
+  state.SetBytesProcessed(state.iterations() * inputSize);
+  state.counters["threads"] = nThreads;
+  state.counters["GB/s/core"] = benchmark::Counter(inputSize * 1e-9 / nThreads, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK(BM_Compressor)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -75,6 +75,11 @@ class CalibPedestal : public CalibRawBase
   Int_t updateCRU(const CRU& cru, const Int_t row, const Int_t pad,
                   const Int_t timeBin, const Float_t signal) final { return 0; }
 
+  /// update function called once per pad with all time bins,
+  /// the pad position and the ADC histogram are looked up only once
+  Int_t updatePad(const CRU& cru, const Int_t rowInRegion, const Int_t roc, const Int_t row, const Int_t pad,
+                  const gsl::span<const uint32_t> data, const Int_t stride) final;
+
   /// Reset pedestal data
   void resetData();
 
@@ -96,8 +101,15 @@ class CalibPedestal : public CalibRawBase
     mLastTimeBin = last;
   }
   /// Analyse the buffered adc values and calculate noise and pedestal
+  /// the ROCs are processed in parallel if the statistics type allows it (MeanStdDev)
   void analyse();
 
+  /// set the number of threads used in analyse
+  static void setNThreads(const int nThreads) { sNThreads = nThreads; }
+
+  /// \return the number of threads used in analyse
+  static int getNThreads() { return sNThreads; }
+
   /// Get the pedestal calibration object
   ///
   /// \return pedestal calibration object
@@ -136,6 +148,8 @@ class CalibPedestal : public CalibRawBase
 
   std::vector<std::unique_ptr<vectorType>> mADCdata; //!< ADC data to calculate noise and pedestal
 
+  inline static int sNThreads{1}; ///< number of threads used in analyse
+
   /// return the value vector for a readout chamber
   ///
   /// \param roc readout chamber
@@ -68,6 +68,11 @@ class CalibPulser : public CalibRawBase
   Int_t updateCRU(const CRU& cru, const Int_t row, const Int_t pad,
                   const Int_t timeBin, const Float_t signal) final { return 0; }
 
+  /// update function called once per pad with all time bins,
+  /// the pedestal and the pad data are looked up only once
+  Int_t updatePad(const CRU& cru, const Int_t rowInRegion, const Int_t roc, const Int_t row, const Int_t pad,
+                  const gsl::span<const uint32_t> data, const Int_t stride) final;
+
   /// Reset temporary data and histogrms
   void resetData();
 
@@ -130,9 +135,15 @@ class CalibPulser : public CalibRawBase
   /// set time bin range around the one with the maximum number of entries
   void setMaxTimeBinRange(int max) { mMaxTimeBinRange = max; }
 
-  /// Analyse the buffered pulser information
+  /// Analyse the buffered pulser information, the ROCs are processed in parallel
   void analyse();
 
+  /// set the number of threads used in analyse
+  static void setNThreads(const int nThreads) { sNThreads = nThreads; }
+
+  /// \return the number of threads used in analyse
+  static int getNThreads() { return sNThreads; }
+
   /// Get the pulser mean time calibration object
   /// \return pedestal calibration object
   const CalPad& getT0() const { return mCalDets.at("T0"); }
@@ -191,6 +202,8 @@ class CalibPulser : public CalibRawBase
   PtrVectorType mWidthHistograms; //!< Width histogramgs per ROC and pad
   PtrVectorType mQtotHistograms;  //!< Qtot histogramgs per ROC and pad
 
+  inline static int sNThreads{1}; ///< number of threads used in analyse
+
   /// pulser data object
   struct PulserData {
     float mT0{0.f};
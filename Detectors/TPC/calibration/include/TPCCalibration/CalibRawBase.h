@@ -86,6 +86,21 @@ class CalibRawBase
 
   Int_t update(const PadROCPos& padROCPos, const CRU& cru, const gsl::span<const uint32_t> data);
 
+  /// update function called once per pad with the ADC values of all time bins
+  ///
+  /// The default implementation calls updateCRU and updateROC for every time bin,
+  /// calibrations can override it to do the per pad work only once.
+  /// \param cru CRU
+  /// \param rowInRegion row in CRU
+  /// \param roc readout chamber
+  /// \param row row in roc (or partition, depending on the pad subset)
+  /// \param pad pad in row
+  /// \param data ADC values, the one of time bin i is data[i * stride]
+  /// \param stride distance between the ADC values of consecutive time bins
+  /// \return number of time bins
+  virtual Int_t updatePad(const CRU& cru, const Int_t rowInRegion, const Int_t roc, const Int_t row, const Int_t pad,
+                          const gsl::span<const uint32_t> data, const Int_t stride);
+
   /// add GBT frame container to process
   void addGBTFrameContainer(GBTFrameContainer* cont) { mGBTFrameContainers.push_back(std::unique_ptr<GBTFrameContainer>(cont)); }
 
@@ -620,15 +635,19 @@ inline Int_t CalibRawBase::update(const PadROCPos& padROCPos, const CRU& cru, co
 
   // const FECInfo& fecInfo = mMapper.getFECInfo(padROCPos);
   const int roc = padROCPos.getROC();
-  int timeBin = 0;
-  // for (const auto& signalI : data) {
   // for the moment data of all 16 channels are passed, starting with the present channel
-  for (int i = 0; i < data.size(); i += 16) {
+  return updatePad(cru, rowInRegion, roc, row + rowOffset, pad, data, 16);
+}
+
+//______________________________________________________________________________
+inline Int_t CalibRawBase::updatePad(const CRU& cru, const Int_t rowInRegion, const Int_t roc, const Int_t row, const Int_t pad,
+                                     const gsl::span<const uint32_t> data, const Int_t stride)
+{
+  int timeBin = 0;
+  for (size_t i = 0; i < data.size(); i += stride) {
     const float signal = float(data[i]);
-    // printf("Call update: %d, %d (%d), %d, %d, %.3f -- cru: %03d, reg: %02d -- FEC: %02d, Chip: %02d, Chn: %02d\n", roc, row, rowOffset, pad, timeBin, signal, cru.number(), cru.region(), fecInfo.getIndex(), fecInfo.getSampaChip(), fecInfo.getSampaChannel());
-    //  TODO: To be implemented
     updateCRU(cru, rowInRegion, pad, timeBin, signal);
-    updateROC(roc, row + rowOffset, pad, timeBin, signal);
+    updateROC(roc, row, pad, timeBin, signal);
     ++timeBin;
   }
   return timeBin;
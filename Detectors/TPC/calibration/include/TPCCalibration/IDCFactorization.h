@@ -245,6 +245,14 @@ class IDCFactorization : public IDCGroupHelperSector
   /// \param timeframe time frame of the IDCs
   void setIDCs(std::vector<float>&& idcs, const unsigned int cru, const unsigned int timeframe) { mIDCs[cru][timeframe] = std::move(idcs); }
 
+  /// set the IDC data and directly add them to the running sums of I_0 of the CRU, which avoids the additional pass over all stored IDCs in factorizeIDCs()
+  /// this function can be called concurrently for different CRUs. Do not mix with setIDCs() in the same aggregation interval
+  /// \param idcs vector containing the IDCs
+  /// \param cru CRU
+  /// \param timeframe time frame of the IDCs
+  /// \param norm normalize IDCs to pad area (should be the same value as used for factorizeIDCs())
+  void addIDCs(std::vector<float>&& idcs, const unsigned int cru, const unsigned int timeframe, const bool norm);
+
   /// set the number of threads used for some of the calculations
   /// \param nThreads number of threads
   static void setNThreads(const int nThreads) { sNThreads = nThreads; }
@@ -426,6 +434,8 @@ class IDCFactorization : public IDCGroupHelperSector
   std::vector<unsigned int> mIntegrationIntervalsPerTF{};           ///< storage of integration intervals per TF (taken dropped TFs into account)
   long mTimeStamp{0};                                               ///< first time stamp of IDCs
   int mRun{0};                                                      ///< run number of IDCs
+  std::array<std::vector<float>, CRU::MaxCRU> mIDCZeroSum{};        ///<! running sums of the IDCs per CRU used for the incremental calculation of I_0
+  std::array<bool, CRU::MaxCRU> mIDCsNormalized{};                  ///<! flag per CRU if the IDCs have been normalized to pad area in addIDCs()
 
   /// helper function for drawing IDCDelta
   void drawIDCDeltaHelper(const bool type, const Sector sector, const unsigned int integrationInterval, const IDCDeltaCompression compression, const std::string filename, const float minZ, const float maxZ) const;
@@ -455,6 +465,15 @@ class IDCFactorization : public IDCGroupHelperSector
   /// \return returns true if all IDCs have same size
   bool checkReceivedIDCs();
 
+  /// \return returns true if the IDCs have been added with addIDCs()
+  bool isIDCZeroIncremental() const;
+
+  /// calculate I_0 from the running sums filled in addIDCs()
+  void calcIDCZeroFromSums();
+
+  /// \return returns memory in bytes which is used for the stored IDCs
+  size_t getIDCsMemorySize() const;
+
   ClassDefNV(IDCFactorization, 2)
 };
 
@@ -12,6 +12,7 @@
 /// \file   CalibPedestal.cxx
 /// \author Jens Wiechula, Jens.Wiechula@ikf.uni-frankfurt.de
 
+#include <algorithm>
 #include <fmt/format.h>
 
 #include "TH2F.h"
@@ -77,6 +78,31 @@ Int_t CalibPedestal::updateROC(const Int_t roc, const Int_t row, const Int_t pad
   return 0;
 }
 
+//______________________________________________________________________________
+Int_t CalibPedestal::updatePad(const CRU& cru, const Int_t rowInRegion, const Int_t roc, const Int_t row, const Int_t pad,
+                               const gsl::span<const uint32_t> data, const Int_t stride)
+{
+  const Int_t nTimeBins = (data.size() + stride - 1) / stride;
+  const Int_t firstTimeBin = std::max(mFirstTimeBin, 0);
+  const Int_t lastTimeBin = std::min(mLastTimeBin, nTimeBins - 1);
+  if (firstTimeBin > lastTimeBin) {
+    return nTimeBins;
+  }
+
+  const GlobalPadNumber padInROC = mMapper.getPadNumberInROC(PadROCPos(roc, row, pad));
+  float* adcHist = getVector(ROC(roc), kTRUE)->data() + padInROC * mNumberOfADCs;
+  const uint32_t* adc = data.data();
+  for (Int_t timeBin = firstTimeBin; timeBin <= lastTimeBin; ++timeBin) {
+    // the unsigned difference also rejects values below mADCMin
+    const uint32_t bin = adc[timeBin * stride] - uint32_t(mADCMin);
+    if (bin < uint32_t(mNumberOfADCs)) {
+      ++adcHist[bin];
+    }
+  }
+
+  return nTimeBins;
+}
+
 //______________________________________________________________________________
 CalibPedestal::vectorType* CalibPedestal::getVector(ROC roc, bool create /*=kFALSE*/)
 {
@@ -98,19 +124,27 @@ CalibPedestal::vectorType* CalibPedestal::getVector(ROC roc, bool create /*=kFAL
 //______________________________________________________________________________
 void CalibPedestal::analyse()
 {
-  ROC roc;
+  CalPad& calPedestal = mCalDets["Pedestals"];
+  CalPad& calNoise = mCalDets["Noise"];
 
-  std::vector<float> fitValues;
+  // the Gaus fits use static ROOT objects, only the statistics calculation can run in parallel
+  const int nThreads = (mStatisticsType == StatisticsType::MeanStdDev) ? sNThreads : 1;
 
-  for (auto& vecPtr : mADCdata) {
-    auto vec = vecPtr.get();
+  // only used in the serial case, the parameters are initialised by each fit
+  TF1 fg("fg", "gaus");
+  fg.SetRange(mADCMin - 0.5f, mADCMax + 1.5f);
+
+#pragma omp parallel for num_threads(nThreads) schedule(dynamic)
+  for (int iroc = 0; iroc < int(mADCdata.size()); ++iroc) {
+    auto vec = mADCdata[iroc].get();
     if (!vec) {
-      ++roc;
       continue;
     }
+    const ROC roc(iroc);
+    std::vector<float> fitValues;
 
-    CalROC& calROCPedestal = mCalDets["Pedestals"].getCalArray(roc);
-    CalROC& calROCNoise = mCalDets["Noise"].getCalArray(roc);
+    CalROC& calROCPedestal = calPedestal.getCalArray(roc);
+    CalROC& calROCNoise = calNoise.getCalArray(roc);
 
     float* array = vec->data();
 
@@ -119,9 +153,6 @@ void CalibPedestal::analyse()
     float pedestal{};
     float noise{};
 
-    TF1 fg("fg", "gaus");
-    fg.SetRange(mADCMin - 0.5f, mADCMax + 1.5f);
-
     for (Int_t ichannel = 0; ichannel < numberOfPads; ++ichannel) {
       size_t offset = ichannel * mNumberOfADCs;
       if (mStatisticsType == StatisticsType::GausFit) {
@@ -144,8 +175,6 @@ void CalibPedestal::analyse()
 
       // printf("roc: %2d, channel: %4d, pedestal: %.2f, noise: %.2f\n", roc.getRoc(), ichannel, pedestal, noise);
     }
-
-    ++roc;
   }
 }
 
@@ -136,6 +136,48 @@ Int_t CalibPulser::updateROC(const Int_t roc, const Int_t row, const Int_t pad,
   return 1;
 }
 
+//______________________________________________________________________________
+Int_t CalibPulser::updatePad(const CRU& cru, const Int_t rowInRegion, const Int_t roc, const Int_t row, const Int_t pad,
+                             const gsl::span<const uint32_t> data, const Int_t stride)
+{
+  const Int_t nTimeBins = (data.size() + stride - 1) / stride;
+  const Int_t firstTimeBin = std::max(mFirstTimeBin, 0);
+  const Int_t lastTimeBin = std::min(mLastTimeBin, nTimeBins - 1);
+  if (firstTimeBin > lastTimeBin) {
+    return nTimeBins;
+  }
+
+  // ---| pedestal subtraction |---
+  const float pedestal = mPedestal ? mPedestal->getValue(ROC(roc), row, pad) : 0.f;
+
+  // the pad data are only created if there is at least one signal in range
+  VectorType* adcData = nullptr;
+  auto& timeBinEntries = mTimeBinEntries[roc];
+
+  for (Int_t timeBin = firstTimeBin; timeBin <= lastTimeBin; ++timeBin) {
+    const float signal = float(data[timeBin * stride]) - pedestal;
+    if (signal < mADCMin || signal > mADCMax) {
+      continue;
+    }
+
+    if (!adcData) {
+      adcData = &mPulserData[PadROCPos(roc, row, pad)];
+      if (!adcData->size()) {
+        // accept first and last time bin, so difference +1
+        adcData->resize(mLastTimeBin - mFirstTimeBin + 1);
+      }
+      if (!timeBinEntries.size()) {
+        timeBinEntries.resize(mLastTimeBin - mFirstTimeBin + 1);
+      }
+    }
+
+    (*adcData)[timeBin - mFirstTimeBin] = signal;
+    ++timeBinEntries[timeBin - mFirstTimeBin];
+  }
+
+  return nTimeBins;
+}
+
 //______________________________________________________________________________
 void CalibPulser::endReader()
 {
@@ -275,7 +317,13 @@ void CalibPulser::resetData()
 //______________________________________________________________________________
 void CalibPulser::analyse()
 {
-  for (ROC roc; !roc.looped(); ++roc) {
+  CalPad& calT0 = mCalDets["T0"];
+  CalPad& calWidth = mCalDets["Width"];
+  CalPad& calQtot = mCalDets["Qtot"];
+
+#pragma omp parallel for num_threads(sNThreads) schedule(dynamic)
+  for (int iroc = 0; iroc < int(ROC::MaxROC); ++iroc) {
+    const ROC roc(iroc);
     auto histT0 = mT0Histograms.at(roc).get();
     auto histWidth = mWidthHistograms.at(roc).get();
     auto histQtot = mQtotHistograms.at(roc).get();
@@ -299,9 +347,9 @@ void CalibPulser::analyse()
       StatisticsData dataWidth = getStatisticsData(arrWidth + offsetWidth, mNbinsWidth, mXminWidth, mXmaxWidth);
       StatisticsData dataQtot = getStatisticsData(arrQtot + offsetQtot, mNbinsQtot, mXminQtot, mXmaxQtot);
 
-      mCalDets["T0"].getCalArray(roc).setValue(iChannel, dataT0.mCOG);
-      mCalDets["Width"].getCalArray(roc).setValue(iChannel, dataWidth.mCOG);
-      mCalDets["Qtot"].getCalArray(roc).setValue(iChannel, dataQtot.mCOG);
+      calT0.getCalArray(roc).setValue(iChannel, dataT0.mCOG);
+      calWidth.getCalArray(roc).setValue(iChannel, dataWidth.mCOG);
+      calQtot.getCalArray(roc).setValue(iChannel, dataQtot.mCOG);
     }
   }
 }
@@ -18,6 +18,7 @@
 #include "TFile.h"
 #include "TPCBase/CalDet.h"
 #include <functional>
+#include <algorithm>
 #include "MemoryResources/MemoryResources.h"
 #include "CommonConstants/LHCConstants.h"
 #include "TKey.h"
@@ -288,6 +289,80 @@ void o2::tpc::IDCFactorization::calcIDCZero(const bool norm)
   }
 }
 
+void o2::tpc::IDCFactorization::addIDCs(std::vector<float>&& idcs, const unsigned int cru, const unsigned int timeframe, const bool norm)
+{
+  const unsigned int region = CRU(cru).region();
+  const unsigned int nIDCsCRU = mNIDCsPerCRU[region];
+  auto& idcZeroSum = mIDCZeroSum[cru];
+  if (idcZeroSum.empty()) {
+    idcZeroSum.resize(nIDCsCRU);
+  }
+
+  // remove contribution of IDCs which might have been received already for this TF
+  auto& idcsOld = mIDCs[cru][timeframe];
+  for (unsigned int i = 0; i < idcsOld.size(); ++i) {
+    if ((idcsOld[i] == -1) || (idcsOld[i] == 0)) {
+      continue;
+    }
+    idcZeroSum[i % nIDCsCRU] -= idcsOld[i];
+  }
+
+  for (unsigned int i = 0; i < idcs.size(); ++i) {
+    if ((idcs[i] == -1) || (idcs[i] == 0)) {
+      continue;
+    }
+    if (norm) {
+      idcs[i] *= Mapper::INVPADAREA[region];
+    }
+    idcZeroSum[i % nIDCsCRU] += idcs[i];
+  }
+  mIDCsNormalized[cru] = norm;
+  idcsOld = std::move(idcs);
+}
+
+bool o2::tpc::IDCFactorization::isIDCZeroIncremental() const
+{
+  return std::any_of(mCRUs.begin(), mCRUs.end(), [this](const auto cru) { return !mIDCZeroSum[cru].empty(); });
+}
+
+void o2::tpc::IDCFactorization::calcIDCZeroFromSums()
+{
+  const unsigned int nIDCsSide = mNIDCsPerSector * o2::tpc::SECTORSPERSIDE;
+  for (auto& idcZero : mIDCZero) {
+    idcZero.clear();
+    idcZero.resize(nIDCsSide);
+  }
+
+#pragma omp parallel for num_threads(sNThreads)
+  for (unsigned int cruInd = 0; cruInd < mCRUs.size(); ++cruInd) {
+    const unsigned int cru = mCRUs[cruInd];
+    const o2::tpc::CRU cruTmp(cru);
+    const auto side = cruTmp.side();
+    const unsigned int region = cruTmp.region();
+    const auto indexStart = mRegionOffs[region] + mNIDCsPerSector * (cruTmp.sector() % o2::tpc::SECTORSPERSIDE);
+
+    const auto normFac = getNIntegrationIntervals(cru);
+    if ((normFac == 0) || mIDCZeroSum[cru].empty()) {
+      LOGP(info, "number of integration intervals is zero for CRU {}! Skipping normalization of IDC0", cru);
+      continue;
+    }
+
+    std::transform(mIDCZeroSum[cru].begin(), mIDCZeroSum[cru].end(), mIDCZero[mSideIndex[side]].mIDCZero.begin() + indexStart, [normVal = normFac](const auto val) { return val / normVal; });
+  }
+}
+
+size_t o2::tpc::IDCFactorization::getIDCsMemorySize() const
+{
+  size_t size = 0;
+  for (const auto cru : mCRUs) {
+    for (const auto& idcs : mIDCs[cru]) {
+      size += idcs.capacity() * sizeof(float);
+    }
+    size += mIDCZeroSum[cru].capacity() * sizeof(float);
+  }
+  return size;
+}
+
 void o2::tpc::IDCFactorization::fillIDCZeroDeadPads()
 {
 #pragma omp parallel for num_threads(sNThreads)
@@ -851,13 +926,28 @@ void o2::tpc::IDCFactorization::factorizeIDCs(const bool norm, const bool calcDe
   using timer = std::chrono::high_resolution_clock;
 
   LOGP(info, "Using {} threads for factorization of IDCs", sNThreads);
+  LOGP(info, "Memory used by stored IDCs: {:.2f} MB", getIDCsMemorySize() / (1024. * 1024.));
   LOGP(info, "Checking received IDCs for consistency");
-  checkReceivedIDCs();
+  const bool idcsGood = checkReceivedIDCs();
 
-  LOGP(info, "Calculating IDC0");
+  const bool incremental = isIDCZeroIncremental();
+  LOGP(info, "Calculating IDC0{}", incremental ? " from running sums" : "");
 
   auto start = timer::now();
-  calcIDCZero(norm);
+  if (!incremental) {
+    calcIDCZero(norm);
+  } else {
+    if (norm != mIDCsNormalized[mCRUs.front()]) {
+      LOGP(warning, "IDCs were added with norm={}, but factorization is requested with norm={}. Using the normalization of the added IDCs", mIDCsNormalized[mCRUs.front()], norm);
+    }
+    if (idcsGood) {
+      calcIDCZeroFromSums();
+    } else {
+      // some IDCs have been cleared: running sums are invalid. IDCs are already normalized
+      LOGP(info, "Recalculating IDC0 from stored IDCs");
+      calcIDCZero(false);
+    }
+  }
   auto stop = timer::now();
   std::chrono::duration<float> time = stop - start;
   float totalTime = time.count();
@@ -984,6 +1074,9 @@ void o2::tpc::IDCFactorization::reset()
       idcs.clear();
     }
   }
+  for (auto& idcZeroSum : mIDCZeroSum) {
+    idcZeroSum.clear();
+  }
 }
 
 void o2::tpc::IDCFactorization::drawIDCDeltaHelper(const bool type, const Sector sector, const unsigned int integrationInterval, const IDCDeltaCompression compression, const std::string filename, const float minZ, const float maxZ) const
@@ -0,0 +1,110 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file  testO2TPCCalibPedestal.cxx
+/// \brief this task tests that the per pad update and the parallel analysis
+///        of the pedestal calibration give the same result as the per time bin update
+
+#define BOOST_TEST_MODULE Test TPC O2TPCCalibPedestal class
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "TPCBase/Mapper.h"
+#include "TPCCalibration/CalibPedestal.h"
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+namespace o2
+{
+namespace tpc
+{
+
+static constexpr int NTIMEBINS = 60;                 // number of time bins per pad
+static constexpr int NCHANNELS = 16;                 // channels interleaved in the raw data, as in CalibRawBase::update
+static constexpr std::array<int, 3> ROCS{0, 13, 40}; // IROCs and OROC which are filled
+static constexpr int NTHREADS = 4;                   // number of threads of the parallel analysis
+
+// fill the pedestal calibrations with the same random ADC values,
+// through the per pad update for 'perPad' and through the per time bin update for 'perTimeBin'
+void fill(CalibPedestal& perPad, CalibPedestal& perTimeBin)
+{
+  const auto& mapper = Mapper::instance();
+  std::mt19937 gen(1234);
+  std::normal_distribution<float> adc(70.f, 5.f);
+  std::uniform_int_distribution<int> outlier(0, 50);
+  std::vector<uint32_t> data(NTIMEBINS * NCHANNELS);
+
+  for (const int iroc : ROCS) {
+    const ROC roc(iroc);
+    // only the ROC is used by the pedestal calibration, the region of the CRU does not matter
+    const CRU cru(roc.getSector(), roc.isIROC() ? 0 : 4);
+    for (int row = 0; row < mapper.getNumberOfRowsROC(roc); ++row) {
+      for (int pad = 0; pad < mapper.getNumberOfPadsInRowROC(iroc, row); ++pad) {
+        for (auto& value : data) {
+          // values out of the ADC range, also 0 which is below it, must be skipped
+          const int o = outlier(gen);
+          value = o == 0 ? 0 : (o == 1 ? 1000 : uint32_t(std::max(0.f, adc(gen))));
+        }
+        perPad.update(PadROCPos(iroc, row, pad), cru, data);
+        // updateROC applies the time bin range itself
+        for (int timeBin = 0; timeBin < NTIMEBINS; ++timeBin) {
+          perTimeBin.updateROC(iroc, row, pad, timeBin, float(data[timeBin * NCHANNELS]));
+        }
+      }
+    }
+  }
+}
+
+void checkEqual(const CalPad& calPad1, const CalPad& calPad2)
+{
+  for (const int iroc : ROCS) {
+    const auto& calROC1 = calPad1.getCalArray(iroc);
+    const auto& calROC2 = calPad2.getCalArray(iroc);
+    BOOST_REQUIRE_EQUAL(calROC1.getData().size(), calROC2.getData().size());
+    for (size_t channel = 0; channel < calROC1.getData().size(); ++channel) {
+      BOOST_CHECK_EQUAL(calROC1.getValue(channel), calROC2.getValue(channel));
+    }
+  }
+}
+
+void testTimeBinRange(int firstTimeBin, int lastTimeBin)
+{
+  CalibPedestal perPad, perTimeBin;
+  for (auto calib : {&perPad, &perTimeBin}) {
+    calib->setTimeBinRange(firstTimeBin, lastTimeBin);
+    calib->setStatisticsType(StatisticsType::MeanStdDev);
+  }
+  fill(perPad, perTimeBin);
+
+  CalibPedestal::setNThreads(NTHREADS);
+  perPad.analyse();
+  CalibPedestal::setNThreads(1);
+  perTimeBin.analyse();
+
+  checkEqual(perPad.getPedestal(), perTimeBin.getPedestal());
+  checkEqual(perPad.getNoise(), perTimeBin.getNoise());
+}
+
+BOOST_AUTO_TEST_CASE(CalibPedestal_updatePad_test)
+{
+  testTimeBinRange(10, 40);
+}
+
+BOOST_AUTO_TEST_CASE(CalibPedestal_timeBinRangeOutOfData_test)
+{
+  // the time bin range exceeds the data on both sides
+  testTimeBinRange(-5, NTIMEBINS + 10);
+}
+
+} // namespace tpc
+} // namespace o2
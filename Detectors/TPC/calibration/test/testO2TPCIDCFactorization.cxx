@@ -0,0 +1,91 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file  testO2TPCIDCFactorization.cxx
+/// \brief this task tests the incremental calculation of IDC0 by comparing it to the calculation from the stored IDCs
+
+#define BOOST_TEST_MODULE Test TPC O2TPCIDCFactorization class
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "TPCCalibration/IDCFactorization.h"
+#include "Framework/Logger.h"
+#include "TRandom.h"
+#include <chrono>
+#include <numeric>
+
+namespace o2::tpc
+{
+
+static constexpr float TOLERANCE = 0.001f; // relative tolerance between IDC0 from running sums and IDC0 from stored IDCs
+
+std::vector<float> getIDCs(const unsigned int region, const unsigned int integrationIntervals)
+{
+  std::vector<float> idcs(Mapper::PADSPERREGION[region] * integrationIntervals);
+  for (auto& val : idcs) {
+    // dead pads are marked with -1
+    val = (gRandom->Rndm() < 0.01) ? -1 : gRandom->Gaus(10, 2);
+  }
+  return idcs;
+}
+
+BOOST_AUTO_TEST_CASE(IDCFactorizationIncrementalIDCZero_test)
+{
+  using timer = std::chrono::high_resolution_clock;
+  const unsigned int tfs = 20;                  // number of aggregated TFs
+  const unsigned int integrationIntervals = 10; // number of integration intervals per TF
+  gRandom->SetSeed(1);
+
+  std::vector<uint32_t> crus(CRU::MaxCRU);
+  std::iota(crus.begin(), crus.end(), 0);
+  IDCFactorization::setNThreads(2);
+
+  IDCFactorization idcsFull(tfs, 1, crus);
+  IDCFactorization idcsIncremental(tfs, 1, crus);
+  float timeAdd = 0;
+  for (unsigned int tf = 0; tf < tfs; ++tf) {
+    for (const auto cru : crus) {
+      const auto region = CRU(cru).region();
+      auto idcs = getIDCs(region, integrationIntervals + (tf % 3 == 0));
+      idcsFull.setIDCs(std::vector<float>(idcs), cru, tf);
+      const auto start = timer::now();
+      idcsIncremental.addIDCs(std::move(idcs), cru, tf, true);
+      timeAdd += std::chrono::duration<float>(timer::now() - start).count();
+    }
+  }
+
+  auto start = timer::now();
+  idcsFull.factorizeIDCs(true, false);
+  const std::chrono::duration<float> timeFull = timer::now() - start;
+
+  start = timer::now();
+  idcsIncremental.factorizeIDCs(true, false);
+  const std::chrono::duration<float> timeIncremental = timer::now() - start;
+  LOGP(info, "factorization time: full {}s, incremental {}s (+{}s spread over receiving the IDCs)", timeFull.count(), timeIncremental.count(), timeAdd);
+
+  for (auto side : idcsFull.getSides()) {
+    const auto& idcZeroFull = idcsFull.getIDCZeroVec(side);
+    const auto& idcZeroIncremental = idcsIncremental.getIDCZeroVec(side);
+    BOOST_REQUIRE(idcZeroFull.size() == idcZeroIncremental.size());
+    for (unsigned int i = 0; i < idcZeroFull.size(); ++i) {
+      BOOST_CHECK_CLOSE(idcZeroFull[i], idcZeroIncremental[i], TOLERANCE);
+    }
+
+    const auto& idcOneFull = idcsFull.getIDCOneVec(side);
+    const auto& idcOneIncremental = idcsIncremental.getIDCOneVec(side);
+    BOOST_REQUIRE(idcOneFull.size() == idcOneIncremental.size());
+    for (unsigned int i = 0; i < idcOneFull.size(); ++i) {
+      BOOST_CHECK_CLOSE(idcOneFull[i], idcOneIncremental[i], TOLERANCE);
+    }
+  }
+}
+
+} // namespace o2::tpc
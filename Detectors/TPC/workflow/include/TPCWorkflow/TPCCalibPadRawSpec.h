@@ -92,6 +92,7 @@ class TPCCalibPedestalDevice : public o2::framework::Task
     mDirectFileDump = ic.options().get<bool>("direct-file-dump");
     mSyncOffsetReference = ic.options().get<uint32_t>("sync-offset-reference");
     mDecoderType = ic.options().get<uint32_t>("decoder-type");
+    T::setNThreads(ic.options().get<int>("nthreads-analysis"));
     if (mUseOldSubspec) {
       LOGP(info, "Using old subspecification (CruId << 16) | ((LinkId + 1) << (CruEndPoint == 1 ? 8 : 0))");
     }
@@ -260,6 +261,7 @@ DataProcessorSpec getTPCCalibPadRawSpec(const std::string inputSpec, uint32_t il
       {"direct-file-dump", VariantType::Bool, false, {"directly dump calibration to file"}},
       {"sync-offset-reference", VariantType::UInt32, 144u, {"Reference BCs used for the global sync offset in the CRUs"}},
       {"decoder-type", VariantType::UInt32, 1u, {"Decoder to use: 0 - TPC, 1 - GPU"}},
+      {"nthreads-analysis", VariantType::Int, 1, {"Number of threads used to analyse the ROCs"}},
     } // end Options
   };  // end DataProcessorSpec
 }
@@ -64,6 +64,7 @@ class TPCFactorizeIDCSpec : public o2::framework::Task
     mDumpIDCDelta = ic.options().get<bool>("dump-IDCDelta");
     mDumpIDCDeltaCalibData = ic.options().get<bool>("dump-IDCDelta-calib-data");
     mDumpIDCs = ic.options().get<bool>("dump-IDCs");
+    mIncrementalIDCZero = ic.options().get<bool>("incremental-IDC0");
     mOffsetCCDB = ic.options().get<bool>("add-offset-for-CCDB-timestamp");
     mDisableIDCDelta = ic.options().get<bool>("disable-IDCDelta");
     mCalibFileDir = ic.options().get<std::string>("output-dir");
@@ -134,7 +135,11 @@ class TPCFactorizeIDCSpec : public o2::framework::Task
 
       auto const* tpcCRUHeader = o2::framework::DataRefUtils::getHeader<o2::header::DataHeader*>(ref);
       const unsigned int cru = tpcCRUHeader->subSpecification;
-      mIDCFactorization.setIDCs(std::move(data), cru, relTF);
+      if (mIncrementalIDCZero) {
+        mIDCFactorization.addIDCs(std::move(data), cru, relTF, true);
+      } else {
+        mIDCFactorization.setIDCs(std::move(data), cru, relTF);
+      }
     }
 
     if (mProcessedCRUs == mCRUs.size() * mIDCFactorization.getNTimeframes()) {
@@ -188,6 +193,7 @@ class TPCFactorizeIDCSpec : public o2::framework::Task
   bool mDumpIDCDelta{false};                        ///< Dump IDCDelta to file
   bool mDumpIDCDeltaCalibData{false};               ///< dump the IDC Delta as a calibration file
   bool mDumpIDCs{false};                            ///< dump IDCs to file
+  bool mIncrementalIDCZero{false};                  ///< accumulate IDC0 when receiving the IDCs instead of during the factorization
   bool mOffsetCCDB{false};                          ///< flag for setting and offset for CCDB timestamp
   bool mDisableIDCDelta{false};                     ///< disable the processing and storage of IDCDelta
   dataformats::Pair<long, int> mTFInfo{};           ///< orbit reset time for CCDB time stamp writing
@@ -495,6 +501,7 @@ DataProcessorSpec getTPCFactorizeIDCSpec(const int lane, const std::vector<uint3
             {"enableWritingPadStatusMap", VariantType::Bool, false, {"Write the pad status map to CCDB."}},
             {"orbits-IDCs", VariantType::Int, 12, {"Number of orbits over which the IDCs are integrated."}},
             {"dump-IDCs", VariantType::Bool, false, {"Dump IDCs to file"}},
+            {"incremental-IDC0", VariantType::Bool, false, {"Accumulate IDC0 when receiving the IDCs to reduce the processing time of the factorization (dumped IDCs are normalized to pad area)"}},
             {"dump-IDC0", VariantType::Bool, false, {"Dump IDC0 to file"}},
             {"dump-IDC1", VariantType::Bool, false, {"Dump IDC1 to file"}},
             {"disable-IDCDelta", VariantType::Bool, false, {"Disable processing of IDCDelta and storage in the CCDB"}},
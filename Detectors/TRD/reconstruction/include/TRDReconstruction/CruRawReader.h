@@ -22,6 +22,8 @@
 #include <set>
 #include <utility>
 #include <array>
+#include <memory>
+#include <vector>
 #include "Headers/RAWDataHeader.h"
 #include "Headers/RDHAny.h"
 #include "DetectorsRaw/RDHUtils.h"
@@ -89,6 +91,22 @@ class CruRawReader
   // set the mapping from Link ID to HCID and vice versa
   void setLinkMap(const LinkToHCIDMapping* map) { mLinkMap = map; }
 
+  // number of threads used by processInputs(), a negative number means all available threads
+  void setNThreads(int n) { mNThreads = n; }
+
+  // add an input buffer (e.g. the data of one half-CRU for the whole TF) to be parsed by processInputs()
+  void addInput(const char* data, long size) { mInputs.push_back({data, size}); }
+
+  // parse all inputs added with addInput(), equivalent to calling run() for each of them in the given order.
+  // With more than one thread the inputs are parsed concurrently by separate readers into their own EventRecords,
+  // which are merged afterwards in the order of the inputs, so that the output and the statistics are identical
+  // to the serial parsing. In case the parsing of one input depended on the state left by the previous inputs
+  // (number of time bins or SVN version from the DigitHCHeaders changing inside the TF) everything is parsed
+  // again serially.
+  void processInputs();
+
+  const EventRecordContainer& getEventRecords() const { return mEventRecords; }
+
   // assemble output for full TF and send it out
   void buildDPLOutputs(o2::framework::ProcessingContext& outputs);
 
@@ -151,6 +169,39 @@ class CruRawReader
   void printHalfChamberHeaderReport() const;
 
  private:
+  struct InputBuffer {
+    const char* data;
+    long size;
+  };
+
+  // the part of the parsing state which is carried from one input to the next
+  struct CarriedState {
+    uint16_t timeBins{constants::TIMEBINS};
+    bool haveSeenDigitHCHeader3{false};
+    uint32_t svnver{0};
+    uint32_t svnrver{0};
+  };
+
+  // result of parsing one input with a separate reader
+  struct ParsedInput {
+    std::vector<EventRecord> eventRecords;
+    int worker{0};                     // index of the reader which parsed the input
+    size_t parsingErrorsFirst{0};      // range of the input in the reader's parsing errors by link
+    size_t parsingErrorsLast{0};       // end of the range
+    bool timeBinsFromHeader{false};    // the number of time bins was set by a DigitHCHeader1
+    bool inheritedTimeBinsUsed{false}; // digits were parsed before the number of time bins was set by a DigitHCHeader1
+    uint16_t timeBins{0};              // number of time bins at the end of the input
+    bool digitHCHeader3Seen{false};    // a DigitHCHeader3 was found in the input
+    uint32_t svnver{0};                // SVN version of the first DigitHCHeader3 of the input
+    uint32_t svnrver{0};               // SVN release version of the first DigitHCHeader3 of the input
+  };
+
+  CarriedState getCarriedState() const;
+  void setCarriedState(const CarriedState& state);
+
+  // parse a single input starting from the given state, the result is moved out of the reader
+  void parseInput(const InputBuffer& input, const CarriedState& state, ParsedInput& result);
+
   // these variables are configured externally
   int mTrackletHCHeaderState{0};
   int mHalfChamberWords{0};
@@ -179,6 +230,11 @@ class CruRawReader
   bool mHaveSeenDigitHCHeader3{false};     // flag, whether we can compare an incoming DigitHCHeader3 with a header we have seen before
   uint32_t mPreviousDigitHCHeadersvnver;  // svn ver in the digithalfchamber header, used for validity checks
   uint32_t mPreviousDigitHCHeadersvnrver; // svn release ver also used for validity checks
+  bool mTimeBinsFromHeader{false};        // the number of time bins was set by a DigitHCHeader1 since the last setCarriedState()
+  bool mInheritedTimeBinsUsed{false};     // digits were parsed before that
+  bool mFirstDigitHCHeader3Seen{false};   // a DigitHCHeader3 was seen since the last setCarriedState()
+  uint32_t mFirstDigitHCHeader3svnver{0}; // and its svn ver
+  uint32_t mFirstDigitHCHeader3svnrver{0};
   uint8_t mPreTriggerPhase = 0;           // Pre trigger phase of the adcs producing the digits, its comes from an optional DigitHCHeader
                                           // It is stored here to carry it around after parsing it from the DigitHCHeader1 if it exists in the data.
   uint16_t mCRUEndpoint; // the upper or lower half of the currently parsed cru 0-14 or 15-29
@@ -204,6 +260,10 @@ class CruRawReader
   uint32_t mWordsRejected = 0;         // those words rejected before tracklet and digit parsing could start
 
   EventRecordContainer mEventRecords; // store data range indexes into the above vectors.
+
+  int mNThreads{1};                                   // number of threads for processInputs()
+  std::vector<InputBuffer> mInputs;                   // inputs to be parsed by processInputs()
+  std::vector<std::unique_ptr<CruRawReader>> mWorkers; // readers for the parallel parsing, one per thread
 };
 
 } // namespace o2::trd
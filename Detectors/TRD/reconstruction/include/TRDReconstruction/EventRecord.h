@@ -59,6 +59,9 @@ class EventRecord
   // sort the tracklets (and optionally digits) by detector, pad row, pad column
   void sortData(bool sortDigits);
 
+  // append the data and add the counters of another EventRecord for the same bunch crossing
+  void merge(EventRecord&& other);
+
   void incTrackletTime(float timeadd) { mTimeTakenForTracklets += timeadd; }
   void incDigitTime(float timeadd) { mTimeTakenForDigits += timeadd; }
   void incTime(float duration) { mTimeTaken += duration; }
@@ -88,6 +91,19 @@ class EventRecordContainer
 
   void setCurrentEventRecord(const InteractionRecord& ir);
   EventRecord& getCurrentEventRecord() { return mEventRecords.at(mCurrEventRecord); }
+  const std::vector<EventRecord>& getEventRecords() const { return mEventRecords; }
+  const TRDDataCountersPerTimeFrame& getTFStats() const { return mTFStats; }
+
+  // move the EventRecords out of the container, the statistics are kept
+  std::vector<EventRecord> takeEventRecords();
+  // add an EventRecord, it is merged into the existing one in case the bunch crossing was already seen
+  void addEventRecord(EventRecord&& event);
+  // add the statistics of another container, apart from the parsing errors by link which depend on the order
+  void addStats(const TRDDataCountersPerTimeFrame& stats);
+  void addParsingErrorsByLink(const std::vector<uint32_t>& errors, size_t first, size_t last)
+  {
+    mTFStats.mParsingErrorsByLink.insert(mTFStats.mParsingErrorsByLink.end(), errors.begin() + first, errors.begin() + last);
+  }
 
   // statistics to keep
   void incLinkErrorFlags(int hcid, unsigned int flag) { mTFStats.mLinkErrorFlag[hcid] |= flag; }
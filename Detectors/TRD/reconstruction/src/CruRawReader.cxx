@@ -34,6 +34,11 @@
 #include <string>
 #include <numeric>
 #include <iomanip>
+#include <algorithm>
+
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 
 using namespace o2::trd::constants;
 
@@ -312,6 +317,7 @@ bool CruRawReader::parseDigitHCHeaders(int hcid)
           return false;
         }
         mTimeBins = header1.numtimebins;
+        mTimeBinsFromHeader = true;
         break;
 
       case 2: // header header2;
@@ -344,6 +350,11 @@ bool CruRawReader::parseDigitHCHeaders(int hcid)
         DigitHCHeader3 header3;
         header3.word = headers[headerwordcount];
         headersfound.set(2);
+        if (!mFirstDigitHCHeader3Seen) {
+          mFirstDigitHCHeader3Seen = true;
+          mFirstDigitHCHeader3svnver = header3.svnver;
+          mFirstDigitHCHeader3svnrver = header3.svnrver;
+        }
         if (mHaveSeenDigitHCHeader3) {
           if (header3.svnver != mPreviousDigitHCHeadersvnver || header3.svnrver != mPreviousDigitHCHeadersvnrver) {
             if (mOptions[TRDVerboseErrorsBit]) {
@@ -686,6 +697,10 @@ int CruRawReader::parseDigitLinkData(int maxWords32, int hcid, int& wordsRejecte
   // TODO add check for event counter of DigitMCMHeader?
   // are the counters expected to be the same for all MCMs for one trigger?
 
+  if (!mTimeBinsFromHeader) {
+    mInheritedTimeBinsUsed = true;
+  }
+
   while (wordsRead < maxWords32 && state != StateFinished) {
     uint32_t currWord = mHBFPayload[mHBFoffset32 + wordsRead];
 
@@ -1107,6 +1122,155 @@ void CruRawReader::run()
   }
 };
 
+CruRawReader::CarriedState CruRawReader::getCarriedState() const
+{
+  return CarriedState{mTimeBins, mHaveSeenDigitHCHeader3, mPreviousDigitHCHeadersvnver, mPreviousDigitHCHeadersvnrver};
+}
+
+void CruRawReader::setCarriedState(const CarriedState& state)
+{
+  mTimeBins = state.timeBins;
+  mHaveSeenDigitHCHeader3 = state.haveSeenDigitHCHeader3;
+  mPreviousDigitHCHeadersvnver = state.svnver;
+  mPreviousDigitHCHeadersvnrver = state.svnrver;
+  mTimeBinsFromHeader = false;
+  mInheritedTimeBinsUsed = false;
+  mFirstDigitHCHeader3Seen = false;
+}
+
+void CruRawReader::parseInput(const InputBuffer& input, const CarriedState& state, ParsedInput& result)
+{
+  setCarriedState(state);
+  const auto& parsingErrorsByLink = mEventRecords.getTFStats().mParsingErrorsByLink;
+  result.parsingErrorsFirst = parsingErrorsByLink.size();
+  setDataBuffer(input.data);
+  setDataBufferSize(input.size);
+  run();
+  result.parsingErrorsLast = parsingErrorsByLink.size();
+  result.eventRecords = mEventRecords.takeEventRecords();
+  result.timeBinsFromHeader = mTimeBinsFromHeader;
+  result.inheritedTimeBinsUsed = mInheritedTimeBinsUsed;
+  result.timeBins = mTimeBins;
+  result.digitHCHeader3Seen = mFirstDigitHCHeader3Seen;
+  result.svnver = mFirstDigitHCHeader3svnver;
+  result.svnrver = mFirstDigitHCHeader3svnrver;
+}
+
+void CruRawReader::processInputs()
+{
+  int nThreads = 1;
+#ifdef WITH_OPENMP
+  nThreads = (mNThreads < 0) ? omp_get_max_threads() : mNThreads;
+#endif
+  nThreads = std::min(nThreads, (int)mInputs.size());
+  if (nThreads <= 1) {
+    for (const auto& input : mInputs) {
+      setDataBuffer(input.data);
+      setDataBufferSize(input.size);
+      run();
+    }
+    mInputs.clear();
+    return;
+  }
+
+  while ((int)mWorkers.size() < nThreads) {
+    mWorkers.push_back(std::make_unique<CruRawReader>());
+  }
+  for (int iWorker = 0; iWorker < nThreads; ++iWorker) {
+    auto& worker = *mWorkers[iWorker];
+    worker.mTrackletHCHeaderState = mTrackletHCHeaderState;
+    worker.mHalfChamberWords = mHalfChamberWords;
+    worker.mHalfChamberMajor = mHalfChamberMajor;
+    worker.mOptions = mOptions;
+    worker.mTimeBinsFixed = mTimeBinsFixed;
+    worker.mLinkMap = mLinkMap;
+    worker.mMaxErrsPrinted = mMaxErrsPrinted;
+    worker.mMaxWarnPrinted = mMaxWarnPrinted;
+  }
+
+  const auto initialState = getCarriedState();
+  std::vector<ParsedInput> parsed(mInputs.size());
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(nThreads)
+#endif
+  for (size_t iInput = 0; iInput < mInputs.size(); ++iInput) {
+#ifdef WITH_OPENMP
+    const int iWorker = omp_get_thread_num();
+#else
+    const int iWorker = 0;
+#endif
+    mWorkers[iWorker]->parseInput(mInputs[iInput], initialState, parsed[iInput]);
+    parsed[iInput].worker = iWorker;
+  }
+
+  // every input was parsed starting from the initial state, check that the serial parsing would have used the same
+  auto state = initialState;
+  bool consistent = true;
+  for (const auto& input : parsed) {
+    if (input.inheritedTimeBinsUsed && state.timeBins != initialState.timeBins) {
+      consistent = false;
+    }
+    if (input.timeBinsFromHeader) {
+      state.timeBins = input.timeBins;
+    }
+    if (input.digitHCHeader3Seen) {
+      // SVN version to which the DigitHCHeader3 were compared in the parallel and in the serial parsing
+      const auto refParallel = initialState.haveSeenDigitHCHeader3 ? std::make_pair(initialState.svnver, initialState.svnrver) : std::make_pair(input.svnver, input.svnrver);
+      const auto refSerial = state.haveSeenDigitHCHeader3 ? std::make_pair(state.svnver, state.svnrver) : std::make_pair(input.svnver, input.svnrver);
+      if (refParallel != refSerial) {
+        consistent = false;
+      }
+      if (!state.haveSeenDigitHCHeader3) {
+        state = CarriedState{state.timeBins, true, input.svnver, input.svnrver};
+      }
+    }
+  }
+
+  if (consistent) {
+    for (auto& input : parsed) {
+      for (auto& event : input.eventRecords) {
+        mEventRecords.addEventRecord(std::move(event));
+      }
+      mEventRecords.addParsingErrorsByLink(mWorkers[input.worker]->mEventRecords.getTFStats().mParsingErrorsByLink, input.parsingErrorsFirst, input.parsingErrorsLast);
+    }
+  }
+  int errsPrinted = 0, warnPrinted = 0;
+  for (int iWorker = 0; iWorker < nThreads; ++iWorker) {
+    auto& worker = *mWorkers[iWorker];
+    errsPrinted += mMaxErrsPrinted - worker.mMaxErrsPrinted;
+    warnPrinted += mMaxWarnPrinted - worker.mMaxWarnPrinted;
+    if (consistent) {
+      mEventRecords.addStats(worker.mEventRecords.getTFStats());
+      mTrackletsFound += worker.mTrackletsFound;
+      mDigitsFound += worker.mDigitsFound;
+      mDigitWordsRead += worker.mDigitWordsRead;
+      mDigitWordsRejected += worker.mDigitWordsRejected;
+      mTrackletWordsRead += worker.mTrackletWordsRead;
+      mTrackletWordsRejected += worker.mTrackletWordsRejected;
+      mWordsRejected += worker.mWordsRejected;
+      mHalfChamberHeaderOK.insert(worker.mHalfChamberHeaderOK.begin(), worker.mHalfChamberHeaderOK.end());
+      mHalfChamberMismatches.insert(worker.mHalfChamberMismatches.begin(), worker.mHalfChamberMismatches.end());
+    }
+    worker.reset();
+    worker.mHalfChamberHeaderOK.clear();
+    worker.mHalfChamberMismatches.clear();
+  }
+  mMaxErrsPrinted = std::max(mMaxErrsPrinted - errsPrinted, 0);
+  mMaxWarnPrinted = std::max(mMaxWarnPrinted - warnPrinted, 0);
+
+  if (consistent) {
+    setCarriedState(state);
+  } else {
+    LOG(info) << "DigitHCHeader settings changed within the TF, parsing it again serially";
+    for (const auto& input : mInputs) {
+      setDataBuffer(input.data);
+      setDataBufferSize(input.size);
+      run();
+    }
+  }
+  mInputs.clear();
+}
+
 void CruRawReader::printHalfChamberHeaderReport() const
 {
   LOG(info) << "Listing the half-chambers from which we have seen correct TrackletHCHeaders:";
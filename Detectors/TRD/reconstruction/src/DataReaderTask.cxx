@@ -39,6 +39,7 @@ void DataReaderTask::init(InitContext& ic)
   }
   mReader.configure(mTrackletHCHeaderState, mHalfChamberWords, mHalfChamberMajor, mOptions);
   mProcessEveryNthTF = ic.options().get<int>("every-nth-tf");
+  mReader.setNThreads(ic.options().get<int>("nthreads"));
 }
 
 void DataReaderTask::endOfStream(o2::framework::EndOfStreamContext& ec)
@@ -123,13 +124,12 @@ void DataReaderTask::run(ProcessingContext& pc)
       LOGP(info, "Found input [{}/{}/{:#x}] TF#{} 1st_orbit:{} Payload {} : ",
            dh->dataOrigin.str, dh->dataDescription.str, dh->subSpecification, dh->tfCounter, dh->firstTForbit, payloadInSize);
     }
-    mReader.setDataBuffer(payloadIn);
-    mReader.setDataBufferSize(payloadInSize);
-    mReader.run();
+    mReader.addInput(payloadIn, payloadInSize);
     datasizeInTF += payloadInSize;
-    if (mOptions[TRDVerboseBit]) {
-      LOG(info) << "relevant vectors to read : " << mReader.getTrackletsFound() << " tracklets and " << mReader.getDigitsFound() << " compressed digits";
-    }
+  }
+  mReader.processInputs();
+  if (mOptions[TRDVerboseBit]) {
+    LOG(info) << "relevant vectors to read : " << mReader.getTrackletsFound() << " tracklets and " << mReader.getDigitsFound() << " compressed digits";
   }
 
   mReader.buildDPLOutputs(pc);
@@ -56,6 +56,20 @@ void EventRecord::sortData(bool sortDigits)
   }
 }
 
+void EventRecord::merge(EventRecord&& other)
+{
+  mDigits.insert(mDigits.end(), other.mDigits.begin(), other.mDigits.end());
+  mTracklets.insert(mTracklets.end(), other.mTracklets.begin(), other.mTracklets.end());
+  mTimeTaken += other.mTimeTaken;
+  mTimeTakenForDigits += other.mTimeTakenForDigits;
+  mTimeTakenForTracklets += other.mTimeTakenForTracklets;
+  mIsCalibTrigger |= other.mIsCalibTrigger;
+  for (int hcid = 0; hcid < constants::MAXHALFCHAMBER; ++hcid) {
+    mCounters.mLinkWords[hcid] += other.mCounters.mLinkWords[hcid];
+    mCounters.mLinkErrorFlag[hcid] |= other.mCounters.mLinkErrorFlag[hcid];
+  }
+}
+
 void EventRecordContainer::sendData(o2::framework::ProcessingContext& pc, bool generatestats, bool sortDigits, bool sendLinkStats)
 {
   //at this point we know the total number of tracklets and digits and triggers.
@@ -125,6 +139,44 @@ void EventRecordContainer::setCurrentEventRecord(const InteractionRecord& ir)
   }
 }
 
+std::vector<EventRecord> EventRecordContainer::takeEventRecords()
+{
+  std::vector<EventRecord> events;
+  events.swap(mEventRecords);
+  mCurrEventRecord = 0;
+  return events;
+}
+
+void EventRecordContainer::addEventRecord(EventRecord&& event)
+{
+  for (auto& existing : mEventRecords) {
+    if (existing == event) {
+      existing.merge(std::move(event));
+      return;
+    }
+  }
+  mEventRecords.push_back(std::move(event));
+  mCurrEventRecord = mEventRecords.size() - 1;
+}
+
+void EventRecordContainer::addStats(const TRDDataCountersPerTimeFrame& stats)
+{
+  for (int hcid = 0; hcid < constants::MAXHALFCHAMBER; ++hcid) {
+    mTFStats.mLinkErrorFlag[hcid] |= stats.mLinkErrorFlag[hcid];
+    mTFStats.mLinkNoData[hcid] += stats.mLinkNoData[hcid];
+    mTFStats.mLinkWords[hcid] += stats.mLinkWords[hcid];
+    mTFStats.mLinkWordsRead[hcid] += stats.mLinkWordsRead[hcid];
+    mTFStats.mLinkWordsRejected[hcid] += stats.mLinkWordsRejected[hcid];
+    mTFStats.mParsingOK[hcid] += stats.mParsingOK[hcid];
+  }
+  for (int error = 0; error < TRDLastParsingError; ++error) {
+    mTFStats.mParsingErrors[error] += stats.mParsingErrors[error];
+  }
+  for (size_t version = 0; version < mTFStats.mDataFormatRead.size(); ++version) {
+    mTFStats.mDataFormatRead[version] += stats.mDataFormatRead[version];
+  }
+}
+
 void EventRecordContainer::reset()
 {
   mEventRecords.clear();
@@ -0,0 +1,363 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test TRD CruRawReader
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "TRDReconstruction/CruRawReader.h"
+#include "TRDReconstruction/EventRecord.h"
+#include "DataFormatsTRD/RawData.h"
+#include "DataFormatsTRD/RawDataStats.h"
+#include "DataFormatsTRD/Constants.h"
+#include "DataFormatsTRD/HelperMethods.h"
+#include "DataFormatsCTP/TriggerOffsetsParam.h"
+#include "DetectorsRaw/RDHUtils.h"
+#include "Headers/RAWDataHeader.h"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace o2
+{
+namespace trd
+{
+
+using namespace o2::trd::constants;
+using RDHUtils = o2::raw::RDHUtils;
+
+namespace
+{
+
+// settings for the generated digit data
+struct GeneratorSettings {
+  int timeBins{TIMEBINS};   // number of time bins of the digits
+  bool writeTimeBins{true}; // add a DigitHCHeader1 with the number of time bins
+};
+
+// what the parser is expected to find in the generated data
+struct Expected {
+  int tracklets{0};
+  int digits{0};
+  int corruptMCMHeaders{0};
+};
+
+constexpr int FirstOrbit = 1000;
+constexpr int NOrbits = 2;
+constexpr int CalibrationBC = 2000;
+
+void addTrackletData(std::vector<uint32_t>& words, int hcid, int seed, Expected& expected)
+{
+  TrackletHCHeader hcHeader;
+  constructTrackletHCHeader(hcHeader, hcid, seed & 0x7fff, 0);
+  words.push_back(hcHeader.word);
+  if (seed % 11 == 0) {
+    // MCM header with a missing check bit, skipped by the parser
+    TrackletMCMHeader corrupt;
+    corrupt.word = 0;
+    corrupt.oneb = 1;
+    corrupt.pid0 = corrupt.pid1 = corrupt.pid2 = 0xff;
+    words.push_back(corrupt.word);
+    ++expected.corruptMCMHeaders;
+  }
+  const int nMcms = 1 + seed % 4;
+  for (int iMcm = 0; iMcm < nMcms; ++iMcm) {
+    const int nCpus = 1 + (seed + iMcm) % 3;
+    TrackletMCMHeader mcmHeader;
+    mcmHeader.word = 0;
+    mcmHeader.oneb = 1;
+    mcmHeader.onea = 1;
+    mcmHeader.padrow = iMcm;
+    mcmHeader.col = (seed + iMcm) % 4;
+    mcmHeader.pid0 = (seed + iMcm) & 0x7f;
+    mcmHeader.pid1 = (nCpus > 1) ? (seed + 2 * iMcm) & 0x7f : 0xff;
+    mcmHeader.pid2 = (nCpus > 2) ? (seed + 3 * iMcm) & 0x7f : 0xff;
+    words.push_back(mcmHeader.word);
+    for (int iCpu = 0; iCpu < nCpus; ++iCpu) {
+      TrackletMCMData mcmData;
+      mcmData.word = 0;
+      mcmData.slope = 1 + (seed + iCpu) % 200; // non-zero, so that the word can not be taken for an end marker
+      mcmData.pid = (seed * 3 + iCpu) & 0xfff;
+      mcmData.pos = (seed * 7 + iMcm) & 0x7ff;
+      words.push_back(mcmData.word);
+      ++expected.tracklets;
+    }
+  }
+  words.push_back(TRACKLETENDMARKER);
+  words.push_back(TRACKLETENDMARKER);
+}
+
+void addDigitData(std::vector<uint32_t>& words, int hcid, int seed, const GeneratorSettings& settings, Expected& expected)
+{
+  const int detector = hcid / 2;
+  DigitHCHeader hcHeader;
+  hcHeader.word = 0;
+  hcHeader.res = 0b01;
+  hcHeader.side = hcid % 2;
+  hcHeader.stack = HelperMethods::getStack(detector);
+  hcHeader.layer = HelperMethods::getLayer(detector);
+  hcHeader.supermodule = HelperMethods::getSector(detector);
+  hcHeader.numberHCW = settings.writeTimeBins ? 2 : 1;
+  hcHeader.major = 0x21; // zero suppressed
+  hcHeader.minor = 0;
+  hcHeader.version = 1;
+  words.push_back(hcHeader.word);
+  if (settings.writeTimeBins) {
+    DigitHCHeader1 header1;
+    header1.word = 0;
+    header1.res = 0b01;
+    header1.ptrigphase = 3;
+    header1.numtimebins = settings.timeBins;
+    words.push_back(header1.word);
+  }
+  DigitHCHeader3 header3;
+  header3.word = 0;
+  header3.res = 0b110101;
+  header3.svnver = 0x100;
+  header3.svnrver = 0x200;
+  words.push_back(header3.word);
+
+  const int nMcms = 1 + seed % 3;
+  for (int iMcm = 0; iMcm < nMcms; ++iMcm) {
+    DigitMCMHeader mcmHeader;
+    mcmHeader.word = 0;
+    mcmHeader.res = 0xc;
+    mcmHeader.eventcount = seed & 0xfffff;
+    mcmHeader.rob = iMcm;
+    mcmHeader.mcm = (seed + iMcm) % NMCMROB;
+    mcmHeader.yearflag = 1;
+    words.push_back(mcmHeader.word);
+    DigitMCMADCMask adcMask;
+    adcMask.word = 0;
+    adcMask.j = 0xc;
+    adcMask.n = 0x1;
+    adcMask.c = 0x1f; // no channel set yet
+    for (int iChannel = 0; iChannel < NADCMCM; ++iChannel) {
+      if ((iChannel + seed) % 5 == 0) {
+        incrementADCMask(adcMask, iChannel);
+      }
+    }
+    words.push_back(adcMask.word);
+    for (int iChannel = 0; iChannel < NADCMCM; ++iChannel) {
+      if (!(adcMask.adcmask & (1UL << iChannel))) {
+        continue;
+      }
+      for (int timeBin = 0; timeBin < settings.timeBins; timeBin += 3) {
+        DigitMCMData data;
+        data.word = 0;
+        data.f = (iChannel % 2) ? 0x2 : 0x3;
+        data.z = (seed + iChannel + timeBin) & 0x3ff;
+        data.y = (seed + iChannel + timeBin + 1) & 0x3ff;
+        data.x = (seed + iChannel + timeBin + 2) & 0x3ff;
+        words.push_back(data.word);
+      }
+      ++expected.digits;
+    }
+  }
+  words.push_back(DIGITENDMARKER);
+  words.push_back(DIGITENDMARKER);
+}
+
+// append one HBF with the given payload, followed by the stop RDH
+void addHBF(std::vector<char>& buffer, const std::vector<uint32_t>& payload, int supermodule, int side, int endpoint, uint32_t orbit)
+{
+  o2::header::RAWDataHeader rdh;
+  RDHUtils::setFEEID(rdh, constructTRDFeeID(supermodule, side, endpoint));
+  RDHUtils::setCRUID(rdh, supermodule * 2 + side);
+  RDHUtils::setEndPointID(rdh, endpoint);
+  RDHUtils::setTriggerOrbit(rdh, orbit);
+  RDHUtils::setHeartBeatOrbit(rdh, orbit);
+  RDHUtils::setPacketCounter(rdh, 0);
+  const int size = sizeof(rdh) + payload.size() * sizeof(uint32_t);
+  RDHUtils::setMemorySize(rdh, size);
+  RDHUtils::setOffsetToNext(rdh, size);
+  buffer.insert(buffer.end(), (const char*)&rdh, (const char*)&rdh + sizeof(rdh));
+  buffer.insert(buffer.end(), (const char*)payload.data(), (const char*)(payload.data() + payload.size()));
+
+  RDHUtils::setPacketCounter(rdh, 1);
+  RDHUtils::setStop(rdh, 1);
+  RDHUtils::setMemorySize(rdh, sizeof(rdh));
+  RDHUtils::setOffsetToNext(rdh, sizeof(rdh));
+  buffer.insert(buffer.end(), (const char*)&rdh, (const char*)&rdh + sizeof(rdh));
+}
+
+// the data of one half-CRU for the whole TF: per HBF a physics trigger with tracklets and a calibration trigger with tracklets and digits
+std::vector<char> createHalfCRUInput(int supermodule, int side, int endpoint, const GeneratorSettings& settings, Expected& expected)
+{
+  const int halfCruIdx = (supermodule * 2 + side) * 2 + endpoint;
+  std::vector<char> buffer;
+  for (int iOrbit = 0; iOrbit < NOrbits; ++iOrbit) {
+    std::vector<uint32_t> payload;
+    for (int iTrigger = 0; iTrigger < 2; ++iTrigger) {
+      const bool calib = (iTrigger == 1);
+      HalfCRUHeader halfCRUHeader;
+      std::memset(&halfCRUHeader, 0, sizeof(halfCRUHeader));
+      setHalfCRUHeaderFirstWord(halfCRUHeader, 1, calib ? CalibrationBC : 100 + iOrbit, 0, endpoint, calib ? ETYPECALIBRATIONTRIGGER : ETYPEPHYSICSTRIGGER, 0, 0);
+      const auto headerPos = payload.size();
+      payload.resize(payload.size() + sizeof(HalfCRUHeader) / sizeof(uint32_t));
+      for (int link = 0; link < NLINKSPERHALFCRU; ++link) {
+        const int seed = halfCruIdx * 131 + link * 17 + iOrbit * 7 + iTrigger * 3;
+        const int hcid = HelperMethods::getHCIDFromLinkID(halfCruIdx * NLINKSPERHALFCRU + link);
+        const auto linkStart = payload.size();
+        if (seed % 7 != 3) {
+          addTrackletData(payload, hcid, seed, expected);
+          if (calib) {
+            addDigitData(payload, hcid, seed, settings, expected);
+          }
+          while ((payload.size() - linkStart) % 8) {
+            payload.push_back(CRUPADDING32);
+          }
+        }
+        setHalfCRUHeaderLinkSizeAndFlags(halfCRUHeader, link, (payload.size() - linkStart) / 8, (seed % 13 == 5) ? 1 : 0);
+      }
+      std::memcpy(&payload[headerPos], &halfCRUHeader, sizeof(HalfCRUHeader));
+    }
+    addHBF(buffer, payload, supermodule, side, endpoint, FirstOrbit + iOrbit);
+  }
+  return buffer;
+}
+
+std::vector<std::vector<char>> createInputs(const GeneratorSettings& settingsFirst, const GeneratorSettings& settingsOthers, Expected& expected)
+{
+  std::vector<std::vector<char>> inputs;
+  for (int supermodule : {0, 5, 17}) {
+    for (int side = 0; side < 2; ++side) {
+      for (int endpoint = 0; endpoint < 2; ++endpoint) {
+        inputs.push_back(createHalfCRUInput(supermodule, side, endpoint, inputs.empty() ? settingsFirst : settingsOthers, expected));
+      }
+    }
+  }
+  return inputs;
+}
+
+LinkToHCIDMapping createLinkMap()
+{
+  LinkToHCIDMapping mapping;
+  for (int i = 0; i < MAXHALFCHAMBER; ++i) {
+    mapping.linkIDToHCID.insert({i, HelperMethods::getHCIDFromLinkID(i)});
+    mapping.hcIDToLinkID.insert({i, HelperMethods::getLinkIDfromHCID(i)});
+  }
+  return mapping;
+}
+
+// the readers hold a large buffer, do not put them on the stack
+std::unique_ptr<CruRawReader> parse(const std::vector<std::vector<char>>& inputs, const LinkToHCIDMapping& mapping, int nThreads)
+{
+  auto reader = std::make_unique<CruRawReader>();
+  reader->configure(2, 0, 0, std::bitset<16>{});
+  reader->setLinkMap(&mapping);
+  reader->setMaxErrWarnPrinted(0, 0);
+  reader->setNThreads(nThreads);
+  for (const auto& input : inputs) {
+    reader->addInput(input.data(), input.size());
+  }
+  reader->processInputs();
+  return reader;
+}
+
+void checkIdentical(const CruRawReader& serial, const CruRawReader& parallel)
+{
+  BOOST_CHECK_EQUAL(serial.getDigitsFound(), parallel.getDigitsFound());
+  BOOST_CHECK_EQUAL(serial.getTrackletsFound(), parallel.getTrackletsFound());
+  BOOST_CHECK_EQUAL(serial.getWordsRejected(), parallel.getWordsRejected());
+
+  const auto& eventsSerial = serial.getEventRecords().getEventRecords();
+  const auto& eventsParallel = parallel.getEventRecords().getEventRecords();
+  BOOST_REQUIRE_EQUAL(eventsSerial.size(), eventsParallel.size());
+  for (size_t i = 0; i < eventsSerial.size(); ++i) {
+    const auto& a = eventsSerial[i];
+    const auto& b = eventsParallel[i];
+    BOOST_CHECK(a.getBCData() == b.getBCData());
+    BOOST_CHECK_EQUAL(a.getIsCalibTrigger(), b.getIsCalibTrigger());
+    BOOST_CHECK(a.getDigits() == b.getDigits());
+    BOOST_CHECK(a.getTracklets() == b.getTracklets());
+    BOOST_CHECK(a.getCounters().mLinkWords == b.getCounters().mLinkWords);
+    BOOST_CHECK(a.getCounters().mLinkErrorFlag == b.getCounters().mLinkErrorFlag);
+  }
+
+  const auto& statsSerial = serial.getEventRecords().getTFStats();
+  const auto& statsParallel = parallel.getEventRecords().getTFStats();
+  BOOST_CHECK(statsSerial.mParsingErrors == statsParallel.mParsingErrors);
+  BOOST_CHECK(statsSerial.mParsingErrorsByLink == statsParallel.mParsingErrorsByLink);
+  BOOST_CHECK(statsSerial.mParsingOK == statsParallel.mParsingOK);
+  BOOST_CHECK(statsSerial.mLinkErrorFlag == statsParallel.mLinkErrorFlag);
+  BOOST_CHECK(statsSerial.mLinkNoData == statsParallel.mLinkNoData);
+  BOOST_CHECK(statsSerial.mLinkWords == statsParallel.mLinkWords);
+  BOOST_CHECK(statsSerial.mLinkWordsRead == statsParallel.mLinkWordsRead);
+  BOOST_CHECK(statsSerial.mLinkWordsRejected == statsParallel.mLinkWordsRejected);
+  BOOST_CHECK(statsSerial.mDataFormatRead == statsParallel.mDataFormatRead);
+}
+
+void checkContent(const CruRawReader& reader, const Expected& expected)
+{
+  BOOST_CHECK_EQUAL(reader.getTrackletsFound(), expected.tracklets);
+  BOOST_CHECK_EQUAL(reader.getDigitsFound(), expected.digits);
+  const auto& stats = reader.getEventRecords().getTFStats();
+  for (int error = NoError + 1; error < TRDLastParsingError; ++error) {
+    BOOST_CHECK_EQUAL(stats.mParsingErrors[error], (error == TrackletMCMHeaderSanityCheckFailure) ? expected.corruptMCMHeaders : 0);
+  }
+  BOOST_CHECK_EQUAL(stats.mParsingErrorsByLink.size(), (size_t)expected.corruptMCMHeaders);
+
+  // the triggers of all half-CRUs are merged, per HBF one physics and one calibration trigger
+  const auto& events = reader.getEventRecords().getEventRecords();
+  BOOST_REQUIRE_EQUAL(events.size(), (size_t)(2 * NOrbits));
+  const int bcShift = o2::ctp::TriggerOffsetsParam::Instance().LM_L0;
+  for (int iOrbit = 0; iOrbit < NOrbits; ++iOrbit) {
+    const auto& physics = events[2 * iOrbit];
+    const auto& calib = events[2 * iOrbit + 1];
+    BOOST_CHECK(physics.getBCData() == InteractionRecord(100 + iOrbit - bcShift, FirstOrbit + iOrbit));
+    BOOST_CHECK(calib.getBCData() == InteractionRecord(CalibrationBC - bcShift, FirstOrbit + iOrbit));
+    BOOST_CHECK(!physics.getIsCalibTrigger());
+    BOOST_CHECK(calib.getIsCalibTrigger());
+    BOOST_CHECK(physics.getDigits().empty());
+    BOOST_CHECK(!calib.getDigits().empty());
+  }
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(CruRawReaderParallel_test)
+{
+  // parsing the half-CRUs in parallel must give the same result as the serial parsing
+  const auto mapping = createLinkMap();
+  Expected expected;
+  GeneratorSettings settings;
+  const auto inputs = createInputs(settings, settings, expected);
+  BOOST_REQUIRE_GT(expected.corruptMCMHeaders, 0);
+
+  auto serial = parse(inputs, mapping, 1);
+  checkContent(*serial, expected);
+  for (int nThreads : {2, 4, -1}) {
+    auto parallel = parse(inputs, mapping, nThreads);
+    checkIdentical(*serial, *parallel);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(CruRawReaderParallelTimeBinsChanged_test)
+{
+  // the number of time bins is only given by the DigitHCHeader1 of the first half-CRU, the following ones need it
+  // to read their digits, so the parallel parsing has to fall back to the serial one
+  const auto mapping = createLinkMap();
+  Expected expected;
+  GeneratorSettings settingsFirst{24, true};
+  GeneratorSettings settingsOthers{24, false};
+  const auto inputs = createInputs(settingsFirst, settingsOthers, expected);
+
+  auto serial = parse(inputs, mapping, 1);
+  checkContent(*serial, expected);
+  auto parallel = parse(inputs, mapping, 4);
+  checkIdentical(*serial, *parallel);
+}
+
+} // namespace trd
+} // namespace o2
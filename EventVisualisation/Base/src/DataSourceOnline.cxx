@@ -30,7 +30,7 @@ namespace o2
 {
 namespace event_visualisation
 {
-std::vector<std::string> DataSourceOnline::sourceFilextensions = {".json", ".root"};
+std::vector<std::string> DataSourceOnline::sourceFilextensions = {".json", ".root", ".eve"};
 
 std::vector<std::pair<VisualisationEvent, EVisualisationGroup>>
   DataSourceOnline::getVisualisationList(int no, float minTime, float maxTime, float range)
@@ -39,6 +39,7 @@ class VisualisationCluster
 {
   friend class VisualisationEventJSONSerializer;
   friend class VisualisationEventROOTSerializer;
+  friend class VisualisationEventBinarySerializer;
 
  public:
   // Default constructor
@@ -44,6 +44,7 @@ class VisualisationEvent
 {
   friend class VisualisationEventJSONSerializer;
   friend class VisualisationEventROOTSerializer;
+  friend class VisualisationEventBinarySerializer;
 
  public:
   struct GIDVisualisation {
@@ -0,0 +1,68 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file    VisualisationEventBinarySerializer.h
+/// \brief   Compact binary serialization of VisualisationEvent
+///
+
+#ifndef O2EVE_VISUALISATIONEVENTBINARYSERIALIZER_H
+#define O2EVE_VISUALISATIONEVENTBINARYSERIALIZER_H
+
+#include "EventVisualisationDataConverter/VisualisationEventSerializer.h"
+#include <string>
+#include <vector>
+
+namespace o2
+{
+namespace event_visualisation
+{
+
+/// Binary representation of the event: a fixed header followed by a (optionally zlib compressed) payload.
+/// The payload stores all values of the same kind in one contiguous block (tracks, track points, clusters, calorimeters),
+/// so that reading is a sequence of bulk copies. Coordinates can optionally be quantized to 16 bit integers.
+class VisualisationEventBinarySerializer : public VisualisationEventSerializer
+{
+ public:
+  static constexpr char MAGIC[8] = {'O', '2', 'E', 'V', 'E', 'B', 'I', 'N'};
+  static constexpr unsigned int VERSION = 1;
+
+  enum Flags : unsigned int {
+    Quantized = 0x1,  ///< coordinates are stored as 16 bit integers in units of the quantization step
+    Compressed = 0x2, ///< payload is zlib compressed
+  };
+
+  /// \param step quantization step in cm for the coordinates (0: store as float). Falls back to float if a coordinate does not fit in 16 bit
+  void setQuantizationStep(float step) { mQuantizationStep = step; }
+  float getQuantizationStep() const { return mQuantizationStep; }
+
+  /// \param compress compress the payload with zlib
+  void setCompression(bool compress) { mCompress = compress; }
+  bool getCompression() const { return mCompress; }
+
+  /// serialize event to a buffer
+  void toBuffer(const VisualisationEvent& event, std::vector<char>& buffer) const;
+  /// deserialize event from a buffer, returns false if the buffer does not contain a valid event
+  bool fromBuffer(VisualisationEvent& event, const std::vector<char>& buffer) const;
+
+  bool fromFile(VisualisationEvent& event, std::string fileName) override;
+  void toFile(const VisualisationEvent& event, std::string fileName) override;
+  ~VisualisationEventBinarySerializer() override = default;
+
+ private:
+  float mQuantizationStep = 0.f; ///< quantization step of the coordinates in cm, 0 means no quantization
+  bool mCompress = false;        ///< compress payload
+};
+
+} // namespace event_visualisation
+} // namespace o2
+
+#endif // O2EVE_VISUALISATIONEVENTBINARYSERIALIZER_H
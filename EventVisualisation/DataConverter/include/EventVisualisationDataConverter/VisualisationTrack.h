@@ -46,6 +46,7 @@ class VisualisationTrack
 {
   friend class VisualisationEventJSONSerializer;
   friend class VisualisationEventROOTSerializer;
+  friend class VisualisationEventBinarySerializer;
 
  public:
   // Default constructor
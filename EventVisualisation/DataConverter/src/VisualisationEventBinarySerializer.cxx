@@ -0,0 +1,479 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   VisualisationEventBinarySerializer.cxx
+/// \brief  Binary serialization
+///
+
+#include "EventVisualisationDataConverter/VisualisationEventBinarySerializer.h"
+#include "CommonUtils/CompStream.h"
+#include <fairlogger/Logger.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+
+namespace o2::event_visualisation
+{
+
+namespace
+{
+struct Header {
+  char magic[sizeof(VisualisationEventBinarySerializer::MAGIC)];
+  uint32_t version;
+  uint32_t flags;
+  float quantizationStep;
+  uint64_t payloadSize; // size of the uncompressed payload
+};
+
+class BufferWriter
+{
+ public:
+  explicit BufferWriter(std::vector<char>& buffer) : mBuffer(buffer) {}
+
+  template <typename T>
+  void putBlock(const T* data, size_t n)
+  {
+    const auto pos = mBuffer.size();
+    mBuffer.resize(pos + n * sizeof(T));
+    std::memcpy(mBuffer.data() + pos, data, n * sizeof(T));
+  }
+
+  template <typename T>
+  void putBlock(const std::vector<T>& data)
+  {
+    putBlock(data.data(), data.size());
+  }
+
+  template <typename T>
+  void put(T value)
+  {
+    putBlock(&value, 1);
+  }
+
+  void putString(const std::string& value)
+  {
+    put<uint32_t>(value.size());
+    putBlock(value.data(), value.size());
+  }
+
+ private:
+  std::vector<char>& mBuffer;
+};
+
+class BufferReader
+{
+ public:
+  BufferReader(const char* data, size_t size) : mData(data), mSize(size) {}
+
+  template <typename T>
+  bool getBlock(T* data, size_t n)
+  {
+    const auto bytes = n * sizeof(T);
+    if (!mGood || bytes > mSize - mPos) {
+      mGood = false;
+      return false;
+    }
+    std::memcpy(data, mData + mPos, bytes);
+    mPos += bytes;
+    return true;
+  }
+
+  template <typename T>
+  bool getBlock(std::vector<T>& data, size_t n)
+  {
+    // check before allocating, so that a corrupted count does not trigger a huge allocation
+    if (!mGood || n > (mSize - mPos) / sizeof(T)) {
+      mGood = false;
+      return false;
+    }
+    data.resize(n);
+    return getBlock(data.data(), n);
+  }
+
+  template <typename T>
+  T get()
+  {
+    T value{};
+    getBlock(&value, 1);
+    return value;
+  }
+
+  std::string getString()
+  {
+    const auto size = get<uint32_t>();
+    if (!mGood || size > mSize - mPos) {
+      mGood = false;
+      return {};
+    }
+    std::string value(mData + mPos, size);
+    mPos += size;
+    return value;
+  }
+
+  bool good() const { return mGood; }
+
+ private:
+  const char* mData;
+  size_t mSize;
+  size_t mPos = 0;
+  bool mGood = true;
+};
+
+bool canQuantize(const std::vector<float>& values, float step)
+{
+  const float maxVal = std::numeric_limits<int16_t>::max() * step;
+  for (auto v : values) {
+    if (!(std::abs(v) < maxVal)) { // also catches NaN
+      return false;
+    }
+  }
+  return true;
+}
+
+void putCoordinates(BufferWriter& writer, const std::vector<float>& values, float step)
+{
+  if (step > 0) {
+    std::vector<int16_t> quantized(values.size());
+    const float invStep = 1.f / step;
+    for (size_t i = 0; i < values.size(); i++) {
+      quantized[i] = static_cast<int16_t>(std::lround(values[i] * invStep));
+    }
+    writer.putBlock(quantized);
+  } else {
+    writer.putBlock(values);
+  }
+}
+
+bool getCoordinates(BufferReader& reader, std::vector<float>& values, size_t n, float step)
+{
+  if (step > 0) {
+    std::vector<int16_t> quantized;
+    if (!reader.getBlock(quantized, n)) {
+      return false;
+    }
+    values.resize(n);
+    for (size_t i = 0; i < n; i++) {
+      values[i] = quantized[i] * step;
+    }
+    return true;
+  }
+  return reader.getBlock(values, n);
+}
+} // namespace
+
+void VisualisationEventBinarySerializer::toBuffer(const VisualisationEvent& event, std::vector<char>& buffer) const
+{
+  const auto tracks = event.getTracksSpan();
+  const auto clusters = event.getClustersSpan();
+  const auto calos = event.getCalorimetersSpan();
+
+  // all coordinates (track start, track points, track clusters, global clusters) are stored in three blocks x, y, z
+  std::vector<float> xs, ys, zs;
+  auto addPoint = [&xs, &ys, &zs](float x, float y, float z) {
+    xs.push_back(x);
+    ys.push_back(y);
+    zs.push_back(z);
+  };
+  size_t nCoordinates = tracks.size() + clusters.size();
+  for (const auto& track : tracks) {
+    nCoordinates += track.getPointCount() + track.getClusterCount();
+  }
+  xs.reserve(nCoordinates);
+  ys.reserve(nCoordinates);
+  zs.reserve(nCoordinates);
+
+  std::vector<char> payload;
+  payload.reserve(nCoordinates * 3 * sizeof(float) + tracks.size() * 64 + calos.size() * 48 + 256);
+  BufferWriter writer(payload);
+
+  writer.put<uint32_t>(event.mRunNumber);
+  writer.put<int32_t>(event.mRunType);
+  writer.put<int32_t>(event.mClMask);
+  writer.put<int32_t>(event.mTrkMask);
+  writer.put<uint32_t>(event.mTfCounter);
+  writer.put<uint32_t>(event.mFirstTForbit);
+  writer.put<uint64_t>(event.mPrimaryVertex);
+  writer.putString(event.mCollisionTime);
+  writer.putString(event.mEveVersion);
+  writer.putString(event.mWorkflowParameters);
+
+  // tracks
+  auto putTrackColumn = [&writer, &tracks](auto getter) {
+    using T = decltype(getter(tracks[0]));
+    std::vector<T> column;
+    column.reserve(tracks.size());
+    for (const auto& track : tracks) {
+      column.push_back(getter(track));
+    }
+    writer.putBlock(column);
+  };
+  writer.put<uint32_t>(tracks.size());
+  if (!tracks.empty()) {
+    putTrackColumn([](const VisualisationTrack& t) -> float { return t.mTime; });
+    putTrackColumn([](const VisualisationTrack& t) -> int32_t { return t.mCharge; });
+    putTrackColumn([](const VisualisationTrack& t) -> float { return t.mTheta; });
+    putTrackColumn([](const VisualisationTrack& t) -> float { return t.mPhi; });
+    putTrackColumn([](const VisualisationTrack& t) -> float { return t.mEta; });
+    putTrackColumn([](const VisualisationTrack& t) -> int32_t { return t.mPID; });
+    putTrackColumn([](const VisualisationTrack& t) -> uint8_t { return t.mSource; });
+    putTrackColumn([](const VisualisationTrack& t) -> uint32_t { return t.getPointCount(); });
+    putTrackColumn([](const VisualisationTrack& t) -> uint32_t { return t.getClusterCount(); });
+  }
+  for (const auto& track : tracks) {
+    writer.putString(track.mGID);
+    addPoint(track.mStartCoordinates[0], track.mStartCoordinates[1], track.mStartCoordinates[2]);
+    for (size_t i = 0; i < track.getPointCount(); i++) {
+      addPoint(track.mPolyX[i], track.mPolyY[i], track.mPolyZ[i]);
+    }
+    for (const auto& cluster : track.getClustersSpan()) {
+      addPoint(cluster.X(), cluster.Y(), cluster.Z());
+    }
+  }
+
+  // clusters
+  writer.put<uint32_t>(clusters.size());
+  for (const auto& cluster : clusters) {
+    writer.put<uint8_t>(cluster.mSource);
+  }
+  for (const auto& cluster : clusters) {
+    writer.put<float>(cluster.mTime);
+  }
+  for (const auto& cluster : clusters) {
+    addPoint(cluster.X(), cluster.Y(), cluster.Z());
+  }
+
+  // calorimeters
+  writer.put<uint32_t>(calos.size());
+  for (const auto& calo : calos) {
+    writer.put<uint8_t>(calo.mSource);
+    writer.put<float>(calo.mTime);
+    writer.put<float>(calo.mEnergy);
+    writer.put<float>(calo.mEta);
+    writer.put<float>(calo.mPhi);
+    writer.put<int32_t>(calo.mPID);
+    writer.putString(calo.mGID);
+  }
+
+  // coordinates
+  float step = mQuantizationStep;
+  if (step > 0 && !(canQuantize(xs, step) && canQuantize(ys, step) && canQuantize(zs, step))) {
+    LOGF(info, "VisualisationEventBinarySerializer: coordinates out of range for quantization step %f, storing as float", step);
+    step = 0;
+  }
+  putCoordinates(writer, xs, step);
+  putCoordinates(writer, ys, step);
+  putCoordinates(writer, zs, step);
+
+  Header header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.flags = (step > 0 ? Quantized : 0) | (mCompress ? Compressed : 0);
+  header.quantizationStep = step;
+  header.payloadSize = payload.size();
+
+  buffer.clear();
+  BufferWriter out(buffer);
+  out.put(header);
+  if (mCompress) {
+    std::ostringstream compressed;
+    {
+      o2::io::ocomp_stream stream(compressed, o2::io::CompressionMethod::Zlib);
+      stream.write(payload.data(), payload.size());
+    } // flush on destruction
+    const auto str = compressed.str();
+    out.putBlock(str.data(), str.size());
+  } else {
+    out.putBlock(payload);
+  }
+}
+
+bool VisualisationEventBinarySerializer::fromBuffer(VisualisationEvent& event, const std::vector<char>& buffer) const
+{
+  event.mTracks.clear();
+  event.mClusters.clear();
+  event.mCalo.clear();
+
+  BufferReader in(buffer.data(), buffer.size());
+  const auto header = in.get<Header>();
+  if (!in.good() || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+    LOGF(error, "VisualisationEventBinarySerializer: not a binary event");
+    return false;
+  }
+  if (header.version != VERSION) {
+    LOGF(error, "VisualisationEventBinarySerializer: unsupported version %u", header.version);
+    return false;
+  }
+
+  std::vector<char> uncompressed;
+  const char* payloadData = buffer.data() + sizeof(Header);
+  size_t payloadSize = buffer.size() - sizeof(Header);
+  if (header.flags & Compressed) {
+    std::istringstream compressed(std::string(payloadData, payloadSize));
+    o2::io::icomp_stream stream(compressed, o2::io::CompressionMethod::Zlib);
+    uncompressed.reserve(header.payloadSize);
+    uncompressed.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    payloadData = uncompressed.data();
+    payloadSize = uncompressed.size();
+  }
+  if (payloadSize != header.payloadSize) {
+    LOGF(error, "VisualisationEventBinarySerializer: payload size %lu does not match expected %lu", payloadSize, header.payloadSize);
+    return false;
+  }
+  const float step = (header.flags & Quantized) ? header.quantizationStep : 0.f;
+
+  BufferReader reader(payloadData, payloadSize);
+  event.setRunNumber(reader.get<uint32_t>());
+  event.setRunType(static_cast<parameters::GRPECS::RunType>(reader.get<int32_t>()));
+  event.setClMask(reader.get<int32_t>());
+  event.setTrkMask(reader.get<int32_t>());
+  event.setTfCounter(reader.get<uint32_t>());
+  event.setFirstTForbit(reader.get<uint32_t>());
+  event.setPrimaryVertex(reader.get<uint64_t>());
+  event.setCollisionTime(reader.getString());
+  event.mEveVersion = reader.getString();
+  event.mWorkflowParameters = reader.getString();
+
+  // tracks
+  const auto nTracks = reader.get<uint32_t>();
+  std::vector<float> trackTime, trackTheta, trackPhi, trackEta;
+  std::vector<int32_t> trackCharge, trackPID;
+  std::vector<uint8_t> trackSource;
+  std::vector<uint32_t> trackPoints, trackClusters;
+  if (nTracks > 0) {
+    reader.getBlock(trackTime, nTracks);
+    reader.getBlock(trackCharge, nTracks);
+    reader.getBlock(trackTheta, nTracks);
+    reader.getBlock(trackPhi, nTracks);
+    reader.getBlock(trackEta, nTracks);
+    reader.getBlock(trackPID, nTracks);
+    reader.getBlock(trackSource, nTracks);
+    reader.getBlock(trackPoints, nTracks);
+    reader.getBlock(trackClusters, nTracks);
+  }
+  std::vector<std::string> trackGID(reader.good() ? nTracks : 0);
+  for (auto& gid : trackGID) {
+    gid = reader.getString();
+  }
+
+  // clusters
+  const auto nClusters = reader.get<uint32_t>();
+  std::vector<uint8_t> clusterSource;
+  std::vector<float> clusterTime;
+  reader.getBlock(clusterSource, nClusters);
+  reader.getBlock(clusterTime, nClusters);
+
+  // calorimeters
+  const auto nCalos = reader.get<uint32_t>();
+  if (!reader.good() || nCalos > payloadSize) {
+    LOGF(error, "VisualisationEventBinarySerializer: corrupted event");
+    return false;
+  }
+  event.mCalo.reserve(nCalos);
+  for (uint32_t i = 0; i < nCalos && reader.good(); i++) {
+    VisualisationCalo calo;
+    calo.mSource = (o2::dataformats::GlobalTrackID::Source)reader.get<uint8_t>();
+    calo.mTime = reader.get<float>();
+    calo.mEnergy = reader.get<float>();
+    calo.mEta = reader.get<float>();
+    calo.mPhi = reader.get<float>();
+    calo.mPID = reader.get<int32_t>();
+    calo.mGID = reader.getString();
+    event.mCalo.emplace_back(calo);
+  }
+
+  // coordinates
+  size_t nCoordinates = nTracks + nClusters;
+  for (uint32_t i = 0; i < trackPoints.size(); i++) {
+    nCoordinates += trackPoints[i] + trackClusters[i];
+  }
+  std::vector<float> xs, ys, zs;
+  getCoordinates(reader, xs, nCoordinates, step);
+  getCoordinates(reader, ys, nCoordinates, step);
+  getCoordinates(reader, zs, nCoordinates, step);
+  if (!reader.good()) {
+    LOGF(error, "VisualisationEventBinarySerializer: corrupted event");
+    event.clear();
+    return false;
+  }
+
+  size_t pos = 0;
+  event.mTracks.reserve(nTracks);
+  for (uint32_t i = 0; i < nTracks; i++) {
+    VisualisationTrack track;
+    track.mTime = trackTime[i];
+    track.mCharge = trackCharge[i];
+    track.mTheta = trackTheta[i];
+    track.mPhi = trackPhi[i];
+    track.mEta = trackEta[i];
+    track.mPID = trackPID[i];
+    track.mSource = (o2::dataformats::GlobalTrackID::Source)trackSource[i];
+    track.mGID = std::move(trackGID[i]);
+    track.mStartCoordinates[0] = xs[pos];
+    track.mStartCoordinates[1] = ys[pos];
+    track.mStartCoordinates[2] = zs[pos];
+    pos++;
+    track.mPolyX.assign(xs.begin() + pos, xs.begin() + pos + trackPoints[i]);
+    track.mPolyY.assign(ys.begin() + pos, ys.begin() + pos + trackPoints[i]);
+    track.mPolyZ.assign(zs.begin() + pos, zs.begin() + pos + trackPoints[i]);
+    pos += trackPoints[i];
+    track.mClusters.reserve(trackClusters[i]);
+    for (uint32_t c = 0; c < trackClusters[i]; c++, pos++) {
+      float xyz[] = {xs[pos], ys[pos], zs[pos]};
+      VisualisationCluster cluster(xyz, track.mTime);
+      cluster.mSource = track.mSource;
+      track.mClusters.emplace_back(cluster);
+    }
+    event.mTracks.emplace_back(std::move(track));
+  }
+
+  event.mClusters.reserve(nClusters);
+  for (uint32_t i = 0; i < nClusters; i++, pos++) {
+    float xyz[] = {xs[pos], ys[pos], zs[pos]};
+    VisualisationCluster cluster(xyz, clusterTime[i]);
+    cluster.mSource = (o2::dataformats::GlobalTrackID::Source)clusterSource[i];
+    event.mClusters.emplace_back(cluster);
+  }
+
+  event.afterLoading();
+  return true;
+}
+
+void VisualisationEventBinarySerializer::toFile(const VisualisationEvent& event, std::string fileName)
+{
+  std::vector<char> buffer;
+  toBuffer(event, buffer);
+  std::ofstream out(fileName, std::ios::binary);
+  out.write(buffer.data(), buffer.size());
+  out.close();
+}
+
+bool VisualisationEventBinarySerializer::fromFile(VisualisationEvent& event, std::string fileName)
+{
+  LOGF(info, "VisualisationEventBinarySerializer <- ", fileName);
+  std::ifstream in(fileName, std::ios::binary | std::ios::ate);
+  if (!in.is_open()) {
+    return false;
+  }
+  std::vector<char> buffer(in.tellg());
+  in.seekg(0);
+  in.read(buffer.data(), buffer.size());
+  if (!in) {
+    return false;
+  }
+  return fromBuffer(event, buffer);
+}
+
+} // namespace o2::event_visualisation
@@ -17,6 +17,7 @@
 #include "EventVisualisationDataConverter/VisualisationEventSerializer.h"
 #include "EventVisualisationDataConverter/VisualisationEventJSONSerializer.h"
 #include "EventVisualisationDataConverter/VisualisationEventROOTSerializer.h"
+#include "EventVisualisationDataConverter/VisualisationEventBinarySerializer.h"
 #include <iostream>
 #include <iomanip>
 #include <sstream>
@@ -25,7 +26,8 @@ namespace o2::event_visualisation
 {
 std::map<std::string, VisualisationEventSerializer*> VisualisationEventSerializer::instances = {
   {".json", new o2::event_visualisation::VisualisationEventJSONSerializer()},
-  {".root", new o2::event_visualisation::VisualisationEventROOTSerializer()}};
+  {".root", new o2::event_visualisation::VisualisationEventROOTSerializer()},
+  {".eve", new o2::event_visualisation::VisualisationEventBinarySerializer()}};
 
 std::string VisualisationEventSerializer::fileNameIndexed(const std::string fileName, const int index)
 {
@@ -0,0 +1,214 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   testVisualisationEventSerializer.cxx
+/// \brief  round-trip of VisualisationEvent through the binary serializer, size and time compared to JSON and ROOT
+///
+
+#define BOOST_TEST_MODULE Test EventVisualisation VisualisationEventSerializer
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "EventVisualisationDataConverter/VisualisationEvent.h"
+#include "EventVisualisationDataConverter/VisualisationEventSerializer.h"
+#include "EventVisualisationDataConverter/VisualisationEventBinarySerializer.h"
+#include <fairlogger/Logger.h>
+#include <TRandom.h>
+#include <chrono>
+#include <filesystem>
+
+using namespace o2::event_visualisation;
+
+namespace
+{
+VisualisationEvent createEvent(int nTracks, int nPoints, int nTrackClusters, int nClusters, int nCalo)
+{
+  VisualisationEvent event;
+  event.setRunNumber(523897);
+  event.setRunType(o2::parameters::GRPECS::PHYSICS);
+  event.setClMask(17);
+  event.setTrkMask(42);
+  event.setTfCounter(1234);
+  event.setFirstTForbit(567890);
+  event.setPrimaryVertex(3);
+  event.setCollisionTime("2022-08-16 12:34:56");
+  event.setEveVersion("1.0");
+  event.setWorkflowParameters("--test");
+
+  for (int i = 0; i < nTracks; i++) {
+    VisualisationTrack::VisualisationTrackVO vo;
+    vo.time = gRandom->Uniform(0, 1000);
+    vo.charge = (i % 2) ? 1 : -1;
+    vo.PID = 211;
+    vo.startXYZ[0] = gRandom->Gaus(0, 1);
+    vo.startXYZ[1] = gRandom->Gaus(0, 1);
+    vo.startXYZ[2] = gRandom->Uniform(-10, 10);
+    vo.phi = gRandom->Uniform(0, 6.28);
+    vo.theta = gRandom->Uniform(0, 3.14);
+    vo.eta = gRandom->Uniform(-1, 1);
+    vo.gid = "TPC/" + std::to_string(i);
+    vo.source = o2::dataformats::GlobalTrackID::TPC;
+    auto track = event.addTrack(vo);
+    for (int p = 0; p < nPoints; p++) {
+      track->addPolyPoint(gRandom->Uniform(-250, 250), gRandom->Uniform(-250, 250), gRandom->Uniform(-250, 250));
+    }
+    for (int c = 0; c < nTrackClusters; c++) {
+      event.addCluster(gRandom->Uniform(-250, 250), gRandom->Uniform(-250, 250), gRandom->Uniform(-250, 250), vo.time);
+    }
+  }
+  for (int i = 0; i < nClusters; i++) {
+    event.addGlobalCluster(TVector3(gRandom->Uniform(-250, 250), gRandom->Uniform(-250, 250), gRandom->Uniform(-250, 250)));
+  }
+  for (int i = 0; i < nCalo; i++) {
+    VisualisationCalo::VisualisationCaloVO vo;
+    vo.time = gRandom->Uniform(0, 1000);
+    vo.energy = gRandom->Exp(2);
+    vo.phi = gRandom->Uniform(0, 6.28);
+    vo.eta = gRandom->Uniform(-0.7, 0.7);
+    vo.PID = 22;
+    vo.gid = "EMC/" + std::to_string(i);
+    vo.source = o2::dataformats::GlobalTrackID::EMC;
+    event.addCalo(vo);
+  }
+  event.afterLoading();
+  return event;
+}
+
+void compareEvents(const VisualisationEvent& a, const VisualisationEvent& b, float tolerance)
+{
+  BOOST_CHECK_EQUAL(a.getRunNumber(), b.getRunNumber());
+  BOOST_CHECK_EQUAL(a.getRunType(), b.getRunType());
+  BOOST_CHECK_EQUAL(a.getClMask(), b.getClMask());
+  BOOST_CHECK_EQUAL(a.getTrkMask(), b.getTrkMask());
+  BOOST_CHECK_EQUAL(a.getTfCounter(), b.getTfCounter());
+  BOOST_CHECK_EQUAL(a.getFirstTForbit(), b.getFirstTForbit());
+  BOOST_CHECK_EQUAL(a.getCollisionTime(), b.getCollisionTime());
+  BOOST_CHECK_EQUAL(a.getMinTimeOfTracks(), b.getMinTimeOfTracks());
+  BOOST_CHECK_EQUAL(a.getMaxTimeOfTracks(), b.getMaxTimeOfTracks());
+
+  BOOST_REQUIRE_EQUAL(a.getTrackCount(), b.getTrackCount());
+  for (size_t i = 0; i < a.getTrackCount(); i++) {
+    const auto& ta = a.getTrack(i);
+    const auto& tb = b.getTrack(i);
+    BOOST_CHECK_EQUAL(ta.getTime(), tb.getTime());
+    BOOST_CHECK_EQUAL(ta.getCharge(), tb.getCharge());
+    BOOST_CHECK_EQUAL(ta.getPID(), tb.getPID());
+    BOOST_CHECK_EQUAL(ta.getGIDAsString(), tb.getGIDAsString());
+    BOOST_CHECK_EQUAL(ta.getSource(), tb.getSource());
+    BOOST_CHECK_EQUAL(ta.getPhi(), tb.getPhi());
+    BOOST_CHECK_EQUAL(ta.getTheta(), tb.getTheta());
+    for (int k = 0; k < 3; k++) {
+      BOOST_CHECK_SMALL(ta.getStartCoordinates()[k] - tb.getStartCoordinates()[k], tolerance);
+    }
+    BOOST_REQUIRE_EQUAL(ta.getPointCount(), tb.getPointCount());
+    for (size_t p = 0; p < ta.getPointCount(); p++) {
+      for (int k = 0; k < 3; k++) {
+        BOOST_CHECK_SMALL(ta.getPoint(p)[k] - tb.getPoint(p)[k], tolerance);
+      }
+    }
+    BOOST_REQUIRE_EQUAL(ta.getClusterCount(), tb.getClusterCount());
+    for (size_t c = 0; c < ta.getClusterCount(); c++) {
+      BOOST_CHECK_SMALL(ta.getCluster(c).X() - tb.getCluster(c).X(), tolerance);
+      BOOST_CHECK_SMALL(ta.getCluster(c).Y() - tb.getCluster(c).Y(), tolerance);
+      BOOST_CHECK_SMALL(ta.getCluster(c).Z() - tb.getCluster(c).Z(), tolerance);
+    }
+  }
+
+  BOOST_REQUIRE_EQUAL(a.getClusterCount(), b.getClusterCount());
+  for (size_t i = 0; i < a.getClusterCount(); i++) {
+    BOOST_CHECK_EQUAL(a.getCluster(i).getSource(), b.getCluster(i).getSource());
+    BOOST_CHECK_EQUAL(a.getCluster(i).Time(), b.getCluster(i).Time());
+    BOOST_CHECK_SMALL(a.getCluster(i).X() - b.getCluster(i).X(), tolerance);
+    BOOST_CHECK_SMALL(a.getCluster(i).Y() - b.getCluster(i).Y(), tolerance);
+    BOOST_CHECK_SMALL(a.getCluster(i).Z() - b.getCluster(i).Z(), tolerance);
+  }
+
+  BOOST_REQUIRE_EQUAL(a.getCaloCount(), b.getCaloCount());
+  const auto caloA = a.getCalorimetersSpan();
+  const auto caloB = b.getCalorimetersSpan();
+  for (size_t i = 0; i < caloA.size(); i++) {
+    BOOST_CHECK_EQUAL(caloA[i].getSource(), caloB[i].getSource());
+    BOOST_CHECK_EQUAL(caloA[i].getTime(), caloB[i].getTime());
+    BOOST_CHECK_EQUAL(caloA[i].getEnergy(), caloB[i].getEnergy());
+    BOOST_CHECK_EQUAL(caloA[i].getEta(), caloB[i].getEta());
+    BOOST_CHECK_EQUAL(caloA[i].getPhi(), caloB[i].getPhi());
+    BOOST_CHECK_EQUAL(caloA[i].getPID(), caloB[i].getPID());
+    BOOST_CHECK_EQUAL(caloA[i].getGIDAsString(), caloB[i].getGIDAsString());
+  }
+}
+
+// write and read the event, report size and timing
+void benchmark(VisualisationEventSerializer& serializer, const VisualisationEvent& event, VisualisationEvent& result, const std::string& fileName, const std::string& name)
+{
+  using timer = std::chrono::high_resolution_clock;
+  auto start = timer::now();
+  serializer.toFile(event, fileName);
+  const std::chrono::duration<float, std::milli> timeWrite = timer::now() - start;
+  start = timer::now();
+  BOOST_CHECK(serializer.fromFile(result, fileName));
+  const std::chrono::duration<float, std::milli> timeRead = timer::now() - start;
+  LOGP(info, "{:<20}: size {:>10} bytes, write {:>8.2f} ms, read {:>8.2f} ms", name, std::filesystem::file_size(fileName), timeWrite.count(), timeRead.count());
+  std::filesystem::remove(fileName);
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(VisualisationEventBinarySerializer_roundtrip)
+{
+  gRandom->SetSeed(42);
+  const auto event = createEvent(2000, 100, 10, 5000, 50);
+
+  VisualisationEventBinarySerializer serializer;
+  for (const bool compress : {false, true}) {
+    serializer.setCompression(compress);
+    serializer.setQuantizationStep(0);
+    VisualisationEvent result;
+    benchmark(serializer, event, result, "testEvent.eve", compress ? "binary compressed" : "binary");
+    compareEvents(event, result, 0.f);
+
+    const float step = 0.01;
+    serializer.setQuantizationStep(step);
+    VisualisationEvent resultQuantized;
+    benchmark(serializer, event, resultQuantized, "testEventQuantized.eve", compress ? "binary quant. compr." : "binary quantized");
+    compareEvents(event, resultQuantized, 0.6f * step);
+  }
+
+  // comparison with the other formats
+  for (const std::string ext : {".json", ".root"}) {
+    auto other = VisualisationEventSerializer::getInstance(ext);
+    BOOST_REQUIRE(other != nullptr);
+    VisualisationEvent result;
+    benchmark(*other, event, result, "testEvent" + ext, ext.substr(1));
+    BOOST_CHECK_EQUAL(event.getTrackCount(), result.getTrackCount());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(VisualisationEventBinarySerializer_fallback)
+{
+  // coordinates which do not fit in 16 bit with the given step are stored as float
+  gRandom->SetSeed(7);
+  auto event = createEvent(10, 5, 2, 10, 0);
+  event.addGlobalCluster(TVector3(0, 0, -1500));
+
+  VisualisationEventBinarySerializer serializer;
+  serializer.setQuantizationStep(0.01);
+  std::vector<char> buffer;
+  serializer.toBuffer(event, buffer);
+  VisualisationEvent result;
+  BOOST_REQUIRE(serializer.fromBuffer(result, buffer));
+  compareEvents(event, result, 0.f);
+
+  // corrupted buffers are rejected
+  buffer.resize(buffer.size() / 2);
+  BOOST_CHECK(!serializer.fromBuffer(result, buffer));
+  buffer[0] = 'X';
+  BOOST_CHECK(!serializer.fromBuffer(result, buffer));
+}
@@ -18,6 +18,7 @@
 #include "EveWorkflow/O2DPLDisplay.h"
 #include "EveWorkflow/EveWorkflowHelper.h"
 #include "EventVisualisationBase/ConfigurationManager.h"
+#include "EventVisualisationDataConverter/VisualisationEventBinarySerializer.h"
 #include "DetectorsBase/Propagator.h"
 #include "DataFormatsGlobalTracking/RecoContainer.h"
 #include "DataFormatsTPC/WorkflowHelper.h"
@@ -53,6 +54,9 @@ void customize(std::vector<ConfigParamSpec>& workflowOptions)
   std::vector<o2::framework::ConfigParamSpec> options{
     {"jsons-folder", VariantType::String, "jsons", {"name of the folder to store json files"}},
     {"use-json-format", VariantType::Bool, false, {"instead of root format (default) use json format"}},
+    {"use-binary-format", VariantType::Bool, false, {"instead of root format (default) use compact binary format"}},
+    {"binary-quantization-step", VariantType::Float, 0.f, {"quantization step in cm of coordinates in binary format (0 means no quantization)"}},
+    {"binary-compression", VariantType::Bool, false, {"compress files in binary format"}},
     {"eve-hostname", VariantType::String, "", {"name of the host allowed to produce files (empty means no limit)"}},
     {"eve-dds-collection-index", VariantType::Int, -1, {"number of dpl collection allowed to produce files (-1 means no limit)"}},
     {"number-of_files", VariantType::Int, 150, {"maximum number of json files in folder"}},
@@ -264,6 +268,12 @@ WorkflowSpec defineDataProcessing(ConfigContext const& cfgc)
   if (useJsonFormat) {
     ext = ".json";
   }
+  if (cfgc.options().get<bool>("use-binary-format")) {
+    ext = ".eve";
+    auto binarySerializer = static_cast<VisualisationEventBinarySerializer*>(VisualisationEventSerializer::getInstance(ext));
+    binarySerializer->setQuantizationStep(cfgc.options().get<float>("binary-quantization-step"));
+    binarySerializer->setCompression(cfgc.options().get<bool>("binary-compression"));
+  }
   auto eveHostName = cfgc.options().get<std::string>("eve-hostname");
   o2::conf::ConfigurableParam::updateFromString(cfgc.options().get<std::string>("configKeyValues"));
   bool useMC = !cfgc.options().get<bool>("disable-mc");
@@ -23,6 +23,7 @@
 #include "Framework/RuntimeError.h"
 #include "Framework/ArrowTableSlicingCache.h"
 #include "Framework/SliceCache.h"
+#include "Framework/SelectionBitmap.h"
 #include <arrow/table.h>
 #include <arrow/array.h>
 #include <arrow/util/config.h>
@@ -52,8 +53,6 @@ auto createFieldsFromColumns(framework::pack<C...>)
   return std::vector<std::shared_ptr<arrow::Field>>{C::asArrowField()...};
 }
 
-using SelectionVector = std::vector<int64_t>;
-
 template <typename, typename = void>
 inline constexpr bool is_index_column_v = false;
 
@@ -648,17 +647,22 @@ struct FilteredIndexPolicy : IndexPolicyBase {
   // which happens below which will properly setup the first index
   // by remapping the filtered index 0 to whatever unfiltered index
   // it belongs to.
-  FilteredIndexPolicy(gsl::span<int64_t const> selection, uint64_t offset = 0)
+  // The selected rows can be relative to another table than the one being
+  // iterated, e.g. the one a slice was taken from, in which case they are
+  // shifted by selectionShift when they are read.
+  FilteredIndexPolicy(gsl::span<int64_t const> selection, uint64_t offset = 0, int64_t selectionShift = 0)
     : IndexPolicyBase{-1, offset},
       mSelectedRows(selection),
+      mSelectionShift(selectionShift),
       mMaxSelection(selection.size())
   {
     this->setCursor(0);
   }
 
-  void resetSelection(gsl::span<int64_t const> selection)
+  void resetSelection(gsl::span<int64_t const> selection, int64_t selectionShift = 0)
   {
     mSelectedRows = selection;
+    mSelectionShift = selectionShift;
     mMaxSelection = selection.size();
     this->setCursor(0);
   }
@@ -743,9 +747,10 @@ struct FilteredIndexPolicy : IndexPolicyBase {
  private:
   inline void updateRow()
   {
-    this->mRowIndex = O2_BUILTIN_LIKELY(mSelectionRow < mMaxSelection) ? mSelectedRows[mSelectionRow] : -1;
+    this->mRowIndex = O2_BUILTIN_LIKELY(mSelectionRow < mMaxSelection) ? mSelectedRows[mSelectionRow] - mSelectionShift : -1;
   }
   gsl::span<int64_t const> mSelectedRows;
+  int64_t mSelectionShift = 0;
   int64_t mSelectionRow = 0;
   int64_t mMaxSelection = 0;
 };
@@ -1362,13 +1367,13 @@ class Table
     return RowViewSentinel{mEnd};
   }
 
-  filtered_iterator filtered_begin(gsl::span<int64_t const> selection)
+  filtered_iterator filtered_begin(gsl::span<int64_t const> selection, int64_t selectionShift = 0)
   {
     // Note that the FilteredIndexPolicy will never outlive the selection which
     // is held by the table, so we are safe passing the bare pointer. If it does it
     // means that the iterator on a table is outliving the table itself, which is
     // a bad idea.
-    return filtered_iterator(mColumnChunks, {selection, mOffset});
+    return filtered_iterator(mColumnChunks, {selection, mOffset, selectionShift});
   }
 
   iterator iteratorAt(uint64_t i) const
@@ -2654,6 +2659,21 @@ class FilteredBase : public T
     mFilteredBegin.bindInternalIndices(this);
   }
 
+  /// Table referencing a selection whose rows are shifted by selectionShift with
+  /// respect to its own, e.g. the selection of the table it was sliced from. The
+  /// selection is not copied and must outlive the table.
+  FilteredBase(std::vector<std::shared_ptr<arrow::Table>>&& tables, gsl::span<int64_t const> const& selection, uint64_t offset, int64_t selectionShift)
+    : T{std::move(tables), offset},
+      mSelectedRows{selection},
+      mSelectionShift{selectionShift}
+  {
+    if (this->tableSize() != 0) {
+      mFilteredBegin = table_t::filtered_begin(mSelectedRows, mSelectionShift);
+    }
+    resetRanges();
+    mFilteredBegin.bindInternalIndices(this);
+  }
+
   iterator begin()
   {
     return iterator(mFilteredBegin);
@@ -2689,9 +2709,20 @@ class FilteredBase : public T
     return table_t::asArrowTable()->num_rows();
   }
 
+  /// The selected rows, relative to this table
   auto const& getSelectedRows() const
   {
-    return mSelectedRows;
+    if (mSelectionShift == 0) {
+      return mSelectedRows;
+    }
+    // rebase the rows of a selection taken from another table only when asked for
+    if (mRebasedRows.size() != mSelectedRows.size()) {
+      mRebasedRows.resize(mSelectedRows.size());
+      std::transform(mSelectedRows.begin(), mSelectedRows.end(), mRebasedRows.begin(),
+                     [shift = mSelectionShift](int64_t idx) { return idx - shift; });
+    }
+    mRebasedSpan = gsl::span{mRebasedRows};
+    return mRebasedSpan;
   }
 
   static inline auto getSpan(gandiva::Selection const& sel)
@@ -2754,14 +2785,7 @@ class FilteredBase : public T
     }
     auto start = static_cast<uint64_t>(offset);
     auto end = start + slice->num_rows();
-    auto start_iterator = std::lower_bound(mSelectedRows.begin(), mSelectedRows.end(), start);
-    auto stop_iterator = std::lower_bound(start_iterator, mSelectedRows.end(), end);
-    SelectionVector slicedSelection{start_iterator, stop_iterator};
-    std::transform(slicedSelection.begin(), slicedSelection.end(), slicedSelection.begin(),
-                   [&start](int64_t idx) {
-                     return idx - static_cast<int64_t>(start);
-                   });
-    self_t fresult{{slice}, std::move(slicedSelection), start};
+    auto fresult = sliceSelection<self_t>(slice, start, end);
     this->copyIndexBindings(fresult);
     return fresult;
   }
@@ -2789,14 +2813,7 @@ class FilteredBase : public T
       }
       auto start = offset;
       auto end = start + result->num_rows();
-      auto start_iterator = std::lower_bound(mSelectedRows.begin(), mSelectedRows.end(), start);
-      auto stop_iterator = std::lower_bound(start_iterator, mSelectedRows.end(), end);
-      SelectionVector slicedSelection{start_iterator, stop_iterator};
-      std::transform(slicedSelection.begin(), slicedSelection.end(), slicedSelection.begin(),
-                     [&start](int64_t idx) {
-                       return idx - static_cast<int64_t>(start);
-                     });
-      self_t fresult{{result}, std::move(slicedSelection), start};
+      auto fresult = sliceSelection<self_t>(result, start, end);
       this->copyIndexBindings(fresult);
       return fresult;
     } else {
@@ -2827,7 +2844,7 @@ class FilteredBase : public T
 
   int isInSelectedRows(int i) const
   {
-    auto locate = std::find(mSelectedRows.begin(), mSelectedRows.end(), i);
+    auto locate = std::find(mSelectedRows.begin(), mSelectedRows.end(), i + mSelectionShift);
     if (locate == mSelectedRows.end()) {
       return -1;
     }
@@ -2837,53 +2854,55 @@ class FilteredBase : public T
  protected:
   auto slice(uint64_t start, uint64_t end)
   {
-    auto start_iterator = std::lower_bound(mSelectedRows.begin(), mSelectedRows.end(), start);
-    auto stop_iterator = std::lower_bound(start_iterator, mSelectedRows.end(), end);
+    return sliceSelection<self_t>(this->asArrowTable()->Slice(start, end - start + 1), start, end);
+  }
+
+  /// Table S made of the rows [start, end) of this one, given as slice. When
+  /// this table does not own its selection, the slice references it without
+  /// copy and its rows are rebased lazily. Otherwise the selected rows of the
+  /// slice are copied, as the slice can outlive this table.
+  template <typename S>
+  S sliceSelection(std::shared_ptr<arrow::Table> const& slice, uint64_t start, uint64_t end) const
+  {
+    auto shift = mSelectionShift + static_cast<int64_t>(start);
+    auto start_iterator = std::lower_bound(mSelectedRows.begin(), mSelectedRows.end(), shift);
+    auto stop_iterator = std::lower_bound(start_iterator, mSelectedRows.end(), mSelectionShift + static_cast<int64_t>(end));
+    if (!mCached) {
+      return S{{slice}, mSelectedRows.subspan(start_iterator - mSelectedRows.begin(), stop_iterator - start_iterator), start, shift};
+    }
     SelectionVector slicedSelection{start_iterator, stop_iterator};
     std::transform(slicedSelection.begin(), slicedSelection.end(), slicedSelection.begin(),
-                   [&](int64_t idx) {
-                     return idx - static_cast<int64_t>(start);
+                   [&shift](int64_t idx) {
+                     return idx - shift;
                    });
-    return self_t{{this->asArrowTable()->Slice(start, end - start + 1)}, std::move(slicedSelection), start};
+    return S{{slice}, std::move(slicedSelection), start};
   }
 
   void sumWithSelection(SelectionVector const& selection)
   {
     mCached = true;
-    SelectionVector rowsUnion;
-    std::set_union(mSelectedRows.begin(), mSelectedRows.end(), selection.begin(), selection.end(), std::back_inserter(rowsUnion));
-    mSelectedRowsCache.clear();
-    mSelectedRowsCache = rowsUnion;
+    mSelectedRowsCache = selectionUnion(getSelectedRows(), selection);
     resetRanges();
   }
 
   void intersectWithSelection(SelectionVector const& selection)
   {
     mCached = true;
-    SelectionVector intersection;
-    std::set_intersection(mSelectedRows.begin(), mSelectedRows.end(), selection.begin(), selection.end(), std::back_inserter(intersection));
-    mSelectedRowsCache.clear();
-    mSelectedRowsCache = intersection;
+    mSelectedRowsCache = selectionIntersection(getSelectedRows(), selection);
     resetRanges();
   }
 
   void sumWithSelection(gsl::span<int64_t const> const& selection)
   {
     mCached = true;
-    SelectionVector rowsUnion;
-    std::set_union(mSelectedRows.begin(), mSelectedRows.end(), selection.begin(), selection.end(), std::back_inserter(rowsUnion));
-    mSelectedRowsCache.clear();
-    mSelectedRowsCache = rowsUnion;
+    mSelectedRowsCache = selectionUnion(getSelectedRows(), selection);
     resetRanges();
   }
 
   void intersectWithSelection(gsl::span<int64_t const> const& selection)
   {
     mCached = true;
-    SelectionVector intersection;
-    std::set_intersection(mSelectedRows.begin(), mSelectedRows.end(), selection.begin(), selection.end(), std::back_inserter(intersection));
-    mSelectedRowsCache.clear();
-    mSelectedRowsCache = intersection;
+    mSelectedRowsCache = selectionIntersection(getSelectedRows(), selection);
     resetRanges();
   }
 
@@ -2892,18 +2911,22 @@ class FilteredBase : public T
   {
     if (mCached) {
       mSelectedRows = gsl::span{mSelectedRowsCache};
+      mSelectionShift = 0;
     }
     mFilteredEnd.reset(new RowViewSentinel{mSelectedRows.size()});
     if (tableSize() == 0) {
       mFilteredBegin = *mFilteredEnd;
     } else {
-      mFilteredBegin.resetSelection(mSelectedRows);
+      mFilteredBegin.resetSelection(mSelectedRows, mSelectionShift);
     }
   }
 
   gsl::span<int64_t const> mSelectedRows;
   SelectionVector mSelectedRowsCache;
   bool mCached = false;
+  int64_t mSelectionShift = 0; ///< shift of the selected rows with respect to the rows of this table
+  mutable SelectionVector mRebasedRows;
+  mutable gsl::span<int64_t const> mRebasedSpan;
   iterator mFilteredBegin;
   std::shared_ptr<RowViewSentinel> mFilteredEnd;
 };
@@ -2925,6 +2948,9 @@ class Filtered : public FilteredBase<T>
   Filtered(std::vector<std::shared_ptr<arrow::Table>>&& tables, gsl::span<int64_t const> const& selection, uint64_t offset = 0)
     : FilteredBase<T>(std::move(tables), selection, offset) {}
 
+  Filtered(std::vector<std::shared_ptr<arrow::Table>>&& tables, gsl::span<int64_t const> const& selection, uint64_t offset, int64_t selectionShift)
+    : FilteredBase<T>(std::move(tables), selection, offset, selectionShift) {}
+
   Filtered<T> operator+(SelectionVector const& selection)
   {
     Filtered<T> copy(*this);
@@ -3007,16 +3033,9 @@ class Filtered : public FilteredBase<T>
       this->copyIndexBindings(fresult);
       return fresult;
     }
-    auto start = offset;
+    auto start = static_cast<uint64_t>(offset);
     auto end = start + slice->num_rows();
-    auto start_iterator = std::lower_bound(this->getSelectedRows().begin(), this->getSelectedRows().end(), start);
-    auto stop_iterator = std::lower_bound(start_iterator, this->getSelectedRows().end(), end);
-    SelectionVector slicedSelection{start_iterator, stop_iterator};
-    std::transform(slicedSelection.begin(), slicedSelection.end(), slicedSelection.begin(),
-                   [&start](int64_t idx) {
-                     return idx - static_cast<int64_t>(start);
-                   });
-    self_t fresult{{slice}, std::move(slicedSelection), static_cast<uint64_t>(start)};
+    auto fresult = this->template sliceSelection<self_t>(slice, start, end);
     this->copyIndexBindings(fresult);
     return fresult;
   }
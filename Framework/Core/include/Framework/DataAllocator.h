@@ -27,6 +27,7 @@
 #include "Framework/ServiceRegistry.h"
 #include "Framework/RuntimeError.h"
 #include "Framework/RouteState.h"
+#include "Framework/RouteDispatchTable.h"
 
 #include "Headers/DataHeader.h"
 #include <TClass.h>
@@ -519,6 +520,8 @@ class DataAllocator
 
  private:
   ServiceRegistryRef mRegistry;
+  /// Which of the output routes of the device can match a given output
+  RouteDispatchTable mOutputDispatch;
 
   RouteIndex matchDataHeader(const Output& spec, size_t timeframeId);
   fair::mq::MessagePtr headerMessageFromOutput(Output const& spec,                                  //
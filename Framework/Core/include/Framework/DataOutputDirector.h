@@ -80,6 +80,8 @@ struct DataOutputDirector {
   // read/write private members
   int getNumberTimeFramesToMerge() { return mnumberTimeFramesToMerge; }
   void setNumberTimeFramesToMerge(int ntfmerge) { mnumberTimeFramesToMerge = ntfmerge > 0 ? ntfmerge : 1; }
+  int getNumberOfWriterThreads() { return mnumberWriterThreads; }
+  void setNumberOfWriterThreads(int nthreads) { mnumberWriterThreads = nthreads > 0 ? nthreads : 1; }
   std::string getFileMode() { return mfileMode; }
   void setFileMode(std::string filemode) { mfileMode = filemode; }
 
@@ -115,6 +117,7 @@ struct DataOutputDirector {
   int mfileCounter = 1;
   float mmaxfilesize = -1.;
   int mnumberTimeFramesToMerge = 1;
+  int mnumberWriterThreads = 1;
   std::string mfileMode = "RECREATE";
 
   std::tuple<std::string, std::string, std::string, float, int> readJsonDocument(Document* doc);
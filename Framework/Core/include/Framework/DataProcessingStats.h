@@ -64,6 +64,9 @@ enum struct ProcessingStatsId : short {
   RESOURCES_MISSING,
   RESOURCES_INSUFFICIENT,
   RESOURCES_SATISFACTORY,
+  GANDIVA_CACHE_HITS,
+  GANDIVA_CACHE_MISSES,
+  GANDIVA_COMPILATION_TIME_US,
   AVAILABLE_MANAGED_SHM_BASE = 512,
 };
 
@@ -17,6 +17,7 @@
 #include "Framework/ForwardRoute.h"
 #include "Framework/CompletionPolicy.h"
 #include "Framework/MessageSet.h"
+#include "Framework/RouteDispatchTable.h"
 #include "Framework/TimesliceIndex.h"
 #include "Framework/Tracing.h"
 #include "Framework/TimesliceSlot.h"
@@ -189,6 +190,8 @@ class DataRelayer
   std::vector<size_t> mDistinctRoutesIndex;
   std::vector<InputSpec> mInputs;
   std::vector<data_matcher::DataDescriptorMatcher> mInputMatchers;
+  /// Which of the distinct routes can match a given header
+  RouteDispatchTable mInputDispatch;
   std::vector<data_matcher::VariableContext> mVariableContextes;
   std::vector<CacheEntryStatus> mCachedStateMetrics;
   std::vector<PruneOp> mPruneOps;
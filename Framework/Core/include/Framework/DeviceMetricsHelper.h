@@ -42,6 +42,52 @@ struct DeviceMetricsHelper {
   static bool processMetric(ParsedMetricMatch& results,
                             DeviceMetricsInfo& info,
                             NewMetricCallback newMetricCallback = nullptr);
+  /// Marker at the beginning of a frame of binary metrics
+  static constexpr std::string_view BINARY_METRICS_MARKER = "[BMETRIC]";
+
+  /// @return true if @a s is a frame of binary metrics
+  static bool isBinaryMetrics(std::string_view const s)
+  {
+    return s.size() >= BINARY_METRICS_MARKER.size() && memcmp(s.data(), BINARY_METRICS_MARKER.data(), BINARY_METRICS_MARKER.size()) == 0;
+  }
+
+  /// Start a new frame of binary metrics in @a frame
+  static void beginBinaryMetrics(std::vector<char>& frame);
+
+  /// Append to @a frame the declaration of the metric with the device local
+  /// @a index. @a text is the text form of the first update of the metric.
+  static void declareBinaryMetric(std::vector<char>& frame, uint32_t index, std::string_view const text);
+
+  /// Append to @a frame an update of a previously declared metric.
+  template <typename T>
+  static void addBinaryMetric(std::vector<char>& frame, uint32_t index, T value, size_t timestamp)
+  {
+    static_assert(std::is_same_v<T, int> || std::is_same_v<T, uint64_t> || std::is_same_v<T, float>, "Unsupported metric type");
+    BinaryMetricRecord record;
+    record.index = index;
+    record.type = (uint32_t)getMetricType<T>();
+    record.timestamp = timestamp;
+    if constexpr (std::is_same_v<T, int>) {
+      record.intValue = value;
+    } else if constexpr (std::is_same_v<T, float>) {
+      record.floatValue = value;
+    } else {
+      record.uint64Value = value;
+    }
+    auto pos = frame.size();
+    frame.resize(pos + sizeof(BinaryMetricRecord));
+    memcpy(frame.data() + pos, &record, sizeof(BinaryMetricRecord));
+  }
+
+  /// Processes a frame of binary metrics and stores them in the backend store.
+  /// Declarations go through the same path as text metrics, the subsequent
+  /// updates are stored directly using the index of the declared metric.
+  ///
+  /// @return false if the frame is malformed.
+  static bool processBinaryMetrics(std::string_view const frame,
+                                   DeviceMetricsInfo& info,
+                                   NewMetricCallback newMetricCallback = nullptr);
+
   /// @return the index in metrics for the information of given metric
   static size_t metricIdxByName(const std::string& name,
                                 const DeviceMetricsInfo& info);
@@ -100,6 +100,25 @@ struct ParsedMetricMatch {
   char const* endStringValue;
 };
 
+/// Fixed size record used to send a numeric metric update from a device
+/// to the driver without going through its text representation.
+/// A frame of binary metrics starts with the "[BMETRIC]" marker followed by
+/// a sequence of records. A metric needs to be declared before its updates
+/// can be sent: a declaration is a record of type DECLARATION followed by
+/// size bytes containing the text form of the first update of the metric.
+struct BinaryMetricRecord {
+  static constexpr uint32_t DECLARATION = 0xffffffff;
+  uint32_t index;     // Index of the metric, as assigned by the device when declaring it
+  uint32_t type;      // MetricType of the value, or DECLARATION
+  uint64_t timestamp; // Timestamp of the update
+  union {
+    int intValue;
+    float floatValue;
+    uint64_t uint64Value;
+    uint64_t size; // Size of the text following a declaration
+  };
+};
+
 template <typename T>
 inline constexpr size_t metricStorageSize()
 {
@@ -170,6 +189,9 @@ struct DeviceMetricsInfo {
   std::vector<MetricPrefixIndex> metricLabelsPrefixesSortedIdx;
   std::vector<MetricInfo> metrics;
   std::vector<bool> changed;
+  // Index in metrics for each of the metrics declared by the device
+  // for the binary transport.
+  std::vector<size_t> binaryMetricsIndex;
 };
 
 struct DeviceMetricsInfoHelpers {
@@ -213,6 +235,7 @@ struct DeviceMetricsInfoHelpers {
       info.metricPrefixes.clear();
       info.metricLabelsAlphabeticallySortedIdx.clear();
       info.metricLabelsPrefixesSortedIdx.clear();
+      info.binaryMetricsIndex.clear();
       info.metrics.clear();
       info.changed.clear();
     }
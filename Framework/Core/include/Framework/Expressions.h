@@ -463,6 +463,15 @@ std::shared_ptr<gandiva::Projector> createProjector(gandiva::SchemaPtr const& Sc
 std::shared_ptr<gandiva::Projector> createProjector(gandiva::SchemaPtr const& Schema,
                                                     Projector&& p,
                                                     gandiva::FieldPtr result);
+/// Counters of the filters and projectors created in this process; the ones already
+/// compiled for the same schema and expressions are taken from the gandiva cache
+struct CompilationStats {
+  uint64_t hits = 0;            /// filters and projectors found in the gandiva cache
+  uint64_t misses = 0;          /// filters and projectors compiled
+  uint64_t compilationTime = 0; /// time spent compiling, in microseconds
+};
+/// Function to get the counters of the compiled filters and projectors
+CompilationStats getCompilationStats();
 /// Function for attaching gandiva filters to to compatible task inputs
 void updateExpressionInfos(expressions::Filter const& filter, std::vector<ExpressionInfo>& eInfos);
 /// Function to create gandiva condition expression from generic gandiva expression tree
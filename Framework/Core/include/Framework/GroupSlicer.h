@@ -179,17 +179,14 @@ struct GroupSlicer {
               return std::decay_t<A1>{{groupedElementsTable}, soa::SelectionVector{}};
             }
 
-            // for each grouping element we need to slice the selection vector
+            // for each grouping element we need to slice the selection vector,
+            // the slice references it and its rows are shifted by the offset when used
             auto start_iterator = std::lower_bound(starts[index], selections[index]->end(), offset);
             auto stop_iterator = std::lower_bound(start_iterator, selections[index]->end(), offset + count);
             starts[index] = stop_iterator;
-            soa::SelectionVector slicedSelection{start_iterator, stop_iterator};
-            std::transform(slicedSelection.begin(), slicedSelection.end(), slicedSelection.begin(),
-                           [&offset](int64_t idx) {
-                             return idx - static_cast<int64_t>(offset);
-                           });
+            auto slicedSelection = selections[index]->subspan(start_iterator - selections[index]->begin(), stop_iterator - start_iterator);
 
-            std::decay_t<A1> typedTable{{groupedElementsTable}, std::move(slicedSelection), offset};
+            std::decay_t<A1> typedTable{{groupedElementsTable}, slicedSelection, offset, static_cast<int64_t>(offset)};
             typedTable.bindInternalIndicesTo(&originalTable);
             return typedTable;
 
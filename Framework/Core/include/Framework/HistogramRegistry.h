@@ -48,6 +48,13 @@ struct HistFiller {
   template <typename... Cs, typename R, typename T>
   static void fillHistAny(std::shared_ptr<R> hist, const T& table, const o2::framework::expressions::Filter& filter);
 
+  // fill TH1, TH2 or TH3 with columns (Cs) of a filtered table in one go by reading the arrow buffers directly (other histogram types are filled row by row)
+  template <typename... Cs, typename R, typename T>
+  static void fillHistBulk(std::shared_ptr<R> hist, const T& table, const o2::framework::expressions::Filter& filter);
+
+  // fill TH1, TH2 or TH3 with nEntries coordinates given as one contiguous array per dimension (and optionally the corresponding weights)
+  static void fillHistBulk(TH1* hist, int64_t nEntries, std::array<double const*, 3> const& positions, double const* weights = nullptr);
+
   // function that returns rough estimate for the size of a histogram in MB
   template <typename T>
   static double getSize(std::shared_ptr<T> hist, double fillFraction = 1.);
@@ -62,6 +69,10 @@ struct HistFiller {
 
   template <typename B, typename T>
   static int getBaseElementSize(T* ptr);
+
+  // helper function to copy the selected rows of a persistent column into a contiguous buffer
+  template <typename C>
+  static void gatherColumn(arrow::Table* table, o2::soa::SelectionVector const& rows, std::vector<double>& values);
 };
 
 //**************************************************************************************************
@@ -133,6 +144,10 @@ class HistogramRegistry
   template <typename... Cs, typename T>
   void fill(const HistName& histName, const T& table, const o2::framework::expressions::Filter& filter);
 
+  // fill hist with content of (filtered) table columns in one go (bulk filling is available for TH1, TH2 and TH3)
+  template <typename... Cs, typename T>
+  void fillBulk(const HistName& histName, const T& table, const o2::framework::expressions::Filter& filter);
+
   // get rough estimate for size of histogram stored in registry
   double getSize(const HistName& histName, double fillFraction = 1.);
 
@@ -245,6 +260,60 @@ void HistFiller::fillHistAny(std::shared_ptr<R> hist, const T& table, const o2::
   }
 }
 
+template <typename... Cs, typename R, typename T>
+void HistFiller::fillHistBulk(std::shared_ptr<R> hist, const T& table, const o2::framework::expressions::Filter& filter)
+{
+  constexpr int nColumns = sizeof...(Cs);
+  constexpr int nDim = std::is_same_v<TH3, R> ? 3 : (std::is_same_v<TH2, R> ? 2 : 1);
+  constexpr bool validBulkFill = (std::is_same_v<TH1, R> || std::is_same_v<TH2, R> || std::is_same_v<TH3, R>) && (nColumns == nDim || nColumns == nDim + 1);
+
+  if constexpr (validBulkFill) {
+    static_assert(std::conjunction_v<typename Cs::persistent...>, "Bulk filling: only persistent columns accepted (not dynamic and not index ones)");
+    auto arrowTable = table.asArrowTable();
+    auto rows = o2::soa::selectionToVector(o2::framework::expressions::createSelection(arrowTable, filter));
+
+    std::array<std::vector<double>, nColumns> values;
+    int iColumn = 0;
+    (gatherColumn<Cs>(arrowTable.get(), rows, values[iColumn++]), ...);
+
+    std::array<double const*, 3> positions{};
+    for (int d = 0; d < nDim; ++d) {
+      positions[d] = values[d].data();
+    }
+    double const* weights = (nColumns == nDim + 1) ? values[nColumns - 1].data() : nullptr;
+    fillHistBulk(hist.get(), rows.size(), positions, weights);
+  } else {
+    fillHistAny<Cs...>(hist, table, filter);
+  }
+}
+
+template <typename C>
+void HistFiller::gatherColumn(arrow::Table* table, o2::soa::SelectionVector const& rows, std::vector<double>& values)
+{
+  using value_t = typename C::type;
+  static_assert(std::is_arithmetic_v<value_t> && !std::is_same_v<value_t, bool>, "Bulk filling: only numeric columns accepted");
+
+  values.resize(rows.size());
+  if (rows.empty()) {
+    return;
+  }
+  // selected rows are sorted, so the chunks of the column can be walked in a single pass
+  auto column = o2::soa::getIndexFromLabel(table, C::columnLabel());
+  int chunk = -1;
+  int64_t chunkBegin = 0;
+  int64_t chunkEnd = 0;
+  value_t const* raw = nullptr;
+  for (size_t i = 0; i < rows.size(); ++i) {
+    while (rows[i] >= chunkEnd) {
+      ++chunk;
+      chunkBegin = chunkEnd;
+      chunkEnd += column->chunk(chunk)->length();
+      raw = std::static_pointer_cast<o2::soa::arrow_array_for_t<value_t>>(column->chunk(chunk))->raw_values();
+    }
+    values[i] = static_cast<double>(raw[rows[i] - chunkBegin]);
+  }
+}
+
 template <typename T>
 double HistFiller::getSize(std::shared_ptr<T> hist, double fillFraction)
 {
@@ -422,5 +491,11 @@ void HistogramRegistry::fill(const HistName& histName, const T& table, const o2:
   std::visit([&table, &filter](auto&& hist) { HistFiller::fillHistAny<Cs...>(hist, table, filter); }, mRegistryValue[getHistIndex(histName)]);
 }
 
+template <typename... Cs, typename T>
+void HistogramRegistry::fillBulk(const HistName& histName, const T& table, const o2::framework::expressions::Filter& filter)
+{
+  std::visit([&table, &filter](auto&& hist) { HistFiller::fillHistBulk<Cs...>(hist, table, filter); }, mRegistryValue[getHistIndex(histName)]);
+}
+
 } // namespace o2::framework
 #endif // FRAMEWORK_HISTOGRAMREGISTRY_H_
@@ -0,0 +1,75 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#ifndef O2_FRAMEWORK_ROUTEDISPATCHTABLE_H_
+#define O2_FRAMEWORK_ROUTEDISPATCHTABLE_H_
+
+#include "Framework/ConcreteDataMatcher.h"
+#include "Headers/DataHeader.h"
+
+#include <cstddef>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace o2::framework
+{
+
+/// Lookup of the routes which can match a given (origin, description, subSpec).
+///
+/// The routes which match a single triplet are kept in a hash table, so
+/// that only the ones matching the triplet are checked, independently of
+/// how many routes there are. The others (wildcards, variables) are kept
+/// in a list and always checked. The candidates are visited in the order
+/// of the routes, so that the first route accepted is the same as the one
+/// found by scanning all of them.
+class RouteDispatchTable
+{
+ public:
+  RouteDispatchTable() = default;
+  /// @a routes has for each route the triplet it matches, or std::nullopt
+  /// when it can match more than one.
+  explicit RouteDispatchTable(std::vector<std::optional<ConcreteDataMatcher>> const& routes);
+
+  /// Number of routes in the table
+  [[nodiscard]] size_t size() const { return mSize; }
+
+  /// Index of the first route which can match the triplet and for which
+  /// @a accept(index) returns true, -1 if there is none.
+  template <typename F>
+  int find(header::DataOrigin const& origin, header::DataDescription const& description, header::DataHeader::SubSpecificationType subSpec, F&& accept) const
+  {
+    static std::vector<int> const noRoutes;
+    auto found = mConcreteRoutes.find(ConcreteDataMatcher{origin, description, subSpec});
+    auto const& concrete = found == mConcreteRoutes.end() ? noRoutes : found->second;
+    auto ci = concrete.begin();
+    auto gi = mGenericRoutes.begin();
+    while (ci != concrete.end() || gi != mGenericRoutes.end()) {
+      int ri = (gi == mGenericRoutes.end() || (ci != concrete.end() && *ci < *gi)) ? *ci++ : *gi++;
+      if (accept(ri)) {
+        return ri;
+      }
+    }
+    return -1;
+  }
+
+ private:
+  struct Hash {
+    size_t operator()(ConcreteDataMatcher const& matcher) const;
+  };
+
+  std::unordered_map<ConcreteDataMatcher, std::vector<int>, Hash> mConcreteRoutes;
+  std::vector<int> mGenericRoutes;
+  size_t mSize = 0;
+};
+
+} // namespace o2::framework
+
+#endif // O2_FRAMEWORK_ROUTEDISPATCHTABLE_H_
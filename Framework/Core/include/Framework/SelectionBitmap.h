@@ -0,0 +1,127 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#ifndef O2_FRAMEWORK_SELECTIONBITMAP_H_
+#define O2_FRAMEWORK_SELECTIONBITMAP_H_
+
+#include "Framework/Expressions.h"
+#include <gsl/span>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace o2::soa
+{
+using SelectionVector = std::vector<int64_t>;
+
+/// Set of selected rows of a table, one bit per row. Union, intersection and
+/// counting work on 64 rows at a time, independently of how many are selected,
+/// which makes them cheaper than the equivalent operations on sorted row
+/// vectors as soon as more than a few percent of the rows are selected.
+class SelectionBitmap
+{
+ public:
+  using word_t = uint64_t;
+  static constexpr int64_t WordBits = 64;
+
+  /// Rows [start, end) of a bitmap, without copying it
+  class View
+  {
+   public:
+    View(SelectionBitmap const& bitmap, int64_t start, int64_t end) : mBitmap{&bitmap}, mStart{start}, mEnd{end} {}
+
+    [[nodiscard]] int64_t start() const { return mStart; }
+    [[nodiscard]] int64_t end() const { return mEnd; }
+    /// Number of selected rows in the range
+    [[nodiscard]] int64_t count() const { return mBitmap->count(mStart, mEnd); }
+    /// Call f(row) for the selected rows of the range, in increasing order
+    template <typename F>
+    void forEach(F&& f) const
+    {
+      mBitmap->forEach(mStart, mEnd, std::forward<F>(f));
+    }
+    /// Selected rows of the range, relative to its start, as needed for a slice of the table
+    [[nodiscard]] SelectionVector toVector() const;
+
+   private:
+    SelectionBitmap const* mBitmap;
+    int64_t mStart;
+    int64_t mEnd;
+  };
+
+  SelectionBitmap() = default;
+  explicit SelectionBitmap(int64_t nRows) : mRows{nRows}, mWords((nRows + WordBits - 1) / WordBits, 0) {}
+  /// Bitmap of nRows rows with the given sorted row indices selected
+  SelectionBitmap(gsl::span<int64_t const> rows, int64_t nRows);
+  /// Bitmap of nRows rows with the rows of a gandiva selection selected
+  SelectionBitmap(gandiva::Selection const& selection, int64_t nRows);
+
+  [[nodiscard]] int64_t rows() const { return mRows; }
+
+  void set(int64_t row) { mWords[row / WordBits] |= word_t{1} << (row % WordBits); }
+  void reset(int64_t row) { mWords[row / WordBits] &= ~(word_t{1} << (row % WordBits)); }
+  [[nodiscard]] bool test(int64_t row) const { return (mWords[row / WordBits] >> (row % WordBits)) & 1; }
+
+  /// Number of selected rows
+  [[nodiscard]] int64_t count() const { return count(0, mRows); }
+  /// Number of selected rows in [start, end)
+  [[nodiscard]] int64_t count(int64_t start, int64_t end) const;
+
+  /// Union with another bitmap, the number of rows is the largest of the two
+  SelectionBitmap& operator|=(SelectionBitmap const& other);
+  /// Intersection with another bitmap, the rows beyond the other one are dropped
+  SelectionBitmap& operator&=(SelectionBitmap const& other);
+
+  /// The rows [start, end), without copy
+  [[nodiscard]] View slice(int64_t start, int64_t end) const { return View{*this, start, end}; }
+
+  /// Call f(row) for the selected rows in [start, end), in increasing order
+  template <typename F>
+  void forEach(int64_t start, int64_t end, F&& f) const
+  {
+    if (start >= end) {
+      return;
+    }
+    auto first = start / WordBits;
+    auto last = (end - 1) / WordBits;
+    for (auto i = first; i <= last; ++i) {
+      auto word = mWords[i];
+      if (i == first) {
+        word &= ~word_t{0} << (start % WordBits);
+      }
+      if (i == last && end % WordBits != 0) {
+        word &= ~(~word_t{0} << (end % WordBits));
+      }
+      while (word != 0) {
+        f(i * WordBits + __builtin_ctzll(word));
+        word &= word - 1;
+      }
+    }
+  }
+
+  /// Selected rows as sorted indices
+  [[nodiscard]] SelectionVector toVector() const { return slice(0, mRows).toVector(); }
+  /// Selected rows as a gandiva selection
+  [[nodiscard]] gandiva::Selection toSelection() const;
+
+ private:
+  int64_t mRows = 0;
+  std::vector<word_t> mWords;
+};
+
+/// Union of two sorted selections
+SelectionVector selectionUnion(gsl::span<int64_t const> a, gsl::span<int64_t const> b);
+/// Intersection of two sorted selections
+SelectionVector selectionIntersection(gsl::span<int64_t const> a, gsl::span<int64_t const> b);
+} // namespace o2::soa
+
+#endif // O2_FRAMEWORK_SELECTIONBITMAP_H_
@@ -31,6 +31,12 @@ namespace o2::framework
 //    OR t2t.addBranch(column.get(), field.get()), ...;
 //  . t2t.process();
 //
+// ParallelTableToTree does the same for several tables, with the baskets of
+// the different tables compressed concurrently:
+//  . ParallelTableToTree writer(nThreads);
+//  . writer.addTable(ta1, f, treename1); writer.addTable(ta2, f, treename2, {col1, col2}); ...
+//  . writer.process();
+//
 // .............................................................................
 // -----------------------------------------------------------------------------
 // TreeToTable allows to fill the contents of a given TTree to an arrow::Table
@@ -121,6 +127,43 @@ class TableToTree
   std::vector<std::unique_ptr<ColumnToBranch>> mColumnReaders;
 };
 
+/// Writes several tables to trees, compressing the tables concurrently.
+/// Every table is written by one of the threads with TableToTree to a tree
+/// of its own in-memory file, then the compressed baskets are copied without
+/// decompression to their destination, in the order the tables were added.
+/// The layout of the output files hence does not depend on the number of
+/// threads. The tables are processed in groups of at most maxBytesInFlight
+/// bytes, which bounds the memory taken by the compressed baskets.
+class ParallelTableToTree
+{
+ public:
+  ParallelTableToTree(int nThreads, int64_t maxBytesInFlight = 256 * 1024 * 1024);
+  ParallelTableToTree(ParallelTableToTree const&) = delete;
+
+  /// Write @a table to @a treename in @a file, with only the given
+  /// columns if any.
+  void addTable(std::shared_ptr<arrow::Table> const& table, TFile* file, std::string treename, std::vector<std::string> const& columns = {});
+  /// Convert and write all the tables added since the last call
+  void process();
+
+ private:
+  struct Job {
+    std::shared_ptr<arrow::Table> table;
+    std::vector<int> columns;
+    TFile* file = nullptr;
+    std::string treename;
+    int64_t bytes = 0;
+    std::unique_ptr<TFile> buffer;
+  };
+
+  void convert(Job& job);
+  void write(Job& job);
+
+  int mNThreads = 1;
+  int64_t mMaxBytesInFlight = 0;
+  std::vector<Job> mJobs;
+};
+
 class TreeToTable
 {
  public:
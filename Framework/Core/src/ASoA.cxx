@@ -17,11 +17,37 @@
 
 namespace o2::soa
 {
+namespace
+{
+template <typename A>
+SelectionVector copySelection(std::shared_ptr<arrow::Array> const& array)
+{
+  auto values = std::static_pointer_cast<A>(array)->raw_values();
+  return SelectionVector(values, values + array->length());
+}
+} // namespace
+
 SelectionVector selectionToVector(gandiva::Selection const& sel)
 {
-  SelectionVector rows;
-  rows.resize(sel->GetNumSlots());
-  for (auto i = 0; i < sel->GetNumSlots(); ++i) {
+  if (sel == nullptr) {
+    return {};
+  }
+  // the index type depends on how the selection was made, gandiva uses unsigned ones
+  auto array = sel->ToArray();
+  switch (array->type_id()) {
+    case arrow::Type::UINT16:
+      return copySelection<arrow::UInt16Array>(array);
+    case arrow::Type::UINT32:
+      return copySelection<arrow::UInt32Array>(array);
+    case arrow::Type::UINT64:
+      return copySelection<arrow::UInt64Array>(array);
+    case arrow::Type::INT64:
+      return copySelection<arrow::Int64Array>(array);
+    default:
+      break;
+  }
+  SelectionVector rows(sel->GetNumSlots());
+  for (int64_t i = 0; i < sel->GetNumSlots(); ++i) {
     rows[i] = sel->GetIndex(i);
   }
   return rows;
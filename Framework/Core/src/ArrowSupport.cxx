@@ -23,6 +23,7 @@
 #include "Framework/EndOfStreamContext.h"
 #include "Framework/Tracing.h"
 #include "Framework/DeviceMetricsInfo.h"
+#include "Framework/Expressions.h"
 #include "Framework/DeviceMetricsHelper.h"
 #include "Framework/DeviceInfo.h"
 #include "Framework/DevicesManager.h"
@@ -391,6 +392,10 @@ o2::framework::ServiceSpec ArrowSupport::arrowBackendSpec()
                        auto& stats = ctx.services().get<DataProcessingStats>();
                        stats.updateStats({static_cast<short>(ProcessingStatsId::ARROW_BYTES_DESTROYED), DataProcessingStats::Op::Set, static_cast<int64_t>(arrow->bytesDestroyed())});
                        stats.updateStats({static_cast<short>(ProcessingStatsId::ARROW_MESSAGES_DESTROYED), DataProcessingStats::Op::Set, static_cast<int64_t>(arrow->messagesDestroyed())});
+                       auto compilation = expressions::getCompilationStats();
+                       stats.updateStats({static_cast<short>(ProcessingStatsId::GANDIVA_CACHE_HITS), DataProcessingStats::Op::Set, static_cast<int64_t>(compilation.hits)});
+                       stats.updateStats({static_cast<short>(ProcessingStatsId::GANDIVA_CACHE_MISSES), DataProcessingStats::Op::Set, static_cast<int64_t>(compilation.misses)});
+                       stats.updateStats({static_cast<short>(ProcessingStatsId::GANDIVA_COMPILATION_TIME_US), DataProcessingStats::Op::Set, static_cast<int64_t>(compilation.compilationTime)});
                        stats.processCommandQueue(); },
     .driverInit = [](ServiceRegistryRef registry, DeviceConfig const& dc) {
                        auto config = new RateLimitConfig{};
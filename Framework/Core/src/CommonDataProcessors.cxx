@@ -320,8 +320,14 @@ DataProcessorSpec
     std::vector<TString> aodMetaDataKeys;
     std::vector<TString> aodMetaDataVals;
 
+    // with several threads the tables of a time frame are compressed concurrently
+    std::shared_ptr<ParallelTableToTree> writer;
+    if (dod->getNumberOfWriterThreads() > 1) {
+      writer = std::make_shared<ParallelTableToTree>(dod->getNumberOfWriterThreads());
+    }
+
     // this functor is called once per time frame
-    return [dod, tfNumbers, tfFilenames, aodMetaDataKeys, aodMetaDataVals](ProcessingContext& pc) mutable -> void {
+    return [dod, tfNumbers, tfFilenames, aodMetaDataKeys, aodMetaDataVals, writer](ProcessingContext& pc) mutable -> void {
       LOGP(debug, "======== getGlobalAODSink::processing ==========");
       LOGP(debug, " processing data set with {} entries", pc.inputs().size());
 
@@ -418,9 +424,6 @@ DataProcessorSpec
         for (auto d : ds) {
           auto fileAndFolder = dod->getFileFolder(d, tfNumber, aodInputFile);
           auto treename = fileAndFolder.folderName + "/" + d->treename;
-          TableToTree ta2tr(table,
-                            fileAndFolder.file,
-                            treename.c_str());
 
           // update metadata
           if (fileAndFolder.file->FindObjectAny("metaData")) {
@@ -433,13 +436,22 @@ DataProcessorSpec
             fileAndFolder.file->WriteObject(&aodMetaDataMap, "metaData", "Overwrite");
           }
 
+          // the tables of the time frame are compressed concurrently once they are all known
+          if (writer) {
+            writer->addTable(table, fileAndFolder.file, treename, d->colnames);
+            continue;
+          }
+
+          TableToTree ta2tr(table,
+                            fileAndFolder.file,
+                            treename.c_str());
           if (!d->colnames.empty()) {
             for (auto& cn : d->colnames) {
               auto idx = table->schema()->GetFieldIndex(cn);
-              auto col = table->column(idx);
-              auto field = table->schema()->field(idx);
               if (idx != -1) {
-                ta2tr.addBranch(col, field);
+                ta2tr.addBranch(table->column(idx), table->schema()->field(idx));
+              } else {
+                LOGP(warning, "Column {} is not in the table and will not be saved to {}", cn, treename);
               }
             }
           } else {
@@ -448,6 +460,9 @@ DataProcessorSpec
           ta2tr.process();
         }
       }
+      if (writer) {
+        writer->process();
+      }
     };
   }; // end of writerFunction
 
@@ -95,7 +95,10 @@ o2::framework::ServiceSpec CommonServices::monitoringSpec()
       o2::monitoring::Monitoring* monitoring;
       if (useDPL) {
         monitoring = new Monitoring();
-        auto dplBackend = std::make_unique<DPLMonitoringBackend>(registry);
+        // Numeric metrics are sent in binary form when talking to the driver via websocket,
+        // unless DPL_TEXT_METRICS is set.
+        bool binaryMetrics = isWebsocket && getenv("DPL_TEXT_METRICS") == nullptr;
+        auto dplBackend = std::make_unique<DPLMonitoringBackend>(registry, binaryMetrics);
         (dynamic_cast<o2::monitoring::Backend*>(dplBackend.get()))->setVerbosity(o2::monitoring::Verbosity::Debug);
         monitoring->addBackend(std::move(dplBackend));
       } else {
@@ -935,6 +938,30 @@ o2::framework::ServiceSpec CommonServices::dataProcessingStats()
                    .scope = Scope::DPL,
                    .minPublishInterval = 0,
                    .maxRefreshLatency = 10000,
+                   .sendInitialValue = true},
+        MetricSpec{.name = "gandiva-cache-hits",
+                   .enabled = arrowAndResourceLimitingMetrics,
+                   .metricId = static_cast<short>(ProcessingStatsId::GANDIVA_CACHE_HITS),
+                   .kind = Kind::UInt64,
+                   .scope = Scope::DPL,
+                   .minPublishInterval = 0,
+                   .maxRefreshLatency = 10000,
+                   .sendInitialValue = true},
+        MetricSpec{.name = "gandiva-cache-misses",
+                   .enabled = arrowAndResourceLimitingMetrics,
+                   .metricId = static_cast<short>(ProcessingStatsId::GANDIVA_CACHE_MISSES),
+                   .kind = Kind::UInt64,
+                   .scope = Scope::DPL,
+                   .minPublishInterval = 0,
+                   .maxRefreshLatency = 10000,
+                   .sendInitialValue = true},
+        MetricSpec{.name = "gandiva-compilation-time-us",
+                   .enabled = arrowAndResourceLimitingMetrics,
+                   .metricId = static_cast<short>(ProcessingStatsId::GANDIVA_COMPILATION_TIME_US),
+                   .kind = Kind::UInt64,
+                   .scope = Scope::DPL,
+                   .minPublishInterval = 0,
+                   .maxRefreshLatency = 10000,
                    .sendInitialValue = true}};
 
       for (auto& metric : metrics) {
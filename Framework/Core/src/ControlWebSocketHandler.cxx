@@ -40,6 +40,15 @@ void ControlWebSocketHandler::frame(char const* frame, size_t s)
     }
     return false;
   };
+  if (DeviceMetricsHelper::isBinaryMetrics(tokenSV)) {
+    assert(mContext.metrics);
+    if (DeviceMetricsHelper::processBinaryMetrics(tokenSV, (*mContext.metrics)[mIndex], newMetricCallback) == false) {
+      LOG(error) << "Malformed binary metrics received from pid " << mPid;
+    }
+    didProcessMetric = true;
+    didHaveNewMetric |= hasNewMetric;
+    return;
+  }
   LOG(debug3) << "Data received: " << std::string_view(frame, s);
   if (DeviceMetricsHelper::parseMetric(tokenSV, metricMatch)) {
     // We use this callback to cache which metrics are needed to provide a
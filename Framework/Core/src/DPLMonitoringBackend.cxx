@@ -11,6 +11,7 @@
 
 #include "DPLMonitoringBackend.h"
 #include "Framework/DriverClient.h"
+#include "Framework/DeviceMetricsHelper.h"
 #include "Framework/ServiceRegistry.h"
 #include "Framework/RuntimeError.h"
 #include <fmt/format.h>
@@ -27,9 +28,11 @@ template <class... Ts>
 overloaded(Ts...) -> overloaded<Ts...>;
 
 
-DPLMonitoringBackend::DPLMonitoringBackend(ServiceRegistryRef registry)
-  : mRegistry{registry}
+DPLMonitoringBackend::DPLMonitoringBackend(ServiceRegistryRef registry, bool binaryMetrics)
+  : mRegistry{registry},
+    mBinaryMetrics{binaryMetrics}
 {
+  DeviceMetricsHelper::beginBinaryMetrics(mBinaryFrame);
 }
 
 void DPLMonitoringBackend::addGlobalTag(std::string_view name, std::string_view value)
@@ -38,13 +41,6 @@ void DPLMonitoringBackend::addGlobalTag(std::string_view name, std::string_view
   mTagString += fmt::format("{}{}={}", mTagString.empty() ? "" : ",", name.data(), value);
 }
 
-void DPLMonitoringBackend::send(std::vector<o2::monitoring::Metric>&& metrics)
-{
-  for (auto& m : metrics) {
-    send(m);
-  }
-}
-
 inline unsigned long convertTimestamp(const std::chrono::time_point<std::chrono::system_clock>& timestamp)
 {
   return std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -52,9 +48,8 @@ inline unsigned long convertTimestamp(const std::chrono::time_point<std::chrono:
     .count();
 }
 
-void DPLMonitoringBackend::send(o2::monitoring::Metric const& metric)
+size_t DPLMonitoringBackend::format(o2::monitoring::Metric const& metric, std::array<char, 4096>& buffer)
 {
-  std::array<char, 4096> buffer;
   auto mStream = fmt::format_to(buffer.begin(), "[METRIC] {}", metric.getName());
   for (auto& value : metric.getValues()) {
     auto stringValue = std::visit(overloaded{
@@ -84,6 +79,75 @@ void DPLMonitoringBackend::send(o2::monitoring::Metric const& metric)
     throw runtime_error_f("Metric too long");
   }
   buffer[size] = '\0';
+  return size;
+}
+
+bool DPLMonitoringBackend::addBinary(o2::monitoring::Metric const& metric)
+{
+  if (metric.getValuesSize() != 1) {
+    return false;
+  }
+  auto const& value = metric.getValues().front().second;
+  if (std::holds_alternative<std::string>(value)) {
+    return false;
+  }
+  auto [it, inserted] = mBinaryMetricsIndex.try_emplace(metric.getName(), mBinaryMetricsIndex.size());
+  if (inserted) {
+    // The first update declares the metric, using its text form.
+    std::array<char, 4096> buffer;
+    auto size = format(metric, buffer);
+    DeviceMetricsHelper::declareBinaryMetric(mBinaryFrame, it->second, std::string_view(buffer.data(), size));
+    return true;
+  }
+  auto index = it->second;
+  auto timestamp = convertTimestamp(metric.getTimestamp());
+  std::visit(overloaded{
+               [](const std::string&) {},
+               [&](int v) { DeviceMetricsHelper::addBinaryMetric<int>(mBinaryFrame, index, v, timestamp); },
+               [&](double v) { DeviceMetricsHelper::addBinaryMetric<float>(mBinaryFrame, index, v, timestamp); },
+               [&](uint64_t v) { DeviceMetricsHelper::addBinaryMetric<uint64_t>(mBinaryFrame, index, v, timestamp); }},
+             value);
+  return true;
+}
+
+void DPLMonitoringBackend::flushBinary()
+{
+  if (mBinaryFrame.size() > DeviceMetricsHelper::BINARY_METRICS_MARKER.size()) {
+    mRegistry.get<framework::DriverClient>().tell(mBinaryFrame.data(), mBinaryFrame.size());
+  }
+  DeviceMetricsHelper::beginBinaryMetrics(mBinaryFrame);
+}
+
+void DPLMonitoringBackend::send(std::vector<o2::monitoring::Metric>&& metrics)
+{
+  if (!mBinaryMetrics) {
+    for (auto& m : metrics) {
+      send(m);
+    }
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mBinaryMutex);
+  for (auto& m : metrics) {
+    if (!addBinary(m)) {
+      std::array<char, 4096> buffer;
+      auto size = format(m, buffer);
+      mRegistry.get<framework::DriverClient>().tell(buffer.data(), size);
+    }
+  }
+  flushBinary();
+}
+
+void DPLMonitoringBackend::send(o2::monitoring::Metric const& metric)
+{
+  if (mBinaryMetrics) {
+    std::lock_guard<std::mutex> lock(mBinaryMutex);
+    if (addBinary(metric)) {
+      flushBinary();
+      return;
+    }
+  }
+  std::array<char, 4096> buffer;
+  auto size = format(metric, buffer);
   mRegistry.get<framework::DriverClient>().tell(buffer.data(), size);
 }
 
@@ -13,7 +13,11 @@
 
 #include "Framework/ServiceRegistryRef.h"
 #include "Monitoring/Backend.h"
+#include <array>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace o2::framework
 {
@@ -25,7 +29,8 @@ class DPLMonitoringBackend final : public o2::monitoring::Backend
 {
  public:
   /// Default constructor
-  DPLMonitoringBackend(ServiceRegistryRef registry);
+  /// \param binaryMetrics send numeric metrics to the driver in binary form
+  DPLMonitoringBackend(ServiceRegistryRef registry, bool binaryMetrics = false);
 
   /// Default destructor
   ~DPLMonitoringBackend() override = default;
@@ -44,9 +49,24 @@ class DPLMonitoringBackend final : public o2::monitoring::Backend
   void addGlobalTag(std::string_view name, std::string_view value) override;
 
  private:
+  /// Formats the metric in its text form
+  /// \return size of the formatted metric
+  size_t format(o2::monitoring::Metric const& metric, std::array<char, 4096>& buffer);
+
+  /// Adds the metric to the pending binary frame
+  /// \return false if the metric cannot be sent in binary form
+  bool addBinary(o2::monitoring::Metric const& metric);
+
+  /// Sends the pending binary frame to the driver
+  void flushBinary();
+
   std::string mTagString;    ///< Global tagset (common for each metric)
   const std::string mPrefix; ///< Metric prefix
   ServiceRegistryRef mRegistry;
+  bool mBinaryMetrics = false;                                      ///< Send numeric metrics in binary form
+  std::mutex mBinaryMutex;                                          ///< Protects the binary frame and the index
+  std::unordered_map<std::string, uint32_t> mBinaryMetricsIndex;    ///< Index of the metrics declared to the driver
+  std::vector<char> mBinaryFrame;                                   ///< Pending binary metrics
 };
 
 } // namespace o2::framework
@@ -47,12 +47,23 @@ DataAllocator::DataAllocator(ServiceRegistryRef contextRegistry)
 RouteIndex DataAllocator::matchDataHeader(const Output& spec, size_t timeslice)
 {
   auto& allowedOutputRoutes = mRegistry.get<DeviceSpec const>().outputs;
-  // FIXME: we should take timeframeId into account as well.
-  for (auto ri = 0; ri < allowedOutputRoutes.size(); ++ri) {
-    auto& route = allowedOutputRoutes[ri];
-    if (DataSpecUtils::match(route.matcher, spec.origin, spec.description, spec.subSpec) && ((timeslice % route.maxTimeslices) == route.timeslice)) {
-      return RouteIndex{ri};
+  // The routes do not change once the device is running, so the dispatch
+  // table is compiled the first time a message is created.
+  if (O2_BUILTIN_UNLIKELY(mOutputDispatch.size() != allowedOutputRoutes.size())) {
+    std::vector<std::optional<ConcreteDataMatcher>> concrete;
+    concrete.reserve(allowedOutputRoutes.size());
+    for (auto& route : allowedOutputRoutes) {
+      concrete.push_back(DataSpecUtils::asOptionalConcreteDataMatcher(route.matcher));
     }
+    mOutputDispatch = RouteDispatchTable{concrete};
+  }
+  // FIXME: we should take timeframeId into account as well.
+  auto ri = mOutputDispatch.find(spec.origin, spec.description, spec.subSpec, [&](int index) {
+    auto& route = allowedOutputRoutes[index];
+    return DataSpecUtils::match(route.matcher, spec.origin, spec.description, spec.subSpec) && ((timeslice % route.maxTimeslices) == route.timeslice);
+  });
+  if (ri >= 0) {
+    return RouteIndex{ri};
   }
   throw runtime_error_f(
     "Worker is not authorised to create message with "
@@ -68,6 +68,7 @@ DataRelayer::DataRelayer(const CompletionPolicy& policy,
     mCompletionPolicy{policy},
     mDistinctRoutesIndex{DataRelayerHelpers::createDistinctRouteIndex(routes)},
     mInputMatchers{DataRelayerHelpers::createInputMatchers(routes)},
+    mInputDispatch{DataRelayerHelpers::createInputDispatchTable(mInputMatchers, mDistinctRoutesIndex)},
     mMaxLanes{InputRouteHelpers::maxLanes(routes)}
 {
   std::scoped_lock<LockableBase(std::recursive_mutex)> lock(mMutex);
@@ -236,16 +237,30 @@ DataRelayer::ActivityStats DataRelayer::processDanglingInputs(std::vector<Expira
 size_t matchToContext(void const* data,
                       std::vector<DataDescriptorMatcher> const& matchers,
                       std::vector<size_t> const& index,
+                      RouteDispatchTable const& dispatch,
                       VariableContext& context)
 {
-  for (size_t ri = 0, re = index.size(); ri < re; ++ri) {
+  auto matchRoute = [&](size_t ri) {
     auto& matcher = matchers[index[ri]];
 
     if (matcher.match(reinterpret_cast<char const*>(data), context)) {
       context.commit();
-      return ri;
+      return true;
     }
     context.discard();
+    return false;
+  };
+
+  // Only the routes which can match the header are tried, in their order
+  auto const* dh = o2::header::get<DataHeader*>(data);
+  if (O2_BUILTIN_LIKELY(dh != nullptr)) {
+    auto ri = dispatch.find(dh->dataOrigin, dh->dataDescription, dh->subSpecification, matchRoute);
+    return ri < 0 ? INVALID_INPUT : ri;
+  }
+  for (size_t ri = 0, re = index.size(); ri < re; ++ri) {
+    if (matchRoute(ri)) {
+      return ri;
+    }
   }
   return INVALID_INPUT;
 }
@@ -404,12 +419,13 @@ DataRelayer::RelayChoice
   // become more complicated when we will start supporting ranges.
   auto getInputTimeslice = [&matchers = mInputMatchers,
                             &distinctRoutes = mDistinctRoutesIndex,
+                            &dispatch = mInputDispatch,
                             &rawHeader,
                             &index = mTimesliceIndex](VariableContext& context)
     -> std::tuple<int, TimesliceId> {
     /// FIXME: for the moment we only use the first context and reset
     /// between one invokation and the other.
-    auto input = matchToContext(rawHeader, matchers, distinctRoutes, context);
+    auto input = matchToContext(rawHeader, matchers, distinctRoutes, dispatch, context);
 
     if (input == INVALID_INPUT) {
       return {
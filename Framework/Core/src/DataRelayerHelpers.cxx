@@ -11,7 +11,9 @@
 
 #include "DataRelayerHelpers.h"
 #include "Framework/DataDescriptorMatcher.h"
+#include "Framework/DataSpecUtils.h"
 #include "Framework/InputRoute.h"
+#include <optional>
 #include <stdexcept>
 
 using namespace o2::framework::data_matcher;
@@ -70,4 +72,18 @@ std::vector<DataDescriptorMatcher>
   return result;
 }
 
+/// Routes which match a single (origin, description, subSpec) are looked
+/// up by it, the others are checked for every header.
+RouteDispatchTable
+  DataRelayerHelpers::createInputDispatchTable(std::vector<DataDescriptorMatcher> const& matchers,
+                                               std::vector<size_t> const& distinctRoutes)
+{
+  std::vector<std::optional<ConcreteDataMatcher>> concrete;
+  concrete.reserve(distinctRoutes.size());
+  for (auto ri : distinctRoutes) {
+    concrete.push_back(DataSpecUtils::optionalConcreteDataMatcherFrom(matchers[ri]));
+  }
+  return RouteDispatchTable{concrete};
+}
+
 } // namespace o2::framework
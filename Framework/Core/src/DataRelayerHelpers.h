@@ -12,6 +12,7 @@
 #define O2_FRAMEWORK_DATARELAYERHELPERS_H_
 
 #include "Framework/InputRoute.h"
+#include "Framework/RouteDispatchTable.h"
 #include <vector>
 
 namespace o2::framework
@@ -23,6 +24,9 @@ struct DataRelayerHelpers {
   static std::vector<size_t> createDistinctRouteIndex(std::vector<InputRoute> const&);
   /// This converts from InputRoute to the associated DataDescriptorMatcher.
   static std::vector<data_matcher::DataDescriptorMatcher> createInputMatchers(std::vector<InputRoute> const&);
+  /// Dispatch table of the distinct routes, indexed like @a distinctRoutes.
+  static RouteDispatchTable createInputDispatchTable(std::vector<data_matcher::DataDescriptorMatcher> const& matchers,
+                                                     std::vector<size_t> const& distinctRoutes);
 };
 
 } // namespace o2::framework
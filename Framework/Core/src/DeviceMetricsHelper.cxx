@@ -395,9 +395,66 @@ size_t DeviceMetricsHelper::bookMetricInfo(DeviceMetricsInfo& info, char const*
   return metricIndex;
 }
 
-bool DeviceMetricsHelper::processMetric(ParsedMetricMatch& match,
-                                        DeviceMetricsInfo& info,
-                                        DeviceMetricsHelper::NewMetricCallback newMetricsCallback)
+// Stores the value in @a match for the metric at @a metricIndex
+static bool updateMetric(DeviceMetricsInfo& info, size_t metricIndex, ParsedMetricMatch const& match, StringMetric const& stringValue)
+{
+  MetricInfo& metricInfo = info.metrics[metricIndex];
+
+  //  auto mod = info.timestamps[metricIndex].size();
+  auto sizeOfCollection = 0;
+  switch (metricInfo.type) {
+    case MetricType::Int: {
+      info.intMetrics[metricInfo.storeIdx][metricInfo.pos] = match.intValue;
+      sizeOfCollection = info.intMetrics[metricInfo.storeIdx].size();
+      info.intTimestamps[metricInfo.storeIdx][metricInfo.pos] = match.timestamp;
+    } break;
+    case MetricType::String: {
+      info.stringMetrics[metricInfo.storeIdx][metricInfo.pos] = stringValue;
+      sizeOfCollection = info.stringMetrics[metricInfo.storeIdx].size();
+      info.stringTimestamps[metricInfo.storeIdx][metricInfo.pos] = match.timestamp;
+    } break;
+    case MetricType::Float: {
+      info.floatMetrics[metricInfo.storeIdx][metricInfo.pos] = match.floatValue;
+      sizeOfCollection = info.floatMetrics[metricInfo.storeIdx].size();
+      info.floatTimestamps[metricInfo.storeIdx][metricInfo.pos] = match.timestamp;
+    } break;
+    case MetricType::Uint64: {
+      info.uint64Metrics[metricInfo.storeIdx][metricInfo.pos] = match.uint64Value;
+      sizeOfCollection = info.uint64Metrics[metricInfo.storeIdx].size();
+      info.uint64Timestamps[metricInfo.storeIdx][metricInfo.pos] = match.timestamp;
+    } break;
+    case MetricType::Enum: {
+      info.enumMetrics[metricInfo.storeIdx][metricInfo.pos] = match.intValue;
+      sizeOfCollection = info.enumMetrics[metricInfo.storeIdx].size();
+      info.enumTimestamps[metricInfo.storeIdx][metricInfo.pos] = match.timestamp;
+    } break;
+    default:
+      return false;
+      break;
+  };
+  // We do all the updates here, so that not update timestamps for broken metrics
+  // Notice how we always fill floatValue with the float equivalent of the metric
+  // regardless of it's type.
+  info.minDomain[metricIndex] = std::min(info.minDomain[metricIndex], (size_t)match.timestamp);
+  info.maxDomain[metricIndex] = std::max(info.maxDomain[metricIndex], (size_t)match.timestamp);
+  info.max[metricIndex] = std::max(info.max[metricIndex], match.floatValue);
+  info.min[metricIndex] = std::min(info.min[metricIndex], match.floatValue);
+  auto onlineAverage = [](float nextValue, float previousAverage, float previousCount) {
+    return previousAverage + (nextValue - previousAverage) / (previousCount + 1);
+  };
+  info.average[metricIndex] = onlineAverage(match.floatValue, info.average[metricIndex], metricInfo.filledMetrics);
+  // We point to the next metric
+  metricInfo.pos = (metricInfo.pos + 1) % sizeOfCollection;
+  ++metricInfo.filledMetrics;
+  // Note that we updated a given metric.
+  info.changed[metricIndex] = true;
+  return true;
+}
+
+// @return the index of the metric in @a info or -1 if the metric could not be processed
+static size_t processMetricImpl(ParsedMetricMatch& match,
+                                DeviceMetricsInfo& info,
+                                DeviceMetricsHelper::NewMetricCallback& newMetricsCallback)
 {
   // get the type
   size_t metricIndex = -1;
@@ -415,7 +472,7 @@ bool DeviceMetricsHelper::processMetric(ParsedMetricMatch& match,
       stringValue.data[lastChar] = '\0';
     } break;
     default:
-      return false;
+      return -1;
       break;
   };
 
@@ -484,58 +541,102 @@ bool DeviceMetricsHelper::processMetric(ParsedMetricMatch& match,
     metricIndex = mi->index;
   }
   assert(metricIndex != -1);
-  // We are now guaranteed our metric is present at metricIndex.
-  MetricInfo& metricInfo = info.metrics[metricIndex];
+  if (updateMetric(info, metricIndex, match, stringValue) == false) {
+    return -1;
+  }
+  return metricIndex;
+}
 
-  //  auto mod = info.timestamps[metricIndex].size();
-  auto sizeOfCollection = 0;
-  switch (metricInfo.type) {
-    case MetricType::Int: {
-      info.intMetrics[metricInfo.storeIdx][metricInfo.pos] = match.intValue;
-      sizeOfCollection = info.intMetrics[metricInfo.storeIdx].size();
-      info.intTimestamps[metricInfo.storeIdx][metricInfo.pos] = match.timestamp;
-    } break;
-    case MetricType::String: {
-      info.stringMetrics[metricInfo.storeIdx][metricInfo.pos] = stringValue;
-      sizeOfCollection = info.stringMetrics[metricInfo.storeIdx].size();
-      info.stringTimestamps[metricInfo.storeIdx][metricInfo.pos] = match.timestamp;
-    } break;
-    case MetricType::Float: {
-      info.floatMetrics[metricInfo.storeIdx][metricInfo.pos] = match.floatValue;
-      sizeOfCollection = info.floatMetrics[metricInfo.storeIdx].size();
-      info.floatTimestamps[metricInfo.storeIdx][metricInfo.pos] = match.timestamp;
-    } break;
-    case MetricType::Uint64: {
-      info.uint64Metrics[metricInfo.storeIdx][metricInfo.pos] = match.uint64Value;
-      sizeOfCollection = info.uint64Metrics[metricInfo.storeIdx].size();
-      info.uint64Timestamps[metricInfo.storeIdx][metricInfo.pos] = match.timestamp;
-    } break;
-    case MetricType::Enum: {
-      info.enumMetrics[metricInfo.storeIdx][metricInfo.pos] = match.intValue;
-      sizeOfCollection = info.enumMetrics[metricInfo.storeIdx].size();
-      info.enumTimestamps[metricInfo.storeIdx][metricInfo.pos] = match.timestamp;
-    } break;
-    default:
-      return false;
-      break;
-  };
-  // We do all the updates here, so that not update timestamps for broken metrics
-  // Notice how we always fill floatValue with the float equivalent of the metric
-  // regardless of it's type.
-  info.minDomain[metricIndex] = std::min(info.minDomain[metricIndex], (size_t)match.timestamp);
-  info.maxDomain[metricIndex] = std::max(info.maxDomain[metricIndex], (size_t)match.timestamp);
-  info.max[metricIndex] = std::max(info.max[metricIndex], match.floatValue);
-  info.min[metricIndex] = std::min(info.min[metricIndex], match.floatValue);
-  auto onlineAverage = [](float nextValue, float previousAverage, float previousCount) {
-    return previousAverage + (nextValue - previousAverage) / (previousCount + 1);
-  };
-  info.average[metricIndex] = onlineAverage(match.floatValue, info.average[metricIndex], metricInfo.filledMetrics);
-  // We point to the next metric
-  metricInfo.pos = (metricInfo.pos + 1) % sizeOfCollection;
-  ++metricInfo.filledMetrics;
-  // Note that we updated a given metric.
-  info.changed[metricIndex] = true;
-  return true;
+bool DeviceMetricsHelper::processMetric(ParsedMetricMatch& match,
+                                        DeviceMetricsInfo& info,
+                                        DeviceMetricsHelper::NewMetricCallback newMetricsCallback)
+{
+  return processMetricImpl(match, info, newMetricsCallback) != (size_t)-1;
+}
+
+void DeviceMetricsHelper::beginBinaryMetrics(std::vector<char>& frame)
+{
+  frame.assign(BINARY_METRICS_MARKER.begin(), BINARY_METRICS_MARKER.end());
+}
+
+void DeviceMetricsHelper::declareBinaryMetric(std::vector<char>& frame, uint32_t index, std::string_view const text)
+{
+  BinaryMetricRecord record;
+  record.index = index;
+  record.type = BinaryMetricRecord::DECLARATION;
+  record.timestamp = 0;
+  record.size = text.size();
+  auto pos = frame.size();
+  frame.resize(pos + sizeof(BinaryMetricRecord) + text.size());
+  memcpy(frame.data() + pos, &record, sizeof(BinaryMetricRecord));
+  memcpy(frame.data() + pos + sizeof(BinaryMetricRecord), text.data(), text.size());
+}
+
+bool DeviceMetricsHelper::processBinaryMetrics(std::string_view const frame,
+                                               DeviceMetricsInfo& info,
+                                               DeviceMetricsHelper::NewMetricCallback newMetricsCallback)
+{
+  if (isBinaryMetrics(frame) == false) {
+    return false;
+  }
+  char const* cur = frame.data() + BINARY_METRICS_MARKER.size();
+  char const* end = frame.data() + frame.size();
+  StringMetric noString;
+  noString.data[0] = '\0';
+
+  while (end - cur >= (ptrdiff_t)sizeof(BinaryMetricRecord)) {
+    BinaryMetricRecord record;
+    memcpy(&record, cur, sizeof(BinaryMetricRecord));
+    cur += sizeof(BinaryMetricRecord);
+
+    if (record.type == BinaryMetricRecord::DECLARATION) {
+      if (record.size > (uint64_t)(end - cur)) {
+        return false;
+      }
+      std::string_view text(cur, record.size);
+      cur += record.size;
+      ParsedMetricMatch match;
+      if (parseMetric(text, match) == false) {
+        return false;
+      }
+      auto metricIndex = processMetricImpl(match, info, newMetricsCallback);
+      if (info.binaryMetricsIndex.size() <= record.index) {
+        info.binaryMetricsIndex.resize(record.index + 1, -1);
+      }
+      info.binaryMetricsIndex[record.index] = metricIndex;
+      continue;
+    }
+
+    if (record.index >= info.binaryMetricsIndex.size() || info.binaryMetricsIndex[record.index] == (size_t)-1) {
+      // Update for a metric which was never declared, or whose declaration failed.
+      continue;
+    }
+    // Like for text metrics, we fill all the values with the same number
+    // and let the type of the declared metric decide which one to use.
+    ParsedMetricMatch match;
+    match.timestamp = record.timestamp;
+    switch ((MetricType)record.type) {
+      case MetricType::Int:
+        match.intValue = record.intValue;
+        match.floatValue = record.intValue;
+        match.uint64Value = record.intValue;
+        break;
+      case MetricType::Float:
+        match.intValue = record.floatValue;
+        match.floatValue = record.floatValue;
+        match.uint64Value = record.floatValue;
+        break;
+      case MetricType::Uint64:
+        match.intValue = record.uint64Value;
+        match.floatValue = record.uint64Value;
+        match.uint64Value = record.uint64Value;
+        break;
+      default:
+        return false;
+    }
+    updateMetric(info, info.binaryMetricsIndex[record.index], match, noString);
+  }
+  return cur == end;
 }
 
 size_t DeviceMetricsHelper::metricIdxByName(const std::string& name, const DeviceMetricsInfo& info)
@@ -15,6 +15,8 @@
 #include "arrow/table.h"
 #include "gandiva/tree_expr_builder.h"
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <set>
 #include <stack>
@@ -440,22 +442,65 @@ gandiva::ExpressionPtr makeExpression(gandiva::NodePtr node, gandiva::FieldPtr r
   return gandiva::TreeExprBuilder::MakeExpression(std::move(node), std::move(result));
 }
 
-std::shared_ptr<gandiva::Filter>
-  createFilter(gandiva::SchemaPtr const& Schema, Operations const& opSpecs)
+namespace
 {
-  std::shared_ptr<gandiva::Filter> filter;
-  auto s = gandiva::Filter::Make(Schema,
-                                 makeCondition(createExpressionTree(opSpecs, Schema)),
-                                 &filter);
+/// Counters of the filters and projectors created in this process. The compiled
+/// modules are kept by gandiva in its own process wide LRU cache (its size is set
+/// with GANDIVA_CACHE_SIZE), so that the same expression for the same schema is
+/// compiled only once; the counters tell how often this happened.
+struct CompilationCounters {
+  std::atomic<uint64_t> hits = 0;
+  std::atomic<uint64_t> misses = 0;
+  std::atomic<uint64_t> compilationTime = 0;
+};
+
+CompilationCounters& compilationCounters()
+{
+  static CompilationCounters counters;
+  return counters;
+}
+
+template <typename T>
+void countCompilation(std::shared_ptr<T> const& object, std::chrono::steady_clock::time_point start)
+{
+  auto& counters = compilationCounters();
+  if (object->GetBuiltFromCache()) {
+    ++counters.hits;
+    return;
+  }
+  ++counters.misses;
+  counters.compilationTime += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::shared_ptr<gandiva::Projector> createProjector(gandiva::SchemaPtr const& Schema, gandiva::ExpressionVector const& expressions)
+{
+  auto start = std::chrono::steady_clock::now();
+  std::shared_ptr<gandiva::Projector> projector;
+  auto s = gandiva::Projector::Make(Schema, expressions, &projector);
   if (!s.ok()) {
-    throw runtime_error_f("Failed to create filter: %s", s.ToString().c_str());
+    throw runtime_error_f("Failed to create projector: %s", s.ToString().c_str());
   }
-  return filter;
+  countCompilation(projector, start);
+  return projector;
+}
+} // namespace
+
+CompilationStats getCompilationStats()
+{
+  auto& counters = compilationCounters();
+  return {counters.hits.load(), counters.misses.load(), counters.compilationTime.load()};
+}
+
+std::shared_ptr<gandiva::Filter>
+  createFilter(gandiva::SchemaPtr const& Schema, Operations const& opSpecs)
+{
+  return createFilter(Schema, makeCondition(createExpressionTree(opSpecs, Schema)));
 }
 
 std::shared_ptr<gandiva::Filter>
   createFilter(gandiva::SchemaPtr const& Schema, gandiva::ConditionPtr condition)
 {
+  auto start = std::chrono::steady_clock::now();
   std::shared_ptr<gandiva::Filter> filter;
   auto s = gandiva::Filter::Make(Schema,
                                  std::move(condition),
@@ -463,20 +508,14 @@ std::shared_ptr<gandiva::Filter>
   if (!s.ok()) {
     throw runtime_error_f("Failed to create filter: %s", s.ToString().c_str());
   }
+  countCompilation(filter, start);
   return filter;
 }
 
 std::shared_ptr<gandiva::Projector>
   createProjector(gandiva::SchemaPtr const& Schema, Operations const& opSpecs, gandiva::FieldPtr result)
 {
-  std::shared_ptr<gandiva::Projector> projector;
-  auto s = gandiva::Projector::Make(Schema,
-                                    {makeExpression(createExpressionTree(opSpecs, Schema), std::move(result))},
-                                    &projector);
-  if (!s.ok()) {
-    throw runtime_error_f("Failed to create projector: %s", s.ToString().c_str());
-  }
-  return projector;
+  return createProjector(Schema, gandiva::ExpressionVector{makeExpression(createExpressionTree(opSpecs, Schema), std::move(result))});
 }
 
 std::shared_ptr<gandiva::Projector>
@@ -489,7 +528,7 @@ std::shared_ptr<gandiva::Projector> createProjectorHelper(size_t nColumns, expre
                                                           std::shared_ptr<arrow::Schema> schema,
                                                           std::vector<std::shared_ptr<arrow::Field>> const& fields)
 {
-  std::vector<gandiva::ExpressionPtr> expressions;
+  gandiva::ExpressionVector expressions;
 
   for (size_t ci = 0; ci < nColumns; ++ci) {
     expressions.push_back(
@@ -500,15 +539,7 @@ std::shared_ptr<gandiva::Projector> createProjectorHelper(size_t nColumns, expre
         fields[ci]));
   }
 
-  std::shared_ptr<gandiva::Projector> projector;
-  auto s = gandiva::Projector::Make(
-    schema,
-    expressions,
-    &projector);
-  if (s.ok()) {
-    return projector;
-  }
-  throw o2::framework::runtime_error_f("Failed to create projector: %s", s.ToString().c_str());
+  return createProjector(schema, expressions);
 }
 
 gandiva::Selection createSelection(std::shared_ptr<arrow::Table> const& table, std::shared_ptr<gandiva::Filter> const& gfilter)
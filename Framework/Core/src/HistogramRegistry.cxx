@@ -13,6 +13,7 @@
 #include "TClass.h"
 #include <regex>
 #include <TList.h>
+#include <algorithm>
 
 namespace o2::framework
 {
@@ -405,4 +406,158 @@ void HistogramRegistry::registerName(const std::string& name)
   mRegisteredNames.push_back(name);
 }
 
+namespace
+{
+// the bin indices of a bulk fill are computed block-wise so that the scratch arrays stay in L1
+constexpr int64_t BULK_BLOCK_SIZE{1024};
+
+// bin finding for one axis written as plain loops over contiguous arrays, which the compiler vectorises
+struct BulkAxis {
+  explicit BulkAxis(TAxis const* axis)
+    : nBins(axis->GetNbins()),
+      min(axis->GetXmin()),
+      max(axis->GetXmax()),
+      edges((axis->GetXbins()->fN > 0) ? axis->GetXbins()->GetArray() : nullptr)
+  {
+  }
+
+  // same conventions as TAxis::FindBin for non-extendable axes: 0 is underflow, nBins + 1 is overflow
+  void findBins(double const* x, int* bins, int64_t n) const
+  {
+    if (edges == nullptr) {
+      for (int64_t i = 0; i < n; ++i) {
+        // NaN ends up in the overflow bin as in TAxis::FindBin
+        const bool underflow = x[i] < min;
+        const bool overflow = !underflow && !(x[i] < max);
+        const double pos = (underflow || overflow) ? 0. : nBins * (x[i] - min) / (max - min);
+        bins[i] = underflow ? 0 : (overflow ? nBins + 1 : 1 + static_cast<int>(pos));
+      }
+    } else {
+      for (int64_t i = 0; i < n; ++i) {
+        bins[i] = std::upper_bound(edges, edges + nBins + 1, x[i]) - edges;
+      }
+    }
+  }
+
+  bool isInRange(int bin) const
+  {
+    return bin > 0 && bin <= nBins;
+  }
+
+  const int nBins;
+  const double min;
+  const double max;
+  double const* const edges;
+};
+
+// bulk filling bypasses TH1::Fill, therefore it is only used when Fill would not do anything special
+bool canFillBulk(TH1* hist)
+{
+  if (hist->GetBuffer() != nullptr || hist->GetStatOverflows() == TH1::kConsider) {
+    return false;
+  }
+  for (auto axis : {hist->GetXaxis(), hist->GetYaxis(), hist->GetZaxis()}) {
+    if (axis->CanExtend() || axis->TestBit(TAxis::kAxisRange) || axis->GetLabels() != nullptr) {
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+void HistFiller::fillHistBulk(TH1* hist, int64_t nEntries, std::array<double const*, 3> const& positions, double const* weights)
+{
+  const int nDim = hist->GetDimension();
+  if (!canFillBulk(hist)) {
+    for (int64_t i = 0; i < nEntries; ++i) {
+      const double w = weights ? weights[i] : 1.;
+      if (nDim == 1) {
+        hist->Fill(positions[0][i], w);
+      } else if (nDim == 2) {
+        static_cast<TH2*>(hist)->Fill(positions[0][i], positions[1][i], w);
+      } else {
+        static_cast<TH3*>(hist)->Fill(positions[0][i], positions[1][i], positions[2][i], w);
+      }
+    }
+    return;
+  }
+
+  const std::array<BulkAxis, 3> axes{BulkAxis{hist->GetXaxis()}, BulkAxis{hist->GetYaxis()}, BulkAxis{hist->GetZaxis()}};
+  const int nCells = hist->GetNcells();
+
+  // mimic TH1::Fill which switches on the sum of squared weights as soon as a weight different from one is used
+  if (weights && hist->GetSumw2N() == 0 && !hist->TestBit(TH1::kIsNotW) && std::any_of(weights, weights + nEntries, [](double w) { return w != 1.; })) {
+    hist->Sumw2();
+  }
+  const bool storeSumw2 = hist->GetSumw2N() > 0;
+
+  // per-thread scratch buffers, reused between calls
+  static thread_local std::vector<double> content;
+  static thread_local std::vector<double> sumw2;
+  static thread_local std::array<std::array<int, BULK_BLOCK_SIZE>, 3> bins;
+  content.assign(nCells, 0.);
+  sumw2.assign(storeSumw2 ? nCells : 0, 0.);
+
+  // statistics in the layout of TH1::GetStats, TH2::GetStats and TH3::GetStats
+  std::array<double, TH1::kNstat> stats{};
+  hist->GetStats(stats.data());
+  std::array<double, TH1::kNstat> newStats{};
+
+  for (int64_t blockStart = 0; blockStart < nEntries; blockStart += BULK_BLOCK_SIZE) {
+    const int64_t n = std::min(BULK_BLOCK_SIZE, nEntries - blockStart);
+    for (int d = 0; d < nDim; ++d) {
+      axes[d].findBins(positions[d] + blockStart, bins[d].data(), n);
+    }
+    for (int d = nDim; d < 3; ++d) {
+      std::fill_n(bins[d].data(), n, 0);
+    }
+    for (int64_t i = 0; i < n; ++i) {
+      const int64_t entry = blockStart + i;
+      const double w = weights ? weights[entry] : 1.;
+      const int globalBin = bins[0][i] + (axes[0].nBins + 2) * (bins[1][i] + (axes[1].nBins + 2) * bins[2][i]);
+      content[globalBin] += w;
+      if (storeSumw2) {
+        sumw2[globalBin] += w * w;
+      }
+      // like TH1::Fill, statistics only account for entries inside the axis ranges
+      if (!axes[0].isInRange(bins[0][i]) || (nDim > 1 && !axes[1].isInRange(bins[1][i])) || (nDim > 2 && !axes[2].isInRange(bins[2][i]))) {
+        continue;
+      }
+      const double x = positions[0][entry];
+      newStats[0] += w;
+      newStats[1] += w * w;
+      newStats[2] += w * x;
+      newStats[3] += w * x * x;
+      if (nDim > 1) {
+        const double y = positions[1][entry];
+        newStats[4] += w * y;
+        newStats[5] += w * y * y;
+        newStats[6] += w * x * y;
+        if (nDim > 2) {
+          const double z = positions[2][entry];
+          newStats[7] += w * z;
+          newStats[8] += w * z * z;
+          newStats[9] += w * x * z;
+          newStats[10] += w * y * z;
+        }
+      }
+    }
+  }
+
+  // flush the accumulated bins into the histogram once
+  for (int bin = 0; bin < nCells; ++bin) {
+    if (content[bin] != 0.) {
+      hist->AddBinContent(bin, content[bin]);
+    }
+    if (storeSumw2 && sumw2[bin] != 0.) {
+      hist->GetSumw2()->fArray[bin] += sumw2[bin];
+    }
+  }
+  for (int i = 0; i < TH1::kNstat; ++i) {
+    stats[i] += newStats[i];
+  }
+  hist->PutStats(stats.data());
+  hist->SetEntries(hist->GetEntries() + nEntries);
+}
+
 } // namespace o2::framework
@@ -0,0 +1,39 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#include "Framework/RouteDispatchTable.h"
+
+namespace o2::framework
+{
+
+RouteDispatchTable::RouteDispatchTable(std::vector<std::optional<ConcreteDataMatcher>> const& routes)
+  : mSize{routes.size()}
+{
+  for (size_t ri = 0; ri < routes.size(); ++ri) {
+    if (routes[ri]) {
+      mConcreteRoutes[*routes[ri]].push_back(ri);
+    } else {
+      mGenericRoutes.push_back(ri);
+    }
+  }
+}
+
+size_t RouteDispatchTable::Hash::operator()(ConcreteDataMatcher const& matcher) const
+{
+  // boost::hash_combine of the integer view of the descriptors
+  size_t seed = matcher.origin.itg[0];
+  auto combine = [&seed](uint64_t value) { seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2); };
+  combine(matcher.description.itg[0]);
+  combine(matcher.description.itg[1]);
+  combine(matcher.subSpec);
+  return seed;
+}
+
+} // namespace o2::framework
@@ -0,0 +1,162 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include "Framework/SelectionBitmap.h"
+#include "Framework/RuntimeError.h"
+#include <arrow/memory_pool.h>
+#include <algorithm>
+#include <iterator>
+
+namespace o2::soa
+{
+SelectionBitmap::SelectionBitmap(gsl::span<int64_t const> rows, int64_t nRows)
+  : SelectionBitmap(nRows)
+{
+  for (auto row : rows) {
+    set(row);
+  }
+}
+
+SelectionBitmap::SelectionBitmap(gandiva::Selection const& selection, int64_t nRows)
+  : SelectionBitmap(nRows)
+{
+  if (selection == nullptr) {
+    return;
+  }
+  for (int64_t i = 0; i < selection->GetNumSlots(); ++i) {
+    set(selection->GetIndex(i));
+  }
+}
+
+int64_t SelectionBitmap::count(int64_t start, int64_t end) const
+{
+  if (start >= end) {
+    return 0;
+  }
+  auto first = start / WordBits;
+  auto last = (end - 1) / WordBits;
+  auto firstWord = mWords[first] & (~word_t{0} << (start % WordBits));
+  auto lastMask = end % WordBits == 0 ? ~word_t{0} : ~(~word_t{0} << (end % WordBits));
+  if (first == last) {
+    return __builtin_popcountll(firstWord & lastMask);
+  }
+  int64_t n = __builtin_popcountll(firstWord) + __builtin_popcountll(mWords[last] & lastMask);
+  for (auto i = first + 1; i < last; ++i) {
+    n += __builtin_popcountll(mWords[i]);
+  }
+  return n;
+}
+
+SelectionBitmap& SelectionBitmap::operator|=(SelectionBitmap const& other)
+{
+  if (other.mWords.size() > mWords.size()) {
+    mWords.resize(other.mWords.size(), 0);
+  }
+  mRows = std::max(mRows, other.mRows);
+  auto* words = mWords.data();
+  auto const* otherWords = other.mWords.data();
+  for (size_t i = 0; i < other.mWords.size(); ++i) {
+    words[i] |= otherWords[i];
+  }
+  return *this;
+}
+
+SelectionBitmap& SelectionBitmap::operator&=(SelectionBitmap const& other)
+{
+  if (other.mWords.size() < mWords.size()) {
+    mWords.resize(other.mWords.size());
+  }
+  mRows = std::min(mRows, other.mRows);
+  auto* words = mWords.data();
+  auto const* otherWords = other.mWords.data();
+  for (size_t i = 0; i < mWords.size(); ++i) {
+    words[i] &= otherWords[i];
+  }
+  return *this;
+}
+
+SelectionVector SelectionBitmap::View::toVector() const
+{
+  SelectionVector rows(count());
+  auto* out = rows.data();
+  auto offset = mStart;
+  forEach([&out, offset](int64_t row) { *out++ = row - offset; });
+  return rows;
+}
+
+gandiva::Selection SelectionBitmap::toSelection() const
+{
+  gandiva::Selection selection;
+  auto s = gandiva::SelectionVector::MakeInt64(std::max(mRows, int64_t{1}), arrow::default_memory_pool(), &selection);
+  if (!s.ok()) {
+    throw framework::runtime_error_f("Cannot allocate selection vector %s", s.ToString().c_str());
+  }
+  int64_t n = 0;
+  forEach(0, mRows, [&](int64_t row) { selection->SetIndex(n++, row); });
+  selection->SetNumSlots(n);
+  return selection;
+}
+
+namespace
+{
+/// the bitmap costs one word per 64 rows, the merge of sorted vectors (with a
+/// mispredicted branch for most rows) one step per selected row
+bool useBitmap(int64_t nRows, size_t nSelected)
+{
+  return nRows / SelectionBitmap::WordBits < static_cast<int64_t>(nSelected);
+}
+} // namespace
+
+SelectionVector selectionUnion(gsl::span<int64_t const> a, gsl::span<int64_t const> b)
+{
+  if (a.empty() || b.empty()) {
+    return a.empty() ? SelectionVector{b.begin(), b.end()} : SelectionVector{a.begin(), a.end()};
+  }
+  auto nRows = std::max(a.back(), b.back()) + 1;
+  if (useBitmap(nRows, a.size() + b.size())) {
+    SelectionBitmap bitmap{a, nRows};
+    for (auto row : b) {
+      bitmap.set(row);
+    }
+    return bitmap.toVector();
+  }
+  SelectionVector rowsUnion;
+  rowsUnion.reserve(a.size() + b.size());
+  std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(rowsUnion));
+  return rowsUnion;
+}
+
+SelectionVector selectionIntersection(gsl::span<int64_t const> a, gsl::span<int64_t const> b)
+{
+  if (a.empty() || b.empty()) {
+    return {};
+  }
+  auto nRows = a.back() + 1;
+  if (useBitmap(nRows, a.size() + b.size())) {
+    SelectionBitmap bitmap{a, nRows};
+    SelectionVector intersection(std::min(a.size(), b.size()));
+    size_t n = 0;
+    for (auto row : b) {
+      if (row >= nRows) {
+        break;
+      }
+      intersection[n] = row;
+      n += bitmap.test(row);
+    }
+    intersection.resize(n);
+    return intersection;
+  }
+  SelectionVector intersection;
+  intersection.reserve(std::min(a.size(), b.size()));
+  std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(intersection));
+  return intersection;
+}
+} // namespace o2::soa
@@ -15,7 +15,13 @@
 #include "arrow/type_traits.h"
 #include <arrow/util/key_value_metadata.h>
 #include <TBufferFile.h>
+#include <TMemFile.h>
+#include <TROOT.h>
 
+#include <atomic>
+#include <exception>
+#include <numeric>
+#include <thread>
 #include <utility>
 namespace TableTreeHelpers
 {
@@ -471,6 +477,151 @@ std::shared_ptr<TTree> TableToTree::process()
   return mTree;
 }
 
+namespace
+{
+/// Size of the buffers of an array, including the ones of its children
+int64_t arrayDataBytes(arrow::ArrayData const& data)
+{
+  int64_t bytes = 0;
+  for (auto const& buffer : data.buffers) {
+    if (buffer) {
+      bytes += buffer->size();
+    }
+  }
+  for (auto const& child : data.child_data) {
+    bytes += arrayDataBytes(*child);
+  }
+  return bytes;
+}
+
+/// Folder and name of a tree given as folder/name
+std::pair<std::string, std::string> splitTreeName(std::string const& treename)
+{
+  auto pos = treename.find_first_of('/');
+  if (pos == std::string::npos) {
+    return {"", treename};
+  }
+  return {treename.substr(0, pos), treename.substr(pos + 1, std::string::npos)};
+}
+} // namespace
+
+ParallelTableToTree::ParallelTableToTree(int nThreads, int64_t maxBytesInFlight)
+  : mNThreads{std::max(nThreads, 1)},
+    mMaxBytesInFlight{maxBytesInFlight}
+{
+  if (mNThreads > 1) {
+    // trees and in-memory files are created by several threads
+    ROOT::EnableThreadSafety();
+  }
+}
+
+void ParallelTableToTree::addTable(std::shared_ptr<arrow::Table> const& table, TFile* file, std::string treename, std::vector<std::string> const& columns)
+{
+  Job job{.table = table, .file = file, .treename = std::move(treename)};
+  if (columns.empty()) {
+    job.columns.resize(table->num_columns());
+    std::iota(job.columns.begin(), job.columns.end(), 0);
+  } else {
+    for (auto const& name : columns) {
+      auto idx = table->schema()->GetFieldIndex(name);
+      if (idx != -1) {
+        job.columns.push_back(idx);
+      } else {
+        LOGP(warn, "Column {} is not in the table and will not be saved to {}", name, job.treename);
+      }
+    }
+  }
+  for (auto idx : job.columns) {
+    for (auto const& chunk : table->column(idx)->chunks()) {
+      job.bytes += arrayDataBytes(*chunk->data());
+    }
+  }
+  mJobs.push_back(std::move(job));
+}
+
+void ParallelTableToTree::convert(Job& job)
+{
+  // the baskets are compressed with the settings of the destination file
+  auto treeName = splitTreeName(job.treename).second;
+  job.buffer = std::make_unique<TMemFile>(treeName.c_str(), "RECREATE", "", job.file->GetCompressionSettings());
+  job.buffer->cd();
+  TableToTree converter(job.table, job.buffer.get(), treeName.c_str());
+  for (auto idx : job.columns) {
+    converter.addBranch(job.table->column(idx), job.table->schema()->field(idx));
+  }
+  converter.process();
+}
+
+void ParallelTableToTree::write(Job& job)
+{
+  auto [folder, treeName] = splitTreeName(job.treename);
+  std::unique_ptr<TTree> target{static_cast<TTree*>(job.file->Get(job.treename.c_str()))};
+  std::unique_ptr<TTree> source{static_cast<TTree*>(job.buffer->Get(treeName.c_str()))};
+  // the compressed baskets are copied as they are
+  if (target) {
+    target->CopyEntries(source.get(), -1, "fast");
+  } else {
+    if (folder.empty()) {
+      job.file->cd();
+    } else {
+      job.file->cd(folder.c_str());
+    }
+    target.reset(source->CloneTree(-1, "fast"));
+  }
+  target->Write("", TObject::kOverwrite);
+  target->SetDirectory(nullptr);
+  source.reset();
+  job.buffer.reset();
+  job.table.reset();
+}
+
+void ParallelTableToTree::process()
+{
+  size_t first = 0;
+  while (first < mJobs.size()) {
+    // the next tables up to mMaxBytesInFlight bytes, at least one
+    size_t last = first + 1;
+    auto bytes = mJobs[first].bytes;
+    while (last < mJobs.size() && bytes + mJobs[last].bytes <= mMaxBytesInFlight) {
+      bytes += mJobs[last++].bytes;
+    }
+
+    std::atomic<size_t> next{first};
+    std::exception_ptr error = nullptr;
+    std::atomic_flag failed = ATOMIC_FLAG_INIT;
+    auto worker = [&]() {
+      for (auto i = next++; i < last; i = next++) {
+        try {
+          convert(mJobs[i]);
+        } catch (...) {
+          if (!failed.test_and_set()) {
+            error = std::current_exception();
+          }
+        }
+      }
+    };
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < std::min<size_t>(mNThreads, last - first); ++i) {
+      threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    if (error) {
+      mJobs.clear();
+      std::rethrow_exception(error);
+    }
+
+    // written in the order the tables were added
+    for (auto i = first; i < last; ++i) {
+      write(mJobs[i]);
+    }
+    first = last;
+  }
+  mJobs.clear();
+}
+
 TreeToTable::TreeToTable(arrow::MemoryPool* pool)
   : mArrowMemoryPool{pool}
 {
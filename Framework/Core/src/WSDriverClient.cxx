@@ -13,7 +13,7 @@
 #include "Framework/DeviceSpec.h"
 #include "Framework/Logger.h"
 #include "Framework/ServiceRegistry.h"
-#include "Framework/DeviceSpec.h"
+#include "Framework/Signpost.h"
 #include "DriverClientContext.h"
 #include "DPLWebSocket.h"
 #include <uv.h>
@@ -152,6 +152,61 @@ void on_connect(uv_connect_t* connection, int status)
     state.tracingFlags = tracingFlags;
   });
 
+  client->observe("/signpost-trace", [](std::string_view cmd) {
+    static constexpr int prefixSize = std::string_view{"/signpost-trace "}.size();
+    if (prefixSize > cmd.size()) {
+      LOG(error) << "Malformed signpost tracing request";
+      return;
+    }
+    cmd.remove_prefix(prefixSize);
+    // Format is "<log> <0|1>"
+    auto separator = cmd.find(' ');
+    if (separator == std::string_view::npos || separator + 2 != cmd.size() || (cmd.back() != '0' && cmd.back() != '1')) {
+      LOG(error) << "Malformed signpost tracing request";
+      return;
+    }
+    std::string logName{cmd.substr(0, separator)};
+    bool enable = cmd.back() == '1';
+#ifdef O2_SIGNPOST_HAS_TRACING
+    if (o2_log_set_tracing(logName.c_str(), enable) == false) {
+      LOGP(error, "No signpost log named {}", logName);
+      return;
+    }
+    LOGP(info, "Signpost tracing for {} {}", logName, enable ? "enabled" : "disabled");
+#else
+    LOGP(warning, "Signpost tracing not supported by this build, ignoring request for {}", logName);
+#endif
+  });
+
+  client->observe("/signpost-dump", [ref = context->ref](std::string_view cmd) {
+    static constexpr int prefixSize = std::string_view{"/signpost-dump "}.size();
+    if (prefixSize > cmd.size()) {
+      LOG(error) << "Malformed signpost dump request";
+      return;
+    }
+    cmd.remove_prefix(prefixSize);
+    // Time window in seconds, 0 means everything which is still in the buffers.
+    int window = 0;
+    auto error = std::from_chars(cmd.data(), cmd.data() + cmd.size(), window);
+    if (error.ec != std::errc() || window < 0) {
+      LOG(error) << "Malformed signpost dump window";
+      return;
+    }
+#ifdef O2_SIGNPOST_HAS_TRACING
+    auto fileName = fmt::format("dpl-signposts-{}.json", ref.get<DeviceSpec const>().id);
+    FILE* out = fopen(fileName.c_str(), "w");
+    if (out == nullptr) {
+      LOGP(error, "Unable to open {} to dump the signposts", fileName);
+      return;
+    }
+    auto count = o2_signpost_trace_dump(out, window * 1000000ULL);
+    fclose(out);
+    LOGP(info, "{} signposts written to {}", count, fileName);
+#else
+    LOG(warning) << "Signpost tracing not supported by this build";
+#endif
+  });
+
   // Client will be filled in the line after. I can probably have a single
   // client per device.
   auto dplClient = std::make_unique<WSDPLClient>();
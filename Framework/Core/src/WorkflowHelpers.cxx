@@ -1062,6 +1062,7 @@ std::shared_ptr<DataOutputDirector> WorkflowHelpers::getDataOutputDirector(Confi
   float mfs, maxfilesize(-1.);
   std::string fmo, filemode("RECREATE");
   int ntfm, ntfmerge = 1;
+  int nthreads = 1;
 
   // values from json
   if (options.isSet("aod-writer-json")) {
@@ -1117,6 +1118,9 @@ std::shared_ptr<DataOutputDirector> WorkflowHelpers::getDataOutputDirector(Confi
       ntfmerge = ntfm;
     }
   }
+  if (options.isSet("aod-writer-nthreads")) {
+    nthreads = options.get<int>("aod-writer-nthreads");
+  }
   // parse the keepString
   auto isAOD = [](InputSpec const& spec) { return DataSpecUtils::partialMatch(spec, header::DataOrigin("AOD")); };
   if (options.isSet("aod-writer-keep")) {
@@ -1148,6 +1152,7 @@ std::shared_ptr<DataOutputDirector> WorkflowHelpers::getDataOutputDirector(Confi
   dod->setFileMode(filemode);
   dod->setMaximumFileSize(maxfilesize);
   dod->setNumberTimeFramesToMerge(ntfmerge);
+  dod->setNumberOfWriterThreads(nthreads);
 
   return dod;
 }
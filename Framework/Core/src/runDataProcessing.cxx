@@ -1920,6 +1920,7 @@ int runStateMachine(DataProcessorSpecs const& workflow,
             "--aod-memory-rate-limit",
             "--aod-writer-json",
             "--aod-writer-ntfmerge",
+            "--aod-writer-nthreads",
             "--aod-writer-resdir",
             "--aod-writer-resfile",
             "--aod-writer-resmode",
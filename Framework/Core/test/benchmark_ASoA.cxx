@@ -32,6 +32,18 @@ DECLARE_SOA_DYNAMIC_COLUMN(Sum, sum, [](float x, float y) { return x + y; });
 
 DECLARE_SOA_TABLE(TestTable, "AOD", "TESTTBL", test::X, test::Y, test::Z, test::Sum<test::X, test::Y>);
 
+namespace o2::aod
+{
+DECLARE_SOA_TABLE(BenchColls, "TST", "BCOLLS", o2::soa::Index<>);
+namespace bench
+{
+DECLARE_SOA_INDEX_COLUMN(BenchColl, benchColl);
+DECLARE_SOA_COLUMN(Value, value, float);
+DECLARE_SOA_COLUMN(Other, other, float);
+} // namespace bench
+DECLARE_SOA_TABLE(BenchTracks, "TST", "BTRACKS", o2::soa::Index<>, bench::BenchCollId, bench::Value, bench::Other);
+} // namespace o2::aod
+
 #ifdef __APPLE__
 constexpr unsigned int maxrange = 10;
 #else
@@ -315,4 +327,85 @@ static void BM_ASoADynamicColumnCall(benchmark::State& state)
 }
 BENCHMARK(BM_ASoADynamicColumnCall)->Range(8, 8 << maxrange);
 
+namespace
+{
+constexpr int tracksPerCollision = 20;
+
+/// rows grouped by collision, with two uniform values in [0, 1)
+std::shared_ptr<arrow::Table> makeTracks(int64_t nRows)
+{
+  std::default_random_engine e1(1234567891);
+  std::uniform_real_distribution<float> uniform_dist(0, 1);
+  TableBuilder builder;
+  auto writer = builder.cursor<o2::aod::BenchTracks>();
+  for (auto i = 0; i < nRows; ++i) {
+    writer(0, i / tracksPerCollision, uniform_dist(e1), uniform_dist(e1));
+  }
+  return builder.finalize();
+}
+} // namespace
+
+static void BM_ASoAFilteredForLoop(benchmark::State& state)
+{
+  auto table = makeTracks(state.range(0));
+  expressions::Filter filter = o2::aod::bench::value > 0.5f;
+  o2::soa::Filtered<o2::aod::BenchTracks> tracks{{table}, expressions::createSelection(table, filter)};
+
+  for (auto _ : state) {
+    float sum = 0;
+    for (auto& track : tracks) {
+      sum += track.other();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(state.iterations() * tracks.size() * sizeof(float));
+}
+
+BENCHMARK(BM_ASoAFilteredForLoop)->Range(8, 8 << maxrange);
+
+static void BM_ASoAFilteredIntersection(benchmark::State& state)
+{
+  auto table = makeTracks(state.range(0));
+  expressions::Filter filter1 = o2::aod::bench::value > 0.5f;
+  expressions::Filter filter2 = o2::aod::bench::other < 0.8f;
+  using Tracks = o2::soa::Filtered<o2::aod::BenchTracks>;
+  Tracks tracks1{{table}, expressions::createSelection(table, filter1)};
+  Tracks tracks2{{table}, expressions::createSelection(table, filter2)};
+
+  for (auto _ : state) {
+    auto both = tracks1 * tracks2;
+    auto any = tracks1 + tracks2;
+    benchmark::DoNotOptimize(both.size() + any.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_ASoAFilteredIntersection)->Range(8, 8 << maxrange);
+
+static void BM_ASoAFilteredGrouping(benchmark::State& state)
+{
+  auto table = makeTracks(state.range(0));
+  expressions::Filter filter = o2::aod::bench::value > 0.5f;
+  o2::soa::Filtered<o2::aod::BenchTracks> tracks{{table}, expressions::createSelection(table, filter)};
+
+  ArrowTableSlicingCache atscache({{o2::soa::getLabelFromType<o2::aod::BenchTracks>(), "fIndex" + o2::framework::cutString(o2::soa::getLabelFromType<o2::aod::BenchColls>())}});
+  auto status = atscache.updateCacheEntry(0, table);
+  SliceCache cache{&atscache};
+  const int nCollisions = (state.range(0) + tracksPerCollision - 1) / tracksPerCollision;
+
+  for (auto _ : state) {
+    float sum = 0;
+    for (auto collision = 0; collision < nCollisions; ++collision) {
+      auto group = tracks.sliceByCached(o2::aod::bench::benchCollId, collision, cache);
+      for (auto& track : group) {
+        sum += track.other();
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * nCollisions);
+}
+
+BENCHMARK(BM_ASoAFilteredGrouping)->Range(8, 8 << maxrange);
+
 BENCHMARK_MAIN();
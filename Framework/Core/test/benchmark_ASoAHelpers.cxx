@@ -12,7 +12,11 @@
 #include "Framework/ASoAHelpers.h"
 #include "Framework/TableBuilder.h"
 #include "Framework/AnalysisDataModel.h"
+#include "Framework/ArrowTableSlicingCache.h"
+#include "Framework/GroupSlicer.h"
 #include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <new>
 #include <random>
 #include <vector>
 
@@ -30,6 +34,38 @@ DECLARE_SOA_COLUMN_FULL(Z, z, float, "z");
 DECLARE_SOA_DYNAMIC_COLUMN(Sum, sum, [](float x, float y) { return x + y; });
 } // namespace test
 
+namespace o2::aod
+{
+DECLARE_SOA_TABLE(BenchEvents, "AOD", "BENCHEVTS", o2::soa::Index<>, ::test::X);
+namespace bench
+{
+DECLARE_SOA_INDEX_COLUMN(BenchEvent, benchEvent);
+} // namespace bench
+DECLARE_SOA_TABLE(BenchTrks, "AOD", "BENCHTRKS", bench::BenchEventId, ::test::X);
+} // namespace o2::aod
+
+// count the heap allocations, to check what the grouping costs per group
+static std::size_t nAllocations = 0;
+
+void* operator new(std::size_t size)
+{
+  ++nAllocations;
+  if (auto* p = std::malloc(size == 0 ? 1 : size)) {
+    return p;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
 #ifdef __APPLE__
 constexpr unsigned int maxPairsRange = 10;
 constexpr unsigned int maxFivesRange = 3;
@@ -866,4 +902,55 @@ static void BM_ASoAHelpersCombGenCollisionsFivesCategories(benchmark::State& sta
 
 BENCHMARK(BM_ASoAHelpersCombGenCollisionsFivesCategories)->RangeMultiplier(2)->Range(8, 8 << (maxFivesRange + 1));
 
+static void BM_ASoAHelpersGroupedFilteredTracks(benchmark::State& state)
+{
+  // one DF with state.range(0) events of 20 tracks, about half of which are selected
+  constexpr int nTracksPerEvent = 20;
+  std::default_random_engine e1(1234567891);
+  std::uniform_real_distribution<float> uniform_dist(0, 1);
+
+  TableBuilder builderE;
+  auto eventWriter = builderE.cursor<o2::aod::BenchEvents>();
+  TableBuilder builderT;
+  auto trackWriter = builderT.cursor<o2::aod::BenchTrks>();
+  SelectionVector selection;
+  for (auto i = 0; i < state.range(0); ++i) {
+    eventWriter(0, uniform_dist(e1));
+    for (auto j = 0; j < nTracksPerEvent; ++j) {
+      auto x = uniform_dist(e1);
+      if (x < 0.5f) {
+        selection.push_back(i * nTracksPerEvent + j);
+      }
+      trackWriter(0, i, x);
+    }
+  }
+  auto eventTable = builderE.finalize();
+  auto trackTable = builderT.finalize();
+
+  o2::aod::BenchEvents events{eventTable};
+  Filtered<o2::aod::BenchTrks> tracks{{trackTable}, std::move(selection)};
+  auto associated = std::make_tuple(tracks);
+  ArrowTableSlicingCache slices({{getLabelFromType<o2::aod::BenchTrks>(), "fIndex" + cutString(getLabelFromType<o2::aod::BenchEvents>())}});
+  auto status = slices.updateCacheEntry(0, trackTable);
+
+  float sum = 0;
+  auto allocationsStart = nAllocations;
+  for (auto _ : state) {
+    GroupSlicer slicer(events, associated, slices);
+    for (auto& group : slicer) {
+      auto groupTracks = std::get<Filtered<o2::aod::BenchTrks>>(group.associatedTables());
+      for (auto& track : groupTracks) {
+        sum += track.x();
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  auto allocations = static_cast<double>(nAllocations - allocationsStart);
+  state.counters["Groups"] = state.range(0);
+  state.counters["Allocations/DF"] = benchmark::Counter(allocations, benchmark::Counter::kAvgIterations);
+  state.counters["Allocations/group"] = benchmark::Counter(allocations / state.range(0), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(BM_ASoAHelpersGroupedFilteredTracks)->Range(8, 8 << 10)->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_MAIN();
@@ -10,9 +10,16 @@
 // or submit itself to any jurisdiction.
 #include <benchmark/benchmark.h>
 #include "Headers/DataHeader.h"
+#include "Headers/Stack.h"
 #include "Framework/DataDescriptorMatcher.h"
+#include "Framework/DataProcessingHeader.h"
+#include "Framework/DataSpecUtils.h"
+#include "Framework/RouteDispatchTable.h"
+#include <optional>
+#include <vector>
 
 using namespace o2::header;
+using namespace o2::framework;
 using namespace o2::framework::data_matcher;
 
 static void BM_MatchedSingleQuery(benchmark::State& state)
@@ -179,4 +186,74 @@ static void BM_OneVariableMatchUnmatch(benchmark::State& state)
 // Register the function as a benchmark
 BENCHMARK(BM_OneVariableMatchUnmatch);
 
+// One route per link, as for a raw proxy, and a header for the last one
+static std::vector<DataDescriptorMatcher> createLinkMatchers(int nRoutes)
+{
+  std::vector<DataDescriptorMatcher> matchers;
+  for (int i = 0; i < nRoutes; ++i) {
+    matchers.push_back(DataSpecUtils::dataDescriptorMatcherFrom(ConcreteDataMatcher{"TPC", "RAWDATA", static_cast<DataHeader::SubSpecificationType>(i)}));
+  }
+  return matchers;
+}
+
+static void BM_ManyRoutesLinearScan(benchmark::State& state)
+{
+  auto matchers = createLinkMatchers(state.range(0));
+  DataHeader header;
+  header.dataOrigin = "TPC";
+  header.dataDescription = "RAWDATA";
+  header.subSpecification = state.range(0) - 1;
+  Stack stack{header, DataProcessingHeader{0, 1}};
+  auto data = reinterpret_cast<char const*>(stack.data());
+
+  VariableContext context;
+
+  for (auto _ : state) {
+    size_t ri = 0;
+    for (; ri < matchers.size(); ++ri) {
+      if (matchers[ri].match(data, context)) {
+        context.commit();
+        break;
+      }
+      context.discard();
+    }
+    benchmark::DoNotOptimize(ri);
+  }
+}
+
+BENCHMARK(BM_ManyRoutesLinearScan)->Range(8, 1024);
+
+static void BM_ManyRoutesDispatchTable(benchmark::State& state)
+{
+  auto matchers = createLinkMatchers(state.range(0));
+  std::vector<std::optional<ConcreteDataMatcher>> concrete;
+  for (auto& matcher : matchers) {
+    concrete.push_back(DataSpecUtils::optionalConcreteDataMatcherFrom(matcher));
+  }
+  RouteDispatchTable dispatch{concrete};
+  DataHeader header;
+  header.dataOrigin = "TPC";
+  header.dataDescription = "RAWDATA";
+  header.subSpecification = state.range(0) - 1;
+  Stack stack{header, DataProcessingHeader{0, 1}};
+  auto data = reinterpret_cast<char const*>(stack.data());
+
+  VariableContext context;
+
+  for (auto _ : state) {
+    auto const* dh = get<DataHeader*>(data);
+    auto ri = dispatch.find(dh->dataOrigin, dh->dataDescription, dh->subSpecification, [&](int index) {
+      if (matchers[index].match(data, context)) {
+        context.commit();
+        return true;
+      }
+      context.discard();
+      return false;
+    });
+    benchmark::DoNotOptimize(ri);
+  }
+}
+
+BENCHMARK(BM_ManyRoutesDispatchTable)->Range(8, 1024);
+
 BENCHMARK_MAIN();
@@ -18,6 +18,7 @@
 #include <Monitoring/Monitoring.h>
 #include <fairmq/TransportFactory.h>
 #include <cstring>
+#include <string>
 #include <vector>
 
 using Monitoring = o2::monitoring::Monitoring;
@@ -348,4 +349,54 @@ static void BM_RelayMultiplePayloads(benchmark::State& state)
 
 BENCHMARK(BM_RelayMultiplePayloads)->Arg(10)->Arg(100)->Arg(1000);
 
+// One input per link, as for a raw proxy with one subspec per link. The
+// message is for the last one, so that all the routes would be checked
+// by a linear scan.
+static void BM_RelayManyRoutes(benchmark::State& state)
+{
+  Monitoring metrics;
+  const int nRoutes = state.range(0);
+  std::vector<InputRoute> inputs;
+  for (int i = 0; i < nRoutes; ++i) {
+    InputSpec spec{"link" + std::to_string(i), "TPC", "RAWDATA", static_cast<DataHeader::SubSpecificationType>(i)};
+    inputs.push_back(InputRoute{spec, static_cast<size_t>(i), "Fake", 0});
+  }
+
+  std::vector<ForwardRoute> forwards;
+  std::vector<InputChannelInfo> infos{1};
+  TimesliceIndex index{1, infos};
+
+  auto policy = CompletionPolicyHelpers::consumeWhenAny();
+  ServiceRegistry registry;
+  DataRelayer relayer(policy, inputs, index, {registry});
+  relayer.setPipelineLength(4);
+
+  DataHeader dh;
+  dh.dataDescription = "RAWDATA";
+  dh.dataOrigin = "TPC";
+  dh.subSpecification = nRoutes - 1;
+
+  DataProcessingHeader dph{0, 1};
+  Stack stack{dh, dph};
+  auto transport = fair::mq::TransportFactory::CreateTransportFactory("zeromq");
+  std::vector<fair::mq::MessagePtr> inflightMessages;
+  inflightMessages.emplace_back(transport->CreateMessage(stack.size()));
+  inflightMessages.emplace_back(transport->CreateMessage(1000));
+  memcpy(inflightMessages[0]->GetData(), stack.data(), stack.size());
+
+  for (auto _ : state) {
+    relayer.relay(inflightMessages[0]->GetData(), inflightMessages.data(), inflightMessages.size());
+    std::vector<RecordAction> ready;
+    relayer.getReadyToProcess(ready);
+    assert(ready.size() == 1);
+    assert(ready[0].op == CompletionPolicy::CompletionOp::Consume);
+    auto result = relayer.consumeAllInputsForTimeslice(ready[0].slot);
+    assert(result.size() == nRoutes);
+    assert(result.at(nRoutes - 1).size() == 1);
+    inflightMessages = std::move(result[nRoutes - 1].messages);
+  }
+}
+
+BENCHMARK(BM_RelayManyRoutes)->Range(8, 1024);
+
 BENCHMARK_MAIN();
@@ -164,4 +164,61 @@ static void BM_ProcessMismatchedMetric(benchmark::State& state)
 
 BENCHMARK(BM_ProcessMismatchedMetric);
 
+// Simulates the driver receiving one update for each of state.range(1) metrics
+// from each of state.range(0) devices, in text form.
+static void BM_DriverTextMetrics(benchmark::State& state)
+{
+  using namespace o2::framework;
+  ParsedMetricMatch match;
+  std::vector<DeviceMetricsInfo> infos(state.range(0));
+  std::vector<std::string> metrics;
+  for (int i = 0; i < state.range(1); ++i) {
+    metrics.push_back("[METRIC] some_metric_" + std::to_string(i) + ",0 " + std::to_string(i) + " 1789372894 hostname=test.cern.ch");
+  }
+  for (auto& info : infos) {
+    for (auto& metric : metrics) {
+      DeviceMetricsHelper::parseMetric(metric, match);
+      DeviceMetricsHelper::processMetric(match, info);
+    }
+  }
+  for (auto _ : state) {
+    for (auto& info : infos) {
+      for (auto& metric : metrics) {
+        DeviceMetricsHelper::parseMetric(metric, match);
+        DeviceMetricsHelper::processMetric(match, info);
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * infos.size() * metrics.size());
+}
+
+BENCHMARK(BM_DriverTextMetrics)->Args({10, 10})->Args({10, 100})->Args({100, 10})->Args({100, 100})->Args({500, 100});
+
+// Same as above, with the updates of each device sent as one frame of binary metrics.
+static void BM_DriverBinaryMetrics(benchmark::State& state)
+{
+  using namespace o2::framework;
+  std::vector<DeviceMetricsInfo> infos(state.range(0));
+  std::vector<char> declarations;
+  std::vector<char> updates;
+  DeviceMetricsHelper::beginBinaryMetrics(declarations);
+  DeviceMetricsHelper::beginBinaryMetrics(updates);
+  for (int i = 0; i < state.range(1); ++i) {
+    auto metric = "[METRIC] some_metric_" + std::to_string(i) + ",0 " + std::to_string(i) + " 1789372894 hostname=test.cern.ch";
+    DeviceMetricsHelper::declareBinaryMetric(declarations, i, metric);
+    DeviceMetricsHelper::addBinaryMetric<int>(updates, i, i, 1789372894);
+  }
+  for (auto& info : infos) {
+    DeviceMetricsHelper::processBinaryMetrics({declarations.data(), declarations.size()}, info);
+  }
+  for (auto _ : state) {
+    for (auto& info : infos) {
+      DeviceMetricsHelper::processBinaryMetrics({updates.data(), updates.size()}, info);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * infos.size() * state.range(1));
+}
+
+BENCHMARK(BM_DriverBinaryMetrics)->Args({10, 10})->Args({10, 100})->Args({100, 10})->Args({100, 100})->Args({500, 100});
+
 BENCHMARK_MAIN();
@@ -0,0 +1,85 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include "Framework/Expressions.h"
+#include "Framework/AnalysisDataModel.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace o2::framework;
+using namespace o2::framework::expressions;
+
+// Time to get the filters and projectors of an analysis task: compiled for a new
+// expression, as at the startup of a task, and taken from the gandiva cache, as for
+// the following timeframes and for the other tasks using the same expression.
+
+namespace
+{
+gandiva::SchemaPtr trackSchema()
+{
+  return std::make_shared<arrow::Schema>(std::vector{o2::aod::track::Signed1Pt::asArrowField(), o2::aod::track::Tgl::asArrowField(),
+                                                     o2::aod::track::Pt::asArrowField(), o2::aod::track::Eta::asArrowField()});
+}
+
+Filter trackSelection(float ptMin)
+{
+  return (o2::aod::track::pt > ptMin) && (nabs(o2::aod::track::eta) < 0.8f) && (o2::aod::track::tgl < 2.f);
+}
+} // namespace
+
+static void BM_CompileFilter(benchmark::State& state)
+{
+  auto schema = trackSchema();
+  // a different cut every time, so that the filter has to be compiled
+  float ptMin = 0.f;
+  for (auto _ : state) {
+    ptMin += 1e-3f;
+    benchmark::DoNotOptimize(createFilter(schema, createOperations(trackSelection(ptMin))));
+  }
+}
+
+static void BM_ReuseFilter(benchmark::State& state)
+{
+  auto schema = trackSchema();
+  createFilter(schema, createOperations(trackSelection(0.15f)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(createFilter(schema, createOperations(trackSelection(0.15f))));
+  }
+}
+
+static void BM_CompileProjector(benchmark::State& state)
+{
+  auto schema = trackSchema();
+  auto result = arrow::field("fPz", arrow::float32());
+  float scale = 1.f;
+  for (auto _ : state) {
+    scale += 1e-3f;
+    Projector pz = o2::aod::track::tgl * (scale / o2::aod::track::signed1Pt);
+    benchmark::DoNotOptimize(createProjector(schema, std::move(pz), result));
+  }
+}
+
+static void BM_ReuseProjector(benchmark::State& state)
+{
+  auto schema = trackSchema();
+  std::vector<std::shared_ptr<arrow::Field>> fields{o2::aod::track::Pt::asArrowField()};
+  // as done by the spawners for every timeframe
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(createProjectors(o2::framework::pack<o2::aod::track::Pt>{}, fields, schema));
+  }
+}
+
+BENCHMARK(BM_CompileFilter)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ReuseFilter)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CompileProjector)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ReuseProjector)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -16,14 +16,36 @@
 
 #include <benchmark/benchmark.h>
 #include <boost/format.hpp>
+#include <random>
 
 using namespace o2::framework;
 using namespace arrow;
 using namespace o2::soa;
 
+namespace test
+{
+DECLARE_SOA_COLUMN_FULL(X, x, float, "x");
+DECLARE_SOA_COLUMN_FULL(Y, y, float, "y");
+} // namespace test
+
+using TestTable = o2::soa::Table<o2::soa::Index<>, test::X, test::Y>;
+
 /// Number of lookups to perform
 const int nLookups = 100000;
 
+/// Create a table of normally distributed (x, y) pairs
+static std::shared_ptr<arrow::Table> createFillTable(int64_t nRows)
+{
+  std::default_random_engine e1(1234567891);
+  std::normal_distribution<float> gauss(0.f, 1.f);
+  TableBuilder builder;
+  auto rowWriter = builder.persist<float, float>({"x", "y"});
+  for (auto i = 0; i < nRows; ++i) {
+    rowWriter(0, gauss(e1), gauss(e1));
+  }
+  return builder.finalize();
+}
+
 /// Lookup a histogram by name literal in a HistogramRegistry
 static void BM_HashedNameLookup(benchmark::State& state)
 {
@@ -62,7 +84,33 @@ static void BM_StandardNameLookup(benchmark::State& state)
     }
   }
 }
+/// Fill a 1D and a 2D histogram from table columns row by row
+static void BM_FillFromTableRowByRow(benchmark::State& state)
+{
+  TestTable table{createFillTable(state.range(0))};
+  HistogramRegistry registry{"registry", {{"x", "x", {HistType::kTH1F, {{200, -5, 5}}}}, {"xy", "xy", {HistType::kTH2F, {{200, -5, 5}, {200, -5, 5}}}}}};
+  for (auto _ : state) {
+    registry.fill<test::X>(HIST("x"), table, test::x > -1.f);
+    registry.fill<test::X, test::Y>(HIST("xy"), table, test::x > -1.f);
+  }
+  state.counters["Rows/s"] = benchmark::Counter(state.iterations() * state.range(0), benchmark::Counter::kIsRate);
+}
+
+/// Fill a 1D and a 2D histogram from table columns in bulk
+static void BM_FillFromTableBulk(benchmark::State& state)
+{
+  TestTable table{createFillTable(state.range(0))};
+  HistogramRegistry registry{"registry", {{"x", "x", {HistType::kTH1F, {{200, -5, 5}}}}, {"xy", "xy", {HistType::kTH2F, {{200, -5, 5}, {200, -5, 5}}}}}};
+  for (auto _ : state) {
+    registry.fillBulk<test::X>(HIST("x"), table, test::x > -1.f);
+    registry.fillBulk<test::X, test::Y>(HIST("xy"), table, test::x > -1.f);
+  }
+  state.counters["Rows/s"] = benchmark::Counter(state.iterations() * state.range(0), benchmark::Counter::kIsRate);
+}
+
 BENCHMARK(BM_HashedNameLookup)->Arg(4)->Arg(8)->Arg(16)->Arg(64)->Arg(128)->Arg(256)->Arg(512);
 BENCHMARK(BM_StandardNameLookup)->Arg(4)->Arg(8)->Arg(16)->Arg(64)->Arg(128)->Arg(256)->Arg(512);
+BENCHMARK(BM_FillFromTableRowByRow)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_FillFromTableBulk)->Range(1 << 10, 1 << 20);
 
 BENCHMARK_MAIN();
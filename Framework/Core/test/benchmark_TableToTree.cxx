@@ -13,6 +13,7 @@
 #include "Framework/TableTreeHelpers.h"
 #include <benchmark/benchmark.h>
 #include <random>
+#include <string>
 #include <vector>
 
 #include <TFile.h>
@@ -74,4 +75,53 @@ static void BM_TableToTree(benchmark::State& state)
 
 BENCHMARK(BM_TableToTree)->Range(8, 8 << maxrange);
 
+// the tables of a time frame, written by a number of threads
+static void BM_ParallelTableToTree(benchmark::State& state)
+{
+  constexpr int nTables = 32;
+  constexpr int nRows = 1 << 16;
+  const int nThreads = state.range(0);
+
+  std::default_random_engine e1(1234567891);
+  std::uniform_real_distribution<double> rd(0, 1);
+  std::normal_distribution<float> rf(5., 2.);
+  std::discrete_distribution<ULong64_t> rl({10, 20, 30, 30, 5, 5});
+  std::discrete_distribution<int> ri({10, 20, 30, 30, 5, 5});
+
+  std::vector<std::shared_ptr<arrow::Table>> tables;
+  for (auto t = 0; t < nTables; ++t) {
+    TableBuilder builder;
+    auto rowWriter =
+      builder.persist<double, float, ULong64_t, int>({"a", "b", "c", "d"});
+    for (auto i = 0; i < nRows; ++i) {
+      rowWriter(0, rd(e1), rf(e1), rl(e1), ri(e1));
+    }
+    tables.push_back(builder.finalize());
+  }
+
+  // with one thread the writer uses TableToTree directly, as the AOD writer does
+  ParallelTableToTree writer(nThreads);
+  for (auto _ : state) {
+    TFile fout("paralleltable2tree.root", "RECREATE");
+    fout.mkdir("DF_0");
+    for (auto t = 0; t < nTables; ++t) {
+      auto treename = "DF_0/table" + std::to_string(t);
+      if (nThreads == 1) {
+        TableToTree ta2tr(tables[t], &fout, treename.c_str());
+        ta2tr.addAllBranches();
+        ta2tr.process();
+      } else {
+        writer.addTable(tables[t], &fout, treename);
+      }
+    }
+    writer.process();
+    fout.Close();
+  }
+
+  state.SetBytesProcessed(state.iterations() * nTables * nRows * 24);
+  state.counters["threads"] = nThreads;
+}
+
+BENCHMARK(BM_ParallelTableToTree)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime()->Unit(benchmark::kMillisecond);
+
 BENCHMARK_MAIN();
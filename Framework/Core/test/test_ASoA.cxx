@@ -634,6 +634,64 @@ TEST_CASE("TestFilteredOperators")
   REQUIRE(i == 3);
 }
 
+TEST_CASE("TestSelectionBitmap")
+{
+  // sparse selections are merged as vectors, dense ones through the bitmap
+  for (int step : {1, 2, 100}) {
+    SelectionVector a;
+    SelectionVector b;
+    for (int64_t i = 0; i < 1000; i += step) {
+      a.push_back(i);
+      b.push_back(i + step / 2 + (i % 3 == 0));
+    }
+    SelectionVector expectedUnion;
+    SelectionVector expectedIntersection;
+    std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expectedUnion));
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expectedIntersection));
+    REQUIRE(selectionUnion(a, b) == expectedUnion);
+    REQUIRE(selectionIntersection(a, b) == expectedIntersection);
+  }
+
+  SelectionVector rows{1, 5, 63, 64, 65, 130, 199};
+  SelectionBitmap bitmap{rows, 200};
+  REQUIRE(bitmap.count() == 7);
+  REQUIRE(bitmap.test(63));
+  REQUIRE(!bitmap.test(62));
+  REQUIRE(bitmap.toVector() == rows);
+
+  auto slice = bitmap.slice(5, 131);
+  REQUIRE(slice.count() == 5);
+  REQUIRE(slice.toVector() == SelectionVector{0, 58, 59, 60, 125});
+
+  SelectionBitmap other{SelectionVector{0, 1, 64, 150}, 151};
+  auto both = bitmap;
+  both &= other;
+  REQUIRE(both.toVector() == SelectionVector{1, 64});
+  auto any = bitmap;
+  any |= other;
+  REQUIRE(any.toVector() == SelectionVector{0, 1, 5, 63, 64, 65, 130, 150, 199});
+
+  auto selection = bitmap.toSelection();
+  REQUIRE(selection->GetNumSlots() == 7);
+  REQUIRE(SelectionBitmap{selection, 200}.toVector() == rows);
+  REQUIRE(selectionToVector(selection) == rows);
+
+  // selections with narrower indices, as made by gandiva for small batches
+  gandiva::Selection selection16;
+  REQUIRE(gandiva::SelectionVector::MakeInt16(200, arrow::default_memory_pool(), &selection16).ok());
+  gandiva::Selection selection32;
+  REQUIRE(gandiva::SelectionVector::MakeInt32(200, arrow::default_memory_pool(), &selection32).ok());
+  for (size_t i = 0; i < rows.size(); ++i) {
+    selection16->SetIndex(i, rows[i]);
+    selection32->SetIndex(i, rows[i]);
+  }
+  selection16->SetNumSlots(rows.size());
+  selection32->SetNumSlots(rows.size());
+  REQUIRE(selectionToVector(selection16) == rows);
+  REQUIRE(selectionToVector(selection32) == rows);
+  REQUIRE(selectionToVector(nullptr).empty());
+}
+
 TEST_CASE("TestNestedFiltering")
 {
   TableBuilder builderA;
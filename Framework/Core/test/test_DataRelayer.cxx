@@ -112,6 +112,59 @@ TEST_CASE("DataRelayer")
     REQUIRE(result.at(0).size() == 1);
   }
 
+  // The first route matching a header gets it, also when a wildcard
+  // comes before a route for its exact subspec.
+  SECTION("TestRouteOrder")
+  {
+    std::vector<InputRoute> inputs = {
+      InputRoute{InputSpec{"link1", "TPC", "CLUSTERS", 1}, 0, "Fake", 0},
+      InputRoute{InputSpec{"any", ConcreteDataTypeMatcher{"TPC", "CLUSTERS"}}, 1, "Fake", 0},
+      InputRoute{InputSpec{"link0", "TPC", "CLUSTERS", 0}, 2, "Fake", 0},
+      InputRoute{InputSpec{"tracks", "TPC", "TRACKS", 0}, 3, "Fake", 0}};
+
+    std::vector<ForwardRoute> forwards;
+    std::vector<InputChannelInfo> infos{1};
+    TimesliceIndex index{1, infos};
+
+    auto policy = CompletionPolicyHelpers::consumeWhenAny();
+    DataRelayer relayer(policy, inputs, index, {registry});
+    relayer.setPipelineLength(4);
+
+    auto transport = fair::mq::TransportFactory::CreateTransportFactory("zeromq");
+    auto channelAlloc = o2::pmr::getTransportAllocator(transport.get());
+    auto relayTo = [&](o2::header::DataDescription description, DataHeader::SubSpecificationType subSpec, size_t timeslice) {
+      DataHeader dh;
+      dh.dataDescription = description;
+      dh.dataOrigin = "TPC";
+      dh.subSpecification = subSpec;
+      dh.splitPayloadIndex = 0;
+      dh.splitPayloadParts = 1;
+      DataProcessingHeader dph{timeslice, 1};
+      std::array<fair::mq::MessagePtr, 2> messages;
+      messages[0] = o2::pmr::getMessage(Stack{channelAlloc, dh, dph});
+      messages[1] = transport->CreateMessage(1000);
+      relayer.relay(messages[0]->GetData(), messages.data(), messages.size());
+      std::vector<RecordAction> ready;
+      relayer.getReadyToProcess(ready);
+      REQUIRE(ready.size() == 1);
+      auto result = relayer.consumeAllInputsForTimeslice(ready[0].slot);
+      REQUIRE(result.size() == 4);
+      int input = -1;
+      for (size_t i = 0; i < result.size(); ++i) {
+        if (result[i].size() != 0) {
+          REQUIRE(input == -1);
+          input = i;
+        }
+      }
+      return input;
+    };
+
+    REQUIRE(relayTo("CLUSTERS", 1, 0) == 0);
+    REQUIRE(relayTo("CLUSTERS", 0, 1) == 1);
+    REQUIRE(relayTo("CLUSTERS", 5, 2) == 1);
+    REQUIRE(relayTo("TRACKS", 0, 3) == 3);
+  }
+
   //
   SECTION("TestNoWaitMatcher")
   {
@@ -515,3 +515,69 @@ TEST_CASE("TestHelpers")
   REQUIRE(metric2 == 0);
   REQUIRE(metric3 == 1);
 }
+
+TEST_CASE("TestBinaryMetrics")
+{
+  using namespace o2::framework;
+  DeviceMetricsInfo textInfo;
+  DeviceMetricsInfo binaryInfo;
+  std::vector<char> frame;
+  ParsedMetricMatch match;
+
+  // The same updates, once as text and once in binary form.
+  std::vector<std::string> declarations = {"[METRIC] bkey,0 12 1000 hostname=test.cern.ch",
+                                           "[METRIC] fkey,2 1.5 1001 hostname=test.cern.ch",
+                                           "[METRIC] ukey,3 7 1002 hostname=test.cern.ch",
+                                           "[METRIC] data_relayer/1,0 2 1003 hostname=test.cern.ch"};
+  DeviceMetricsHelper::beginBinaryMetrics(frame);
+  for (size_t i = 0; i < declarations.size(); ++i) {
+    REQUIRE(DeviceMetricsHelper::parseMetric(declarations[i], match));
+    REQUIRE(DeviceMetricsHelper::processMetric(match, textInfo));
+    DeviceMetricsHelper::declareBinaryMetric(frame, i, declarations[i]);
+  }
+  REQUIRE(DeviceMetricsHelper::isBinaryMetrics({frame.data(), frame.size()}));
+  REQUIRE(DeviceMetricsHelper::processBinaryMetrics({frame.data(), frame.size()}, binaryInfo));
+  REQUIRE(binaryInfo.metrics.size() == 4);
+  REQUIRE(binaryInfo.binaryMetricsIndex.size() == 4);
+
+  DeviceMetricsHelper::beginBinaryMetrics(frame);
+  for (int i = 0; i < 10; ++i) {
+    auto textInt = "[METRIC] bkey,0 " + std::to_string(i) + " " + std::to_string(2000 + i) + " hostname=test.cern.ch";
+    auto textFloat = "[METRIC] fkey,2 " + std::to_string(i * 0.5f) + " " + std::to_string(2000 + i) + " hostname=test.cern.ch";
+    auto textUint64 = "[METRIC] ukey,3 " + std::to_string(i * 100) + " " + std::to_string(2000 + i) + " hostname=test.cern.ch";
+    auto textEnum = "[METRIC] data_relayer/1,0 " + std::to_string(i % 3) + " " + std::to_string(2000 + i) + " hostname=test.cern.ch";
+    for (auto& text : {textInt, textFloat, textUint64, textEnum}) {
+      REQUIRE(DeviceMetricsHelper::parseMetric(text, match));
+      REQUIRE(DeviceMetricsHelper::processMetric(match, textInfo));
+    }
+    DeviceMetricsHelper::addBinaryMetric<int>(frame, 0, i, 2000 + i);
+    DeviceMetricsHelper::addBinaryMetric<float>(frame, 1, i * 0.5f, 2000 + i);
+    DeviceMetricsHelper::addBinaryMetric<uint64_t>(frame, 2, i * 100, 2000 + i);
+    DeviceMetricsHelper::addBinaryMetric<int>(frame, 3, i % 3, 2000 + i);
+  }
+  // Updates for metrics which were not declared are ignored
+  DeviceMetricsHelper::addBinaryMetric<int>(frame, 10, 1, 3000);
+  REQUIRE(DeviceMetricsHelper::processBinaryMetrics({frame.data(), frame.size()}, binaryInfo));
+
+  REQUIRE(binaryInfo.metrics.size() == textInfo.metrics.size());
+  for (size_t mi = 0; mi < textInfo.metrics.size(); ++mi) {
+    auto& textMetric = textInfo.metrics[mi];
+    auto& binaryMetric = binaryInfo.metrics[mi];
+    REQUIRE(std::string_view(textInfo.metricLabels[mi].label) == std::string_view(binaryInfo.metricLabels[mi].label));
+    REQUIRE(textMetric.type == binaryMetric.type);
+    REQUIRE(textMetric.filledMetrics == binaryMetric.filledMetrics);
+    REQUIRE(textMetric.pos == binaryMetric.pos);
+    REQUIRE(textInfo.min[mi] == binaryInfo.min[mi]);
+    REQUIRE(textInfo.max[mi] == binaryInfo.max[mi]);
+    REQUIRE(textInfo.maxDomain[mi] == binaryInfo.maxDomain[mi]);
+  }
+  REQUIRE(textInfo.intMetrics == binaryInfo.intMetrics);
+  REQUIRE(textInfo.floatMetrics == binaryInfo.floatMetrics);
+  REQUIRE(textInfo.uint64Metrics == binaryInfo.uint64Metrics);
+  REQUIRE(textInfo.enumMetrics == binaryInfo.enumMetrics);
+  REQUIRE(textInfo.intTimestamps == binaryInfo.intTimestamps);
+
+  // Truncated frames are rejected
+  frame.resize(frame.size() - 1);
+  REQUIRE(DeviceMetricsHelper::processBinaryMetrics({frame.data(), frame.size()}, binaryInfo) == false);
+}
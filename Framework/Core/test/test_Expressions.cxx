@@ -267,3 +267,32 @@ TEST_CASE("TestConditionalExpressions")
   auto gandiva_filter2 = createFilter(schema2, gandiva_condition2);
   REQUIRE(gandiva_tree2->ToString() == "bool greater_than((float) fSigned1Pt, (const float) 0 raw(0)) && if (bool less_than(float absf((float) fEta), (const float) 1 raw(3f800000)) && if (bool less_than((float) fPt, (const float) 1 raw(3f800000))) { bool greater_than((float) fPhi, (const float) 1.5708 raw(3fc90fdb)) } else { bool less_than((float) fPhi, (const float) 1.5708 raw(3fc90fdb)) }) { bool greater_than(float absf((float) fX), (const float) 1 raw(3f800000)) } else { bool greater_than(float absf((float) fY), (const float) 1 raw(3f800000)) }");
 }
+
+TEST_CASE("TestCompiledExpressionsReuse")
+{
+  // the cache is shared by the whole process, the cuts must not be used by any other test
+  auto schema = std::make_shared<arrow::Schema>(std::vector{o2::aod::track::Pt::asArrowField(), o2::aod::track::Eta::asArrowField()});
+  Filter f1 = (o2::aod::track::pt > 0.3125f) && (nabs(o2::aod::track::eta) < 0.8125f);
+  Filter f2 = (o2::aod::track::pt > 0.3125f) && (nabs(o2::aod::track::eta) < 0.8125f);
+  Filter f3 = (o2::aod::track::pt > 0.4375f) && (nabs(o2::aod::track::eta) < 0.8125f);
+
+  auto before = getCompilationStats();
+  auto filter1 = createFilter(schema, createOperations(f1));
+  auto filter2 = createFilter(schema, createOperations(f2));
+  auto filter3 = createFilter(schema, createOperations(f3));
+  auto after = getCompilationStats();
+
+  // the same expression for the same schema is compiled only once
+  REQUIRE(!filter1->GetBuiltFromCache());
+  REQUIRE(filter2->GetBuiltFromCache());
+  REQUIRE(!filter3->GetBuiltFromCache());
+  REQUIRE(after.misses - before.misses == 2);
+  REQUIRE(after.hits - before.hits == 1);
+
+  // a different schema needs a new compilation
+  auto schema2 = std::make_shared<arrow::Schema>(std::vector{o2::aod::track::Eta::asArrowField(), o2::aod::track::Pt::asArrowField()});
+  auto filter4 = createFilter(schema2, createOperations(f1));
+  REQUIRE(!filter4->GetBuiltFromCache());
+  REQUIRE(getCompilationStats().misses - after.misses == 1);
+  REQUIRE(getCompilationStats().hits - after.hits == 0);
+}
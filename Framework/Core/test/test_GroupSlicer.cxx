@@ -505,6 +505,62 @@ TEST_CASE("EmptySliceables")
   }
 }
 
+TEST_CASE("GroupSlicerFilteredAssociated")
+{
+  TableBuilder builderE;
+  auto evtsWriter = builderE.cursor<aod::Events>();
+  for (auto i = 0; i < 20; ++i) {
+    evtsWriter(0, i, 0.5f * i, 2.f * i, 3.f * i);
+  }
+  auto evtTable = builderE.finalize();
+
+  TableBuilder builderT;
+  auto trksWriter = builderT.cursor<aod::TrksX>();
+  soa::SelectionVector rows;
+  for (auto i = 0; i < 20; ++i) {
+    for (auto j = 0; j < 10; ++j) {
+      trksWriter(0, i, 0.5f * j);
+      if (j % 2 == 0) {
+        rows.push_back(10 * i + j);
+      }
+    }
+  }
+  auto trkTable = builderT.finalize();
+  aod::Events e{evtTable};
+  soa::Filtered<aod::TrksX> t{{trkTable}, std::move(rows)};
+  REQUIRE(e.size() == 20);
+  REQUIRE(t.size() == 5 * 20);
+
+  auto tt = std::make_tuple(t);
+  ArrowTableSlicingCache slices({{soa::getLabelFromType<aod::TrksX>(), "fIndex" + o2::framework::cutString(soa::getLabelFromType<aod::Events>())}});
+  auto s = slices.updateCacheEntry(0, trkTable);
+  o2::framework::GroupSlicer g(e, tt, slices);
+
+  unsigned int count = 0;
+  for (auto& slice : g) {
+    auto as = slice.associatedTables();
+    auto gg = slice.groupingElement();
+    REQUIRE(gg.globalIndex() == count);
+    auto trks = std::get<soa::Filtered<aod::TrksX>>(as);
+    REQUIRE(trks.size() == 5);
+    // the slice references the selection of the whole table, its rows are rebased on request
+    auto selected = trks.getSelectedRows();
+    for (auto i = 0; i < 5; ++i) {
+      REQUIRE(selected[i] == 2 * i);
+    }
+    auto i = 0;
+    for (auto& trk : trks) {
+      REQUIRE(trk.eventId() == count);
+      REQUIRE(trk.x() == 0.5f * 2 * i);
+      REQUIRE(trk.globalIndex() == 10 * count + 2 * i);
+      ++i;
+    }
+    REQUIRE(i == 5);
+    ++count;
+  }
+  REQUIRE(count == 20);
+}
+
 TEST_CASE("ArrowDirectSlicing")
 {
   int counts[] = {5, 5, 5, 4, 1};
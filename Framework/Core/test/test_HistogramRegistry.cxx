@@ -105,6 +105,57 @@ TEST_CASE("HistogramRegistryExpressionFill")
   REQUIRE(registry.get<TH2>(HIST("xy"))->GetEntries() == 2);
 }
 
+TEST_CASE("HistogramRegistryBulkFill")
+{
+  TableBuilder builder;
+  auto rowWriter = builder.persist<float, float>({"x", "y"});
+  for (auto i = 0; i < 5000; ++i) {
+    rowWriter(0, 0.01f * (i % 1200) - 1.f, 0.005f * (i % 3000) - 2.5f);
+  }
+  auto table = builder.finalize();
+  using TestA = o2::soa::Table<o2::soa::Index<>, test::X, test::Y>;
+  TestA tests{table};
+
+  std::vector<double> varEdges{-1., 0., 0.5, 1., 4., 8.};
+  HistogramRegistry registry{
+    "registry", {
+                  {"x", "test x", {HistType::kTH1F, {{100, 0.0f, 10.0f}}}},                                 //
+                  {"xBulk", "test x", {HistType::kTH1F, {{100, 0.0f, 10.0f}}}},                             //
+                  {"xVar", "test x", {HistType::kTH1D, {AxisSpec{varEdges}}}},                              //
+                  {"xVarBulk", "test x", {HistType::kTH1D, {AxisSpec{varEdges}}}},                          //
+                  {"xy", "test xy", {HistType::kTH2F, {{100, -10.0f, 10.01f}, {100, -10.0f, 10.01f}}}},     //
+                  {"xyBulk", "test xy", {HistType::kTH2F, {{100, -10.0f, 10.01f}, {100, -10.0f, 10.01f}}}}, //
+                  {"xWeighted", "test x", {HistType::kTH1D, {{50, -2.0f, 2.0f}}}},                          //
+                  {"xWeightedBulk", "test x", {HistType::kTH1D, {{50, -2.0f, 2.0f}}}}                       //
+                }                                                                                           //
+  };
+
+  registry.fill<test::X>(HIST("x"), tests, test::x > 3.0f);
+  registry.fillBulk<test::X>(HIST("xBulk"), tests, test::x > 3.0f);
+  registry.fill<test::X>(HIST("xVar"), tests, test::x > -2.0f);
+  registry.fillBulk<test::X>(HIST("xVarBulk"), tests, test::x > -2.0f);
+  registry.fill<test::X, test::Y>(HIST("xy"), tests, test::x > 3.0f && test::y > -5.0f);
+  registry.fillBulk<test::X, test::Y>(HIST("xyBulk"), tests, test::x > 3.0f && test::y > -5.0f);
+  registry.fill<test::X, test::Y>(HIST("xWeighted"), tests, test::y > 0.0f);
+  registry.fillBulk<test::X, test::Y>(HIST("xWeightedBulk"), tests, test::y > 0.0f);
+
+  auto compare = [](auto const& rowByRow, auto const& bulk) {
+    REQUIRE(rowByRow->GetEntries() == bulk->GetEntries());
+    REQUIRE(rowByRow->GetNcells() == bulk->GetNcells());
+    for (auto bin = 0; bin < rowByRow->GetNcells(); ++bin) {
+      REQUIRE(rowByRow->GetBinContent(bin) == Catch::Approx(bulk->GetBinContent(bin)));
+      REQUIRE(rowByRow->GetBinError(bin) == Catch::Approx(bulk->GetBinError(bin)));
+    }
+    REQUIRE(rowByRow->GetMean() == Catch::Approx(bulk->GetMean()));
+    REQUIRE(rowByRow->GetStdDev() == Catch::Approx(bulk->GetStdDev()));
+  };
+  compare(registry.get<TH1>(HIST("x")), registry.get<TH1>(HIST("xBulk")));
+  compare(registry.get<TH1>(HIST("xVar")), registry.get<TH1>(HIST("xVarBulk")));
+  compare(registry.get<TH2>(HIST("xy")), registry.get<TH2>(HIST("xyBulk")));
+  compare(registry.get<TH1>(HIST("xWeighted")), registry.get<TH1>(HIST("xWeightedBulk")));
+  REQUIRE(registry.get<TH2>(HIST("xyBulk"))->GetMean(2) == Catch::Approx(registry.get<TH2>(HIST("xy"))->GetMean(2)));
+}
+
 TEST_CASE("HistogramRegistryStepTHn")
 {
   HistogramRegistry registry{"registry"};
@@ -0,0 +1,170 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include <catch_amalgamated.hpp>
+
+#include "Framework/TableTreeHelpers.h"
+#include "Framework/TableBuilder.h"
+
+#include <TFile.h>
+#include <TTree.h>
+#include <arrow/table.h>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace o2::framework;
+
+namespace
+{
+constexpr int nTimeFrames = 3; // time frames merged into the same trees, as with ntfmerge > 1
+constexpr int nTables = 5;
+
+std::shared_ptr<arrow::Table> makeTable(std::default_random_engine& e1, int nRows)
+{
+  std::normal_distribution<float> rf(5., 2.);
+  std::uniform_int_distribution<int> ri(-100, 100);
+  TableBuilder builder;
+  auto rowWriter = builder.persist<double, float, uint64_t, int, float[3]>({"a", "b", "c", "d", "e"});
+  for (auto i = 0; i < nRows; ++i) {
+    float e[3] = {rf(e1), rf(e1), rf(e1)};
+    rowWriter(0, rf(e1) * 0.1, rf(e1), uint64_t(i) << 33, ri(e1), e);
+  }
+  return builder.finalize();
+}
+
+std::string treeName(int t)
+{
+  return "DF_0/O2table" + std::to_string(t);
+}
+
+// the columns written for a table, all of them for the even ones, a subset
+// including a missing column for the odd ones
+std::vector<std::string> columnNames(int t)
+{
+  if (t % 2 == 0) {
+    return {};
+  }
+  return {"d", "a", "missing", "e"};
+}
+
+// reference, the tables written one after the other with TableToTree as the AOD writer does
+void writeSerial(std::vector<std::vector<std::shared_ptr<arrow::Table>>> const& timeFrames, char const* filename)
+{
+  TFile file(filename, "RECREATE");
+  file.mkdir("DF_0");
+  for (auto const& tables : timeFrames) {
+    for (auto t = 0; t < nTables; ++t) {
+      auto const& table = tables[t];
+      TableToTree ta2tr(table, &file, treeName(t).c_str());
+      auto columns = columnNames(t);
+      if (columns.empty()) {
+        ta2tr.addAllBranches();
+      }
+      for (auto const& name : columns) {
+        auto idx = table->schema()->GetFieldIndex(name);
+        if (idx != -1) {
+          ta2tr.addBranch(table->column(idx), table->schema()->field(idx));
+        }
+      }
+      ta2tr.process();
+    }
+  }
+  file.Close();
+}
+
+void writeParallel(std::vector<std::vector<std::shared_ptr<arrow::Table>>> const& timeFrames, char const* filename, int nThreads, int64_t maxBytesInFlight)
+{
+  TFile file(filename, "RECREATE");
+  file.mkdir("DF_0");
+  ParallelTableToTree writer(nThreads, maxBytesInFlight);
+  for (auto const& tables : timeFrames) {
+    for (auto t = 0; t < nTables; ++t) {
+      writer.addTable(tables[t], &file, treeName(t), columnNames(t));
+    }
+    // the trees exist from the second time frame on and are appended to
+    writer.process();
+  }
+  file.Close();
+}
+
+std::shared_ptr<arrow::Table> readTree(TFile& file, std::string const& name)
+{
+  auto tree = (TTree*)file.Get(name.c_str());
+  REQUIRE(tree != nullptr);
+  TreeToTable tr2ta;
+  tr2ta.addAllColumns(tree);
+  tr2ta.fill(tree);
+  return tr2ta.finalize();
+}
+
+void checkSameTrees(char const* reference, char const* filename)
+{
+  TFile file1(reference, "READ");
+  TFile file2(filename, "READ");
+  for (auto t = 0; t < nTables; ++t) {
+    auto tree1 = (TTree*)file1.Get(treeName(t).c_str());
+    auto tree2 = (TTree*)file2.Get(treeName(t).c_str());
+    REQUIRE(tree1 != nullptr);
+    REQUIRE(tree2 != nullptr);
+    REQUIRE(tree1->GetEntries() == tree2->GetEntries());
+    REQUIRE(tree1->GetNbranches() == tree2->GetNbranches());
+    for (auto b = 0; b < tree1->GetNbranches(); ++b) {
+      REQUIRE(std::string(static_cast<TBranch*>(tree1->GetListOfBranches()->At(b))->GetName()) ==
+              std::string(static_cast<TBranch*>(tree2->GetListOfBranches()->At(b))->GetName()));
+    }
+    auto table1 = readTree(file1, treeName(t));
+    auto table2 = readTree(file2, treeName(t));
+    REQUIRE(table1->Equals(*table2));
+  }
+}
+} // namespace
+
+TEST_CASE("ParallelTableToTree")
+{
+  std::default_random_engine e1(1234567891);
+  std::vector<std::vector<std::shared_ptr<arrow::Table>>> timeFrames(nTimeFrames);
+  for (auto& tables : timeFrames) {
+    for (auto t = 0; t < nTables; ++t) {
+      tables.push_back(makeTable(e1, 100 + 1000 * t));
+    }
+  }
+
+  writeSerial(timeFrames, "table2tree_serial.root");
+  {
+    TFile file("table2tree_serial.root", "READ");
+    auto tree = (TTree*)file.Get(treeName(0).c_str());
+    REQUIRE(tree != nullptr);
+    REQUIRE(tree->GetEntries() == nTimeFrames * 100);
+    REQUIRE(tree->GetNbranches() == 5);
+    auto subset = (TTree*)file.Get(treeName(1).c_str());
+    REQUIRE(subset != nullptr);
+    REQUIRE(subset->GetNbranches() == 3);
+  }
+
+  SECTION("one group of tables")
+  {
+    writeParallel(timeFrames, "table2tree_parallel.root", 4, 256 * 1024 * 1024);
+    checkSameTrees("table2tree_serial.root", "table2tree_parallel.root");
+  }
+
+  SECTION("one table per group")
+  {
+    writeParallel(timeFrames, "table2tree_parallel.root", 3, 1);
+    checkSameTrees("table2tree_serial.root", "table2tree_parallel.root");
+  }
+
+  SECTION("single thread")
+  {
+    writeParallel(timeFrames, "table2tree_parallel.root", 1, 256 * 1024 * 1024);
+    checkSameTrees("table2tree_serial.root", "table2tree_parallel.root");
+  }
+}
@@ -67,6 +67,8 @@ void* _o2_log_create(char const* name, char const* category);
 #define O2_LOG_ENABLE_DYNAMIC(log)
 // This is a no-op on macOS using the os_signpost API because only external instruments can enable/disable dynamic signposts
 #define O2_LOG_ENABLE_STACKTRACE(log)
+// This is a no-op on macOS, signposts are recorded by Instruments
+#define O2_LOG_ENABLE_TRACING(log)
 #define O2_DECLARE_LOG(x, category) static os_log_t private_o2_log_##x = (os_log_t)_o2_log_create("ch.cern.aliceo2." #x, #category)
 #define O2_LOG_DEBUG(log, ...) os_log_debug(private_o2_log_##log, __VA_ARGS__)
 #define O2_SIGNPOST_ID_FROM_POINTER(name, log, pointer) os_signpost_id_t name = os_signpost_id_make_with_pointer(private_o2_log_##log, pointer)
@@ -115,10 +117,20 @@ void* _o2_log_create(char const* name, char const* category)
 }
 #endif
 
-#elif !defined(NDEBUG) || defined(O2_FORCE_LOGGER_SIGNPOST) || defined(O2_FORCE_SIGNPOSTS)
+#elif !defined(NDEBUG) || defined(O2_FORCE_LOGGER_SIGNPOST) || defined(O2_FORCE_SIGNPOSTS) || defined(O2_SIGNPOST_TRACING)
+
+// In optimised builds with O2_SIGNPOST_TRACING the signposts are never printed,
+// they are only recorded in the trace buffers when tracing is enabled for a given log.
+#if defined(NDEBUG) && !defined(O2_FORCE_LOGGER_SIGNPOST) && !defined(O2_FORCE_SIGNPOSTS)
+#define O2_SIGNPOST_TRACING_ONLY
+#endif
 
 #ifndef O2_LOG_MACRO
-#if __has_include("Framework/Logger.h")
+#if defined(O2_SIGNPOST_TRACING_ONLY)
+#define O2_LOG_MACRO(...) \
+  do {                    \
+  } while (0)
+#elif __has_include("Framework/Logger.h")
 #include "Framework/Logger.h"
 // If NDEBUG is not defined, we use the logger to print out the signposts at the debug level.
 #if !defined(NDEBUG)
@@ -139,12 +151,22 @@ void* _o2_log_create(char const* name, char const* category)
 #endif
 
 // This is the linux implementation, it is not as nice as the apple one and simply prints out
-// the signpost information to the log.
+// the signpost information to the log. In addition, signposts of the logs for which tracing
+// is enabled are recorded in per thread ring buffers, which can be dumped as Chrome trace
+// JSON (viewable with Perfetto or chrome://tracing) via o2_signpost_trace_dump.
 #include <atomic>
 #include <array>
 #include <cassert>
+#include <chrono>
 #include <cinttypes>
 #include <cstddef>
+#include <cstdio>
+#include <cstdarg>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define O2_SIGNPOST_HAS_TRACING 1
 
 struct _o2_lock_free_stack {
   static constexpr size_t N = 1024;
@@ -186,8 +208,57 @@ struct _o2_log_t {
   // 1 means only the current signpost is printed.
   // >1 means the current signpost and n levels of the stacktrace are printed.
   std::atomic<int> stacktrace = 1;
+
+  // The name of the log, used as category of the exported trace events.
+  char const* name = nullptr;
+  // Whether the signposts are recorded in the trace buffers.
+  // This is independent from the printing, controlled by stacktrace.
+  std::atomic<bool> tracing = false;
+};
+
+// A signpost as recorded in the trace buffers.
+struct _o2_signpost_trace_event_t {
+  // Sequence number of the event in the buffer plus one once it is completely
+  // written, 0 while the owning thread is writing it.
+  std::atomic<uint64_t> sequence = 0;
+  // Timestamp in CPU ticks, converted to time only when dumping.
+  uint64_t ticks = 0;
+  int64_t id = 0;
+  _o2_log_t* log = nullptr;
+  // Name of the signpost. Must be a string literal, since we only keep the pointer.
+  char const* name = nullptr;
+  // 'b', 'e' or 'i', like the async begin / end and instant events of the Chrome trace format.
+  char phase = 0;
+  // The formatted message, truncated if needed.
+  char message[95] = {0};
 };
 
+// Single producer ring buffer of trace events. Each thread records in its own buffer,
+// so that no synchronisation is needed between the threads emitting signposts.
+// The buffer is freed when its thread exits, together with the events it holds.
+struct _o2_signpost_trace_buffer_t {
+  static constexpr size_t N = 4096;
+  // Total number of events ever recorded. Event i is stored at position i % N.
+  std::atomic<uint64_t> head = 0;
+  int64_t tid = 0;
+  _o2_signpost_trace_buffer_t* next = nullptr;
+  _o2_signpost_trace_event_t events[N];
+};
+
+inline uint64_t _o2_signpost_ticks()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(__aarch64__)
+  uint64_t ticks;
+  __asm__ __volatile__("mrs %0, cntvct_el0"
+                       : "=r"(ticks));
+  return ticks;
+#else
+  return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
 bool _o2_lock_free_stack_push(_o2_lock_free_stack& stack, const int& value, bool spin = false);
 bool _o2_lock_free_stack_pop(_o2_lock_free_stack& stack, int& value, bool spin = false);
 //_o2_signpost_id_t _o2_signpost_id_generate_local(_o2_log_t* log);
@@ -198,6 +269,15 @@ void _o2_signpost_event_emit(_o2_log_t* log, _o2_signpost_id_t id, char const* n
 void _o2_signpost_interval_begin(_o2_log_t* log, _o2_signpost_id_t id, char const* name, char const* const format, ...);
 void _o2_signpost_interval_end(_o2_log_t* log, _o2_signpost_id_t id, char const* name, char const* const format, ...);
 void _o2_log_set_stacktrace(_o2_log_t* log, int stacktrace);
+void _o2_log_set_tracing(_o2_log_t* log, bool tracing);
+
+// Enable or disable the recording of the signposts of the log with the given name.
+// The name can be given with or without the "ch.cern.aliceo2." prefix.
+// Returns false if no such log exists.
+bool o2_log_set_tracing(char const* name, bool tracing);
+// Write the signposts recorded in the last windowUs microseconds (all of them if 0)
+// as Chrome trace JSON. Returns the number of events written.
+size_t o2_signpost_trace_dump(FILE* out, uint64_t windowUs = 0);
 
 // This generates a unique id for a signpost. Do not use this directly, use O2_SIGNPOST_ID_GENERATE instead.
 // Notice that this is only valid on a given computer.
@@ -231,11 +311,15 @@ inline _o2_signpost_index_t o2_signpost_id_make_with_pointer(_o2_log_t* log, voi
 // Implementation start here. Include this file with O2_SIGNPOST_IMPLEMENTATION defined in one file of your
 // project.
 #ifdef O2_SIGNPOST_IMPLEMENTATION
-#include <cstdarg>
-#include <cstdio>
 #include <cstring>
+#include <mutex>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 #include "Framework/RuntimeError.h"
 void _o2_signpost_interval_end_v(_o2_log_t* log, _o2_signpost_id_t id, char const* name, char const* const format, va_list args);
+void _o2_signpost_event_emit_v(_o2_log_t* log, _o2_signpost_id_t id, char const* name, char const* const format, va_list args);
 
 // returns true if the push was successful, false if the stack was full
 // @param spin if true, will spin until the stack is not full
@@ -323,6 +407,7 @@ void* _o2_log_create(char const* name, int stacktrace)
   o2_log_handle_t* newHandle = new o2_log_handle_t();
   newHandle->log = log;
   newHandle->name = strdup(name);
+  log->name = newHandle->name;
   newHandle->next = o2_get_logs_tail().load();
   // Until I manage to replace the log I have in next, keep trying.
   // Notice this does not protect against two threads trying to insert
@@ -336,16 +421,204 @@ void* _o2_log_create(char const* name, int stacktrace)
   return log;
 }
 
-// This will look at the slot in the log associated to the ID.
-// If the slot is empty, it will return the id and increment the indentation level.
+// The reference point used to convert ticks to time, taken the first time
+// tracing is enabled.
+struct _o2_signpost_clock_reference_t {
+  uint64_t ticks;
+  int64_t ns;
+};
+
+_o2_signpost_clock_reference_t const& _o2_signpost_clock_reference()
+{
+  static _o2_signpost_clock_reference_t reference{_o2_signpost_ticks(), std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()};
+  return reference;
+}
+
+// The list of all the trace buffers, so that they can be walked when dumping.
+// The mutex is only taken when a thread creates or frees its buffer and when
+// dumping, never when recording.
+struct _o2_signpost_trace_buffers_t {
+  std::mutex mutex;
+  _o2_signpost_trace_buffer_t* first = nullptr;
+};
+
+_o2_signpost_trace_buffers_t& _o2_signpost_trace_buffers()
+{
+  static _o2_signpost_trace_buffers_t buffers;
+  return buffers;
+}
+
+// Owns the trace buffer of a thread and frees it when the thread exits.
+struct _o2_signpost_trace_thread_buffer_t {
+  _o2_signpost_trace_buffer_t* buffer = nullptr;
+
+  ~_o2_signpost_trace_thread_buffer_t()
+  {
+    if (buffer == nullptr) {
+      return;
+    }
+    auto& buffers = _o2_signpost_trace_buffers();
+    {
+      std::lock_guard<std::mutex> lock(buffers.mutex);
+      auto** current = &buffers.first;
+      while (*current != buffer) {
+        current = &(*current)->next;
+      }
+      *current = buffer->next;
+    }
+    delete buffer;
+    buffer = nullptr;
+  }
+};
+
+// Get the trace buffer of the current thread, creating it on first use.
+_o2_signpost_trace_buffer_t* _o2_signpost_trace_thread_buffer()
+{
+  static thread_local _o2_signpost_trace_thread_buffer_t owner;
+  if (owner.buffer) {
+    return owner.buffer;
+  }
+  auto* buffer = new _o2_signpost_trace_buffer_t();
+#ifdef __linux__
+  buffer->tid = syscall(SYS_gettid);
+#else
+  static std::atomic<int64_t> nextThread = 1;
+  buffer->tid = nextThread++;
+#endif
+  auto& buffers = _o2_signpost_trace_buffers();
+  std::lock_guard<std::mutex> lock(buffers.mutex);
+  buffer->next = buffers.first;
+  buffers.first = buffer;
+  owner.buffer = buffer;
+  return buffer;
+}
+
+// Only the owning thread writes in the buffer, so we simply fill the next slot
+// and publish it by moving the head. The sequence number of the slot tells
+// a concurrent dump whether the event it copied was being overwritten.
+void _o2_signpost_trace_record(_o2_log_t* log, char phase, _o2_signpost_id_t id, char const* name, char const* const format, va_list args)
+{
+  _o2_signpost_trace_buffer_t* buffer = _o2_signpost_trace_thread_buffer();
+  uint64_t head = buffer->head.load(std::memory_order_relaxed);
+  _o2_signpost_trace_event_t& event = buffer->events[head % _o2_signpost_trace_buffer_t::N];
+  event.sequence.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  event.ticks = _o2_signpost_ticks();
+  event.id = id.id;
+  event.log = log;
+  event.name = name;
+  event.phase = phase;
+  vsnprintf(event.message, sizeof(event.message), format, args);
+  event.sequence.store(head + 1, std::memory_order_release);
+  buffer->head.store(head + 1, std::memory_order_release);
+}
+
+void _o2_signpost_json_escape(FILE* out, char const* s)
+{
+  for (; s && *s; ++s) {
+    auto c = (unsigned char)*s;
+    if (c == '"' || c == '\\') {
+      fprintf(out, "\\%c", c);
+    } else if (c < 0x20) {
+      fprintf(out, "\\u%04x", c);
+    } else {
+      fputc(c, out);
+    }
+  }
+}
+
+size_t o2_signpost_trace_dump(FILE* out, uint64_t windowUs)
+{
+  auto const& reference = _o2_signpost_clock_reference();
+  uint64_t nowTicks = _o2_signpost_ticks();
+  int64_t nowNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  // Calibrate the ticks using the time elapsed since the reference was taken.
+  double ticksPerUs = 1000.;
+  if (nowNs > reference.ns && nowTicks > reference.ticks) {
+    ticksPerUs = 1000. * double(nowTicks - reference.ticks) / double(nowNs - reference.ns);
+  }
+  double nowUs = double(nowTicks - reference.ticks) / ticksPerUs;
+  constexpr size_t N = _o2_signpost_trace_buffer_t::N;
+
+  // A copy of an event, taken while its thread might be recording.
+  struct {
+    uint64_t ticks;
+    int64_t id;
+    _o2_log_t* log;
+    char const* name;
+    char phase;
+    char message[sizeof(_o2_signpost_trace_event_t::message)];
+  } event;
+
+  size_t count = 0;
+  fprintf(out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+  auto& buffers = _o2_signpost_trace_buffers();
+  // Keeps the threads from freeing their buffer while we read it.
+  std::lock_guard<std::mutex> lock(buffers.mutex);
+  for (auto* buffer = buffers.first; buffer; buffer = buffer->next) {
+    uint64_t head = buffer->head.load(std::memory_order_acquire);
+    for (uint64_t i = head > N ? head - N : 0; i < head; ++i) {
+      auto& slot = buffer->events[i % N];
+      if (slot.sequence.load(std::memory_order_acquire) != i + 1) {
+        continue;
+      }
+      event.ticks = slot.ticks;
+      event.id = slot.id;
+      event.log = slot.log;
+      event.name = slot.name;
+      event.phase = slot.phase;
+      memcpy(event.message, slot.message, sizeof(event.message));
+      event.message[sizeof(event.message) - 1] = 0;
+      // The owning thread might have started overwriting the event while we were copying it.
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.sequence.load(std::memory_order_relaxed) != i + 1) {
+        continue;
+      }
+      double ts = double(event.ticks - reference.ticks) / ticksPerUs;
+      if (windowUs && ts + windowUs < nowUs) {
+        continue;
+      }
+      fprintf(out, "%s\n{\"name\":\"", count ? "," : "");
+      _o2_signpost_json_escape(out, event.name);
+      fprintf(out, "\",\"cat\":\"");
+      _o2_signpost_json_escape(out, event.log->name);
+      fprintf(out, "\",\"ph\":\"%c\",%s\"ts\":%.3f,\"pid\":%d,\"tid\":%" PRId64 ",\"id\":\"0x%" PRIx64 "\",\"args\":{\"message\":\"",
+              event.phase, event.phase == 'i' ? "\"s\":\"t\"," : "", ts, (int)getpid(), buffer->tid, event.id);
+      _o2_signpost_json_escape(out, event.message);
+      fprintf(out, "\"}}");
+      count++;
+    }
+  }
+  fprintf(out, "\n]}\n");
+  return count;
+}
+
 void _o2_signpost_event_emit(_o2_log_t* log, _o2_signpost_id_t id, char const* name, char const* const format, ...)
 {
   // Nothing to be done
-  if (log->stacktrace == 0) {
+  if (log->stacktrace == 0 && log->tracing == false) {
     return;
   }
   va_list args;
   va_start(args, format);
+  if (log->tracing) {
+    va_list traceArgs;
+    va_copy(traceArgs, args);
+    _o2_signpost_trace_record(log, 'i', id, name, format, traceArgs);
+    va_end(traceArgs);
+  }
+  _o2_signpost_event_emit_v(log, id, name, format, args);
+  va_end(args);
+}
+
+// This will look at the slot in the log associated to the ID.
+// If the slot is empty, it will return the id and increment the indentation level.
+void _o2_signpost_event_emit_v(_o2_log_t* log, _o2_signpost_id_t id, char const* name, char const* const format, va_list args)
+{
+  // Nothing to be done
+  if (log->stacktrace == 0) {
+    return;
+  }
 
   // Find the index of the activity
   int leading = 0;
@@ -370,7 +643,6 @@ void _o2_signpost_event_emit(_o2_log_t* log, _o2_signpost_id_t id, char const* n
   char prebuffer[4096];
   int s = snprintf(prebuffer, 4096, "id%.16" PRIx64 ":%-16s*>%*c", id.id, name, leading, ' ');
   vsnprintf(prebuffer + s, 4096 - s, format, args);
-  va_end(args);
   O2_LOG_MACRO("%s", prebuffer);
 }
 
@@ -378,11 +650,21 @@ void _o2_signpost_event_emit(_o2_log_t* log, _o2_signpost_id_t id, char const* n
 // If the slot is empty, it will return the id and increment the indentation level.
 void _o2_signpost_interval_begin(_o2_log_t* log, _o2_signpost_id_t id, char const* name, char const* const format, ...)
 {
-  if (log->stacktrace == 0) {
+  if (log->stacktrace == 0 && log->tracing == false) {
     return;
   }
   va_list args;
   va_start(args, format);
+  if (log->tracing) {
+    va_list traceArgs;
+    va_copy(traceArgs, args);
+    _o2_signpost_trace_record(log, 'b', id, name, format, traceArgs);
+    va_end(traceArgs);
+  }
+  if (log->stacktrace == 0) {
+    va_end(args);
+    return;
+  }
   // This is a unique slot for this interval.
   _o2_signpost_index_t signpost_index;
   _o2_lock_free_stack_pop(log->slots, signpost_index, true);
@@ -401,6 +683,12 @@ void _o2_signpost_interval_begin(_o2_log_t* log, _o2_signpost_id_t id, char cons
 
 void _o2_signpost_interval_end_v(_o2_log_t* log, _o2_signpost_id_t id, char const* name, char const* const format, va_list args)
 {
+  if (log->tracing) {
+    va_list traceArgs;
+    va_copy(traceArgs, args);
+    _o2_signpost_trace_record(log, 'e', id, name, format, traceArgs);
+    va_end(traceArgs);
+  }
   if (log->stacktrace == 0) {
     return;
   }
@@ -415,7 +703,7 @@ void _o2_signpost_interval_end_v(_o2_log_t* log, _o2_signpost_id_t id, char cons
   // We should not make this an error because one could have enabled the log after the interval
   // was started.
   if (i == log->ids.size()) {
-    _o2_signpost_event_emit(log, id, name, format, args);
+    _o2_signpost_event_emit_v(log, id, name, format, args);
     return;
   }
   // i is the slot index
@@ -449,6 +737,32 @@ void _o2_log_set_stacktrace(_o2_log_t* log, int stacktrace)
 {
   log->stacktrace = stacktrace;
 }
+
+void _o2_log_set_tracing(_o2_log_t* log, bool tracing)
+{
+  // Make sure the reference point for the timestamps is taken before the first event.
+  _o2_signpost_clock_reference();
+  log->tracing = tracing;
+}
+
+bool o2_log_set_tracing(char const* name, bool tracing)
+{
+  o2_log_handle_t* handle = o2_walk_logs([](char const* currentName, void* log, void* context) -> bool {
+    char const* name = (char const*)context;
+    constexpr char prefix[] = "ch.cern.aliceo2.";
+    constexpr size_t prefixSize = sizeof(prefix) - 1;
+    if (strncmp(currentName, prefix, prefixSize) == 0 && strcmp(currentName + prefixSize, name) == 0) {
+      return false;
+    }
+    return strcmp(name, currentName) != 0;
+  },
+                                         (void*)name);
+  if (handle == nullptr) {
+    return false;
+  }
+  _o2_log_set_tracing((_o2_log_t*)handle->log, tracing);
+  return true;
+}
 #endif // O2_SIGNPOST_IMPLEMENTATION
 
 /// Dynamic logs need to be enabled via the O2_LOG_ENABLE_DYNAMIC macro. Notice this will only work
@@ -456,18 +770,40 @@ void _o2_log_set_stacktrace(_o2_log_t* log, int stacktrace)
 #define O2_DECLARE_DYNAMIC_LOG(name) static _o2_log_t* private_o2_log_##name = (_o2_log_t*)_o2_log_create("ch.cern.aliceo2." #name, 0)
 /// For the moment we do not support logs with a stacktrace.
 #define O2_DECLARE_DYNAMIC_STACKTRACE_LOG(name) static _o2_log_t* private_o2_log_##name = (_o2_log_t*)_o2_log_create("ch.cern.aliceo2." #name, 0)
+#ifdef O2_SIGNPOST_TRACING_ONLY
+// Nothing gets printed, so there is no reason to format the signposts of non dynamic logs.
+#define O2_DECLARE_LOG(name, category) static _o2_log_t* private_o2_log_##name = (_o2_log_t*)_o2_log_create("ch.cern.aliceo2." #name, 0)
+#define O2_LOG_DEBUG(log, ...)
+#else
 #define O2_DECLARE_LOG(name, category) static _o2_log_t* private_o2_log_##name = (_o2_log_t*)_o2_log_create("ch.cern.aliceo2." #name, 1)
-#define O2_LOG_ENABLE_DYNAMIC(log) _o2_log_set_stacktrace(private_o2_log_##log, 1)
-// We print out only the first 64 frames.
-#define O2_LOG_ENABLE_STACKTRACE(log) _o2_log_set_stacktrace(private_o2_log_##log, 64)
 // For the moment we simply use LOG DEBUG. We should have proper activities so that we can
 // turn on and off the printing.
 #define O2_LOG_DEBUG(log, ...) O2_LOG_MACRO(__VA_ARGS__)
+#endif
+#define O2_LOG_ENABLE_DYNAMIC(log) _o2_log_set_stacktrace(private_o2_log_##log, 1)
+// We print out only the first 64 frames.
+#define O2_LOG_ENABLE_STACKTRACE(log) _o2_log_set_stacktrace(private_o2_log_##log, 64)
+// Record the signposts of the log in the trace buffers.
+#define O2_LOG_ENABLE_TRACING(log) _o2_log_set_tracing(private_o2_log_##log, true)
 #define O2_SIGNPOST_ID_FROM_POINTER(name, log, pointer) _o2_signpost_id_t name = _o2_signpost_id_make_with_pointer(private_o2_log_##log, pointer)
 #define O2_SIGNPOST_ID_GENERATE(name, log) _o2_signpost_id_t name = _o2_signpost_id_generate_local(private_o2_log_##log)
+#ifdef O2_SIGNPOST_TRACING_ONLY
+// Only the logs being traced have something to do, so that a signpost costs a single flag check
+// until tracing is enabled at runtime.
+#define O2_SIGNPOST_TRACED(log, call)                                    \
+  do {                                                                   \
+    if (private_o2_log_##log->tracing.load(std::memory_order_relaxed)) { \
+      call;                                                              \
+    }                                                                    \
+  } while (0)
+#define O2_SIGNPOST_EVENT_EMIT(log, id, name, ...) O2_SIGNPOST_TRACED(log, _o2_signpost_event_emit(private_o2_log_##log, id, name, __VA_ARGS__))
+#define O2_SIGNPOST_START(log, id, name, ...) O2_SIGNPOST_TRACED(log, _o2_signpost_interval_begin(private_o2_log_##log, id, name, __VA_ARGS__))
+#define O2_SIGNPOST_END(log, id, name, ...) O2_SIGNPOST_TRACED(log, _o2_signpost_interval_end(private_o2_log_##log, id, name, __VA_ARGS__))
+#else
 #define O2_SIGNPOST_EVENT_EMIT(log, id, name, ...) _o2_signpost_event_emit(private_o2_log_##log, id, name, __VA_ARGS__)
 #define O2_SIGNPOST_START(log, id, name, ...) _o2_signpost_interval_begin(private_o2_log_##log, id, name, __VA_ARGS__)
 #define O2_SIGNPOST_END(log, id, name, ...) _o2_signpost_interval_end(private_o2_log_##log, id, name, __VA_ARGS__)
+#endif
 #define O2_ENG_TYPE(x, what) "%" what
 #else // This is the release implementation, it does nothing.
 #define O2_DECLARE_DYNAMIC_LOG(x)
@@ -475,6 +811,7 @@ void _o2_log_set_stacktrace(_o2_log_t* log, int stacktrace)
 #define O2_DECLARE_LOG(x, category)
 #define O2_LOG_ENABLE_DYNAMIC(log)
 #define O2_LOG_ENABLE_STACKTRACE(log)
+#define O2_LOG_ENABLE_TRACING(log)
 #define O2_LOG_DEBUG(log, ...)
 #define O2_SIGNPOST_ID_FROM_POINTER(name, log, pointer)
 #define O2_SIGNPOST_ID_GENERATE(name, log)
@@ -10,7 +10,9 @@
 // or submit itself to any jurisdiction.
 
 #include "Framework/Signpost.h"
+#include <atomic>
 #include <iostream>
+#include <thread>
 
 int main(int argc, char** argv)
 {
@@ -49,4 +51,37 @@ int main(int argc, char** argv)
   O2_SIGNPOST_START(test_SignpostDynamic, id, "Test category", "This is dynamic signpost which you will see, because we turned them on");
   O2_SIGNPOST_END(test_SignpostDynamic, id, "Test category", "This is dynamic signpost which you will see, because we turned them on");
 #endif
+
+#ifdef O2_SIGNPOST_HAS_TRACING
+  // Record the signposts in the trace buffers and dump them as Chrome trace JSON
+  O2_LOG_ENABLE_TRACING(test_SignpostDynamic);
+  O2_SIGNPOST_ID_GENERATE(id5, test_SignpostDynamic);
+  O2_SIGNPOST_START(test_SignpostDynamic, id5, "Traced interval", "An interval with a \"quoted\" message %d", 5);
+  O2_SIGNPOST_EVENT_EMIT(test_SignpostDynamic, id5, "Traced event", "An event in a traced interval");
+  O2_SIGNPOST_END(test_SignpostDynamic, id5, "Traced interval", "End of the traced interval");
+  std::cout << "Trace: " << std::endl;
+  o2_signpost_trace_dump(stdout, 0);
+
+  // A thread keeps recording while we dump, the buffer of a thread which is gone is freed
+  std::atomic<bool> stop = false;
+  std::thread recorder([&stop]() {
+    O2_SIGNPOST_ID_GENERATE(tid, test_SignpostDynamic);
+    while (!stop) {
+      O2_SIGNPOST_EVENT_EMIT(test_SignpostDynamic, tid, "Recorder", "Event from another thread");
+    }
+  });
+  FILE* devnull = fopen("/dev/null", "w");
+  for (int i = 0; i < 100; ++i) {
+    o2_signpost_trace_dump(devnull, 0);
+  }
+  stop = true;
+  recorder.join();
+  auto count = o2_signpost_trace_dump(devnull, 0);
+  fclose(devnull);
+  if (count != 3) {
+    std::cerr << "Expected only the 3 events of the main thread after the recorder exited, found " << count << std::endl;
+    return 1;
+  }
+  o2_log_set_tracing("test_SignpostDynamic", false);
+#endif
 }
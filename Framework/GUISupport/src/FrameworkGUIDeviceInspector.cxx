@@ -426,6 +426,23 @@ void displayDeviceInspector(DeviceSpec const& spec,
       control.controller->write(cmd.c_str(), cmd.size());
     }
   }
+
+  if (control.controller && ImGui::CollapsingHeader("Signposts tracing")) {
+    ImGui::InputText("Log", control.signpostLog, MAX_USER_FILTER_SIZE);
+    if (ImGui::Button("Enable") && control.signpostLog[0]) {
+      std::string cmd = fmt::format("/signpost-trace {} 1", control.signpostLog);
+      control.controller->write(cmd.c_str(), cmd.size());
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Disable") && control.signpostLog[0]) {
+      std::string cmd = fmt::format("/signpost-trace {} 0", control.signpostLog);
+      control.controller->write(cmd.c_str(), cmd.size());
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Dump last 10s")) {
+      control.controller->write("/signpost-dump 10", strlen("/signpost-dump 10"));
+    }
+  }
 }
 
 } // namespace o2::framework::gui
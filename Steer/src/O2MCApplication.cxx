@@ -1274,7 +1274,7 @@ void O2MCApplication::attachSubEventInfo(fair::mq::Parts& parts, o2::data::SubEv
   o2::base::attachTMessage(info, *mSimDataChannel, parts);
 }
 
-// helper function to fetch data from FairRootManager branch and serialize it
+// helper function to fetch data from FairRootManager branch and attach it (flat or serialized)
 // returns handle to container
 template <typename T>
 const T* attachBranch(std::string const& name, fair::mq::Channel& channel, fair::mq::Parts& parts)
@@ -1287,7 +1287,7 @@ const T* attachBranch(std::string const& name, fair::mq::Channel& channel, fair:
   }
   auto data = mgr->InitObjectAs<const T*>(name.c_str());
   if (data) {
-    o2::base::attachTMessage(*data, channel, parts);
+    o2::base::attachData(*data, channel, parts);
   }
   return data;
 }
@@ -77,6 +77,8 @@
 #endif
 
 #include <tbb/concurrent_unordered_map.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
 
 namespace o2
 {
@@ -119,6 +121,13 @@ class O2HitMerger : public fair::mq::Device
     mTimer.Continue();
     LOG(info) << "MEM-STAMP " << sysinfo.GetCurrentMemory() / (1024. * 1024) << " "
               << sysinfo.GetMaxMemory() << " MB\n";
+    if (mNCompleteEvents > 0) {
+      // the fraction of the time spent receiving data from the workers: the merger
+      // keeps up with about (number of workers / busy fraction) workers
+      LOG(info) << "SIMDATA-STAMP " << mNCompleteEvents << " events, " << mSimDataBytes / (1024. * 1024) << " MB, CPU per event "
+                << mSimDataCPUTime / mNCompleteEvents << " s, busy fraction " << mSimDataRealTime / mTimer.RealTime();
+      mTimer.Continue();
+    }
   }
 
  private:
@@ -162,6 +171,12 @@ class O2HitMerger : public fair::mq::Device
       LOG(warning) << "DID NOT FIND ENVIRONMENT VARIABLE TO INIT PIPE";
     }
 
+    // number of threads used to merge and flush the outputs of the detectors (by default as many as cores)
+    if (auto nthreadsenv = getenv("ALICE_O2SIMMERGER_NTHREADS")) {
+      mMergerArena.initialize(std::max(1, atoi(nthreadsenv)));
+      LOG(info) << "MERGING WITH " << mMergerArena.max_concurrency() << " THREADS";
+    }
+
     // if no data to expect we shut down the device NOW since it would otherwise hang
     if (mNExpectedEvents == 0) {
       if (mAsService) {
@@ -283,12 +298,12 @@ class O2HitMerger : public fair::mq::Device
   template <typename T, typename BT>
   void consumeData(int eventID, fair::mq::Parts& data, int& index, BT& buffer)
   {
-    auto decodeddata = o2::base::decodeTMessage<T*>(data, index);
+    // flat data stays in its message until the event is flushed
+    auto receiveddata = o2::base::receiveData<T>(data, index);
     if (buffer.find(eventID) == buffer.end()) {
       buffer[eventID] = typename BT::mapped_type();
     }
-    buffer[eventID].push_back(decodeddata);
-    // delete decodeddata; --> we store the pointers
+    buffer[eventID].push_back(std::move(receiveddata));
     index++;
   }
 
@@ -344,7 +359,11 @@ class O2HitMerger : public fair::mq::Device
     TStopwatch timer;
     timer.Start();
     auto more = handleSimData(request, 0);
-    LOG(info) << "HitMerger processing took " << timer.RealTime();
+    timer.Stop();
+    mSimDataRealTime += timer.RealTime();
+    mSimDataCPUTime += timer.CpuTime();
+    mSimDataBytes += bytes;
+    LOG(info) << "HitMerger processing took " << timer.RealTime() << " (CPU " << timer.CpuTime() << ") for " << bytes / (1024. * 1024) << " MB";
     if (!more && mAsService) {
       LOG(info) << " CONTROL ";
       // if we are done treating data we may go back to init phase
@@ -374,6 +393,7 @@ class O2HitMerger : public fair::mq::Device
     if (isDataComplete<uint32_t>(accum, info.nparts)) {
       LOG(info) << "Event " << info.eventID << " complete. Marking as flushable";
       mFlushableEvents[info.eventID] = true;
+      mNCompleteEvents++;
 
       // check if previous flush finished
       // start merging only when no merging currently happening
@@ -495,7 +515,7 @@ class O2HitMerger : public fair::mq::Device
     }
     //
     // write to output
-    auto filladdr = (entries > 1) ? targetdata.get() : vectorOfSubEventMCTracks[0];
+    auto filladdr = (entries > 1) ? targetdata.get() : o2::base::asContainer<std::vector<MCTrack>>(*vectorOfSubEventMCTracks[0], *targetdata);
 
     // we give the possibility to produce some MC track statistics
     // to be saved as part of the MCHeader structure
@@ -525,9 +545,7 @@ class O2HitMerger : public fair::mq::Device
     }
 
     // cleanup buffered data
-    for (auto ptr : vectorOfSubEventMCTracks) {
-      delete ptr; // avoid this by using unique ptr
-    }
+    vectorOfSubEventMCTracks.clear();
   }
 
   template <typename T, typename M>
@@ -539,16 +557,15 @@ class O2HitMerger : public fair::mq::Device
     // The offset calculated as the sum of the number of entries in the particle list of the previous subevents.
     // This method is called by O2HitMerger::mergeAndFlushData(int)
     //
-    T* incomingdata = nullptr;
-    std::unique_ptr<T> targetdata(nullptr);
+    auto targetdata = std::make_unique<T>();
+    T* dataaddr = targetdata.get();
     auto& vectorOfT = mapOfVectorOfTs[eventID];
     const auto entries = vectorOfT.size();
 
     if (entries == 1) {
       // nothing to do in case there is only one entry
-      incomingdata = vectorOfT[0];
+      dataaddr = o2::base::asContainer<T>(*vectorOfT[0], *targetdata);
     } else {
-      targetdata = std::make_unique<T>();
       // loop over subevents
       Int_t nprimTot = 0;
       for (int entry = 0; entry < entries; entry++) {
@@ -559,9 +576,9 @@ class O2HitMerger : public fair::mq::Device
       for (int entry = entries - 1; entry >= 0; --entry) {
         Int_t index = subevOrdered[entry];
         Int_t nprim = nprimaries[index];
-        incomingdata = vectorOfT[index];
+        auto& incomingdata = *vectorOfT[index];
         idelta1 -= nprim;
-        for (auto& data : *incomingdata) {
+        for (auto& data : incomingdata) {
           updateTrackIdWithOffset(data, nprim, idelta0, idelta1);
           targetdata->push_back(data);
         }
@@ -569,16 +586,13 @@ class O2HitMerger : public fair::mq::Device
         idelta1 += trackoffsets[index];
       }
     }
-    auto dataaddr = (entries == 1) ? incomingdata : targetdata.get();
     auto targetbr = o2::base::getOrMakeBranch(target, brname.c_str(), &dataaddr);
     targetbr->SetAddress(&dataaddr);
     targetbr->Fill();
     targetbr->ResetAddress();
 
     // cleanup mem
-    for (auto ptr : vectorOfT) {
-      delete ptr; // avoid this by using unique ptr
-    }
+    vectorOfT.clear();
   }
 
   void updateTrackIdWithOffset(MCTrack& track, Int_t nprim, Int_t idelta0, Int_t idelta1)
@@ -616,182 +630,192 @@ class O2HitMerger : public fair::mq::Device
     }
   }
 
-  // This method goes over the buffers containing data for a given event; potentially merges
-  // them and flushes into the actual output file.
-  // The method can be called asynchronously to data collection
-  bool mergeAndFlushData()
-  {
-    auto checkIfNextFlushable = [this]() -> bool {
-      mNextFlushID++;
-      return mFlushableEvents.find(mNextFlushID) != mFlushableEvents.end() && mFlushableEvents[mNextFlushID] == true;
-    };
+  /// information needed to merge the sub-events of one event
+  struct EventToMerge {
+    int eventID = -1;
+    std::vector<int> trackoffsets; // trackoffsets (per data arrival id) to be used for global track-ID correction pass
+    std::vector<int> nprimaries;   // primary particles in each subevent (data arrival id)
+    std::vector<int> subevOrdered; // data arrival id of each sub-event (or part)
+    o2::dataformats::MCEventHeader* eventheader = nullptr;
+  };
 
-    LOG(info) << "Launching merge kernel ";
-    bool canflush = mFlushableEvents.find(mNextFlushID) != mFlushableEvents.end() && mFlushableEvents[mNextFlushID] == true;
-    if (!canflush) {
-      return false;
-    }
-    while (canflush == true) {
-      auto flusheventID = mNextFlushID;
-      LOG(info) << "Merge and flush event " << flusheventID;
+  // collects all events which can be flushed now, in the order in which they have to be written
+  std::vector<EventToMerge> collectFlushableEvents()
+  {
+    std::vector<EventToMerge> events;
+    auto& confref = o2::conf::SimConfig::Instance();
+    while (mFlushableEvents.find(mNextFlushID) != mFlushableEvents.end() && mFlushableEvents[mNextFlushID] == true) {
+      auto flusheventID = mNextFlushID++;
       auto iter = mSubEventInfoBuffer.find(flusheventID);
       if (iter == mSubEventInfoBuffer.end()) {
         LOG(error) << "No info/data found for event " << flusheventID;
-        if (!checkIfNextFlushable()) {
-          return false;
-        }
+        continue;
       }
-
       auto& subEventInfoList = (*iter).second;
       if (subEventInfoList.size() == 0 || mNExpectedEvents == 0) {
         LOG(error) << "No data entries found for event " << flusheventID;
-        if (!checkIfNextFlushable()) {
-          return false;
-        }
+        continue;
       }
 
-      TStopwatch timer;
-      timer.Start();
-
-      // calculate trackoffsets
-      auto& confref = o2::conf::SimConfig::Instance();
-
-      // collecting trackoffsets (per data arrival id) to be used for global track-ID correction pass
-      std::vector<int> trackoffsets;
-      // collecting primary particles in each subevent (data arrival id)
-      std::vector<int> nprimaries;
+      EventToMerge event;
+      event.eventID = flusheventID;
       // mapping of id to actual sub-event id (or part)
       std::vector<int> nsubevents;
-
-      o2::dataformats::MCEventHeader* eventheader = nullptr; // The event header
-
-      // the MC labels (trackID) for hits
       for (auto info : subEventInfoList) {
         assert(info->npersistenttracks >= 0);
-        trackoffsets.emplace_back(info->npersistenttracks);
-        nprimaries.emplace_back(info->nprimarytracks);
+        event.trackoffsets.emplace_back(info->npersistenttracks);
+        event.nprimaries.emplace_back(info->nprimarytracks);
         nsubevents.emplace_back(info->part);
-        if (eventheader == nullptr) {
-          eventheader = &info->mMCEventHeader;
+        if (event.eventheader == nullptr) {
+          event.eventheader = &info->mMCEventHeader;
         } else {
-          eventheader->getMCEventStats().add(info->mMCEventHeader.getMCEventStats());
+          event.eventheader->getMCEventStats().add(info->mMCEventHeader.getMCEventStats());
         }
       }
 
       // now see which events can be discarded in any case due to no hits
       if (confref.isFilterOutNoHitEvents()) {
-        if (eventheader && eventheader->getMCEventStats().getNHits() == 0) {
+        if (event.eventheader && event.eventheader->getMCEventStats().getNHits() == 0) {
           LOG(info) << " Taking out event " << flusheventID << " due to no hits ";
           cleanEvent(flusheventID);
-          if (!checkIfNextFlushable()) {
-            return true;
-          }
+          continue;
         }
       }
 
-      // attention: We need to make sure that we write everything in the same event order
-      // but iteration over keys of a standard map in C++ is ordered
-
-      // b) merge the general data
-      //
-      // for MCTrack remap the motherIds and merge at the same go
       const auto entries = subEventInfoList.size();
-      std::vector<int> subevOrdered((int)(nsubevents.size()));
+      event.subevOrdered.resize(nsubevents.size());
       for (int entry = entries - 1; entry >= 0; --entry) {
-        subevOrdered[nsubevents[entry] - 1] = entry;
-        printf("HitMerger entry: %d nprimry: %5d trackoffset: %5d \n", entry, nprimaries[entry], trackoffsets[entry]);
+        event.subevOrdered[nsubevents[entry] - 1] = entry;
+        printf("HitMerger entry: %d nprimry: %5d trackoffset: %5d \n", entry, event.nprimaries[entry], event.trackoffsets[entry]);
       }
+      events.emplace_back(std::move(event));
+    }
+    return events;
+  }
 
-      // This is a hook that collects some useful statistics/properties on the event
-      // for use by other components;
-      // Properties are attached making use of the extensible "Info" feature which is already
-      // part of MCEventHeader. In such a way, one can also do this pass outside and attach arbitrary
-      // metadata to MCEventHeader without needing to change the data layout or API of the class itself.
-      // NOTE: This function might also be called directly in the primary server!?
-      auto mcheaderhook = [eventheader](std::vector<MCTrack> const& tracks) {
-        int eta1Point2Counter = 0;
-        int eta1Point0Counter = 0;
-        int eta0Point8Counter = 0;
-        int eta1Point2CounterPi = 0;
-        int eta1Point0CounterPi = 0;
-        int eta0Point8CounterPi = 0;
-        int prims = 0;
-        for (auto& tr : tracks) {
-          if (tr.isPrimary()) {
-            prims++;
-            const auto eta = tr.GetEta();
-            if (eta < 1.2) {
-              eta1Point2Counter++;
-              if (std::abs(tr.GetPdgCode()) == 211) {
-                eta1Point2CounterPi++;
-              }
+  // merges the kinematics, track references and event header of an event into the kinematics tree
+  void mergeAndFlushKinematics(EventToMerge const& event)
+  {
+    auto eventheader = event.eventheader;
+    // This is a hook that collects some useful statistics/properties on the event
+    // for use by other components;
+    // Properties are attached making use of the extensible "Info" feature which is already
+    // part of MCEventHeader. In such a way, one can also do this pass outside and attach arbitrary
+    // metadata to MCEventHeader without needing to change the data layout or API of the class itself.
+    // NOTE: This function might also be called directly in the primary server!?
+    auto mcheaderhook = [eventheader](std::vector<MCTrack> const& tracks) {
+      int eta1Point2Counter = 0;
+      int eta1Point0Counter = 0;
+      int eta0Point8Counter = 0;
+      int eta1Point2CounterPi = 0;
+      int eta1Point0CounterPi = 0;
+      int eta0Point8CounterPi = 0;
+      int prims = 0;
+      for (auto& tr : tracks) {
+        if (tr.isPrimary()) {
+          prims++;
+          const auto eta = tr.GetEta();
+          if (eta < 1.2) {
+            eta1Point2Counter++;
+            if (std::abs(tr.GetPdgCode()) == 211) {
+              eta1Point2CounterPi++;
             }
-            if (eta < 1.0) {
-              eta1Point0Counter++;
-              if (std::abs(tr.GetPdgCode()) == 211) {
-                eta1Point0CounterPi++;
-              }
+          }
+          if (eta < 1.0) {
+            eta1Point0Counter++;
+            if (std::abs(tr.GetPdgCode()) == 211) {
+              eta1Point0CounterPi++;
             }
-            if (eta < 0.8) {
-              eta0Point8Counter++;
-              if (std::abs(tr.GetPdgCode()) == 211) {
-                eta0Point8CounterPi++;
-              }
+          }
+          if (eta < 0.8) {
+            eta0Point8Counter++;
+            if (std::abs(tr.GetPdgCode()) == 211) {
+              eta0Point8CounterPi++;
             }
-          } else {
-            break; // track layout is such that all prims are first anyway
           }
+        } else {
+          break; // track layout is such that all prims are first anyway
         }
-        // attach these properties to eventheader
-        // we only need to make the names standard
-        eventheader->putInfo("prims_eta_1.2", eta1Point2Counter);
-        eventheader->putInfo("prims_eta_1.0", eta1Point0Counter);
-        eventheader->putInfo("prims_eta_0.8", eta0Point8Counter);
-        eventheader->putInfo("prims_eta_1.2_pi", eta1Point2CounterPi);
-        eventheader->putInfo("prims_eta_1.0_pi", eta1Point0CounterPi);
-        eventheader->putInfo("prims_eta_0.8_pi", eta0Point8CounterPi);
-        eventheader->putInfo("prims_total", prims);
-      };
-
-      reorderAndMergeMCTracks(flusheventID, mOutTree, nprimaries, subevOrdered, mcheaderhook, eventheader);
-
-      if (mOutTree) {
-        // adjusting and merging track references
-        remapTrackIdsAndMerge<std::vector<o2::TrackReference>>("TrackRefs", flusheventID, *mOutTree, trackoffsets, nprimaries, subevOrdered, mTrackRefBuffer);
-
-        // write MC event headers
-        auto headerbr = o2::base::getOrMakeBranch(*mOutTree, "MCEventHeader.", &eventheader);
-        headerbr->SetAddress(&eventheader);
-        headerbr->Fill();
-        headerbr->ResetAddress();
       }
+      // attach these properties to eventheader
+      // we only need to make the names standard
+      eventheader->putInfo("prims_eta_1.2", eta1Point2Counter);
+      eventheader->putInfo("prims_eta_1.0", eta1Point0Counter);
+      eventheader->putInfo("prims_eta_0.8", eta0Point8Counter);
+      eventheader->putInfo("prims_eta_1.2_pi", eta1Point2CounterPi);
+      eventheader->putInfo("prims_eta_1.0_pi", eta1Point0CounterPi);
+      eventheader->putInfo("prims_eta_0.8_pi", eta0Point8CounterPi);
+      eventheader->putInfo("prims_total", prims);
+    };
 
-      // c) do the merge procedure for all hits ... delegate this to detector specific functions
-      // since they know about types; number of branches; etc.
-      // this will also fix the trackIDs inside the hits
-      for (int id = 0; id < mDetectorInstances.size(); ++id) {
-        auto& det = mDetectorInstances[id];
-        if (det) {
+    // for MCTrack remap the motherIds and merge at the same go
+    reorderAndMergeMCTracks(event.eventID, mOutTree, event.nprimaries, event.subevOrdered, mcheaderhook, eventheader);
+
+    if (mOutTree) {
+      // adjusting and merging track references
+      remapTrackIdsAndMerge<std::vector<o2::TrackReference>>("TrackRefs", event.eventID, *mOutTree, event.trackoffsets, event.nprimaries, event.subevOrdered, mTrackRefBuffer);
+
+      // write MC event headers
+      auto headerbr = o2::base::getOrMakeBranch(*mOutTree, "MCEventHeader.", &eventheader);
+      headerbr->SetAddress(&eventheader);
+      headerbr->Fill();
+      headerbr->ResetAddress();
+
+      // increase the entry count in the tree
+      mOutTree->SetEntries(mOutTree->GetEntries() + 1);
+    }
+  }
+
+  // This method goes over the buffers containing data for the events which arrived completely; merges
+  // them and flushes into the actual output files.
+  // The method can be called asynchronously to data collection.
+  // The kinematics and every detector have their own output tree, which are filled concurrently by one
+  // task each. Every task goes through the events in order, so while a slow detector is still writing
+  // event N, the others already merge event N+1.
+  bool mergeAndFlushData()
+  {
+    LOG(info) << "Launching merge kernel ";
+    auto events = collectFlushableEvents();
+    if (events.empty()) {
+      return false;
+    }
+    while (!events.empty()) {
+      TStopwatch timer;
+      timer.Start();
+      LOG(info) << "Merge and flush events " << events.front().eventID << " to " << events.back().eventID;
+
+      mMergerArena.execute([this, &events]() {
+        tbb::task_group tasks;
+        tasks.run([this, &events]() {
+          for (auto& event : events) {
+            mergeAndFlushKinematics(event);
+          }
+        });
+        // do the merge procedure for all hits ... delegate this to detector specific functions
+        // since they know about types; number of branches; etc.
+        // this will also fix the trackIDs inside the hits
+        for (int id = 0; id < mDetectorInstances.size(); ++id) {
+          auto det = mDetectorInstances[id].get();
           auto hittree = mDetectorToTTreeMap[id];
-          if (hittree) {
-            det->mergeHitEntriesAndFlush(flusheventID, *hittree, trackoffsets, nprimaries, subevOrdered);
-            hittree->SetEntries(hittree->GetEntries() + 1);
-            LOG(info) << "flushing tree to file " << hittree->GetDirectory()->GetFile()->GetName();
+          if (det && hittree) {
+            tasks.run([det, hittree, &events]() {
+              for (auto& event : events) {
+                det->mergeHitEntriesAndFlush(event.eventID, *hittree, event.trackoffsets, event.nprimaries, event.subevOrdered);
+                hittree->SetEntries(hittree->GetEntries() + 1);
+              }
+            });
           }
         }
-      }
+        tasks.wait();
+      });
 
-      // increase the entry count in the tree
-      if (mOutTree) {
-        mOutTree->SetEntries(mOutTree->GetEntries() + 1);
-        LOG(info) << "outtree has file " << mOutTree->GetDirectory()->GetFile()->GetName();
-      }
-      cleanEvent(flusheventID);
-      LOG(info) << "Merge/flush for event " << flusheventID << " took " << timer.RealTime();
-      if (!checkIfNextFlushable()) {
-        break;
+      for (auto& event : events) {
+        cleanEvent(event.eventID);
       }
-    } // end while
+      LOG(info) << "Merge/flush for " << events.size() << " events took " << timer.RealTime();
+      // pick up the events which arrived in the meantime
+      events = collectFlushableEvents();
+    }
     if (mWriteToDisc && mOutFile) {
       LOG(info) << "Writing TTrees";
       mOutFile->Write("", TObject::kOverwrite);
@@ -820,9 +844,10 @@ class O2HitMerger : public fair::mq::Device
   // intermediate structures to collect data per event
   std::thread mMergerIOThread; //! a thread used to do hit merging and IO flushing asynchronously
   bool mergingInProgress = false;
+  tbb::task_arena mMergerArena; //! threads merging the kinematics and the hits of the detectors in parallel
 
-  Hashtable<int, std::vector<std::vector<o2::MCTrack>*>> mMCTrackBuffer;         //! vector of sub-event track vectors; one per event
-  Hashtable<int, std::vector<std::vector<o2::TrackReference>*>> mTrackRefBuffer; //!
+  Hashtable<int, std::vector<std::unique_ptr<o2::base::ReceivedData_t<std::vector<o2::MCTrack>>>>> mMCTrackBuffer;         //! vector of sub-event track vectors; one per event
+  Hashtable<int, std::vector<std::unique_ptr<o2::base::ReceivedData_t<std::vector<o2::TrackReference>>>>> mTrackRefBuffer; //!
   Hashtable<int, std::list<o2::data::SubEventInfo*>> mSubEventInfoBuffer;
   Hashtable<int, bool> mFlushableEvents; //! collection of events which have completely arrived
 
@@ -830,6 +855,10 @@ class O2HitMerger : public fair::mq::Device
   int mNExpectedEvents = 0; //! number of events that we expect to receive
   int mNextFlushID = 1;     //! EventID to be flushed next
   TStopwatch mTimer;
+  double mSimDataRealTime = 0.; //! time spent in receiving and decoding the data from the workers
+  double mSimDataCPUTime = 0.;  //! CPU time of the same
+  double mSimDataBytes = 0.;    //! amount of data received from the workers
+  int mNCompleteEvents = 0;     //! number of events received completely
 
   bool mAsService = false;  //! if run in deamonized mode
   bool mForwardKine = true; //! if we forward kinematics (tracks, eventheaders) on some output channel
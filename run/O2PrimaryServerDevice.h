@@ -40,6 +40,9 @@
 #include <fstream>
 #include <iostream>
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include "PrimaryServerState.h"
 #include "SimPublishChannelHelper.h"
 #include <chrono>
@@ -60,12 +63,17 @@ class O2PrimaryServerDevice final : public fair::mq::Device
     if (mUseFixedChunkSeed) {
       mFixedChunkSeed = atol(getenv("ALICEO2_O2SIM_SUBEVENTSEED"));
     }
+    // number of events generated ahead of the one being served
+    if (getenv("ALICEO2_O2SIM_GENERATORLOOKAHEAD")) {
+      mLookahead = std::max(1, atoi(getenv("ALICEO2_O2SIM_GENERATORLOOKAHEAD")));
+    }
   }
 
   /// Default destructor
   ~O2PrimaryServerDevice() final
   {
     try {
+      stopGeneration();
       if (mGeneratorThread.joinable()) {
         mGeneratorThread.join();
       }
@@ -156,19 +164,12 @@ class O2PrimaryServerDevice final : public fair::mq::Device
     }
 
     LOG(info) << "Generator initialization took " << timer.CpuTime() << "s";
-    if (mMaxEvents > 0) {
-      generateEvent(); // generate a first event
-    }
   }
 
-  // function generating one event
-  void generateEvent(/*bool changeState = false*/)
+  // function generating one event into mStack and mEventHeader
+  void generateEvent(int eventIndex)
   {
-    bool changeState = true; // false;
     LOG(info) << "Event generation started ";
-    if (changeState) {
-      stateTransition(O2PrimaryServerState::WaitingEvent, "GENEVENT");
-    }
     TStopwatch timer;
     timer.Start();
     try {
@@ -181,9 +182,9 @@ class O2PrimaryServerDevice final : public fair::mq::Device
         if (mCollissionContext) {
           const auto& vertices = mCollissionContext->getInteractionVertices();
           if (vertices.size() > 0) {
-            auto collisionindex = mEventID_to_CollID.at(mEventCounter);
+            auto collisionindex = mEventID_to_CollID.at(eventIndex);
             auto& vertex = vertices.at(collisionindex);
-            LOG(info) << "Setting vertex " << vertex << " for event " << mEventCounter << " for prefix " << mSimConfig.getOutPrefix();
+            LOG(info) << "Setting vertex " << vertex << " for event " << eventIndex << " for prefix " << mSimConfig.getOutPrefix();
             mPrimGen->setExternalVertexForNextEvent(vertex.X(), vertex.Y(), vertex.Z());
           }
         }
@@ -205,9 +206,101 @@ class O2PrimaryServerDevice final : public fair::mq::Device
     timer.Stop();
     LOG(info) << "Event generation took " << timer.CpuTime() << "s"
               << " and produced " << mStack->getPrimaries().size() << " primaries ";
-    if (changeState) {
-      stateTransition(O2PrimaryServerState::ReadyToServe, "GENEVENT");
+  }
+
+  // generates all events of the batch, in order, keeping up to mLookahead of them ready to be served.
+  // Events are generated one after the other by the same generator instance, so the sequence
+  // of events does not depend on the lookahead or on how fast the workers ask for them.
+  void generateEvents()
+  {
+    for (int eventIndex = 0; eventIndex < mMaxEvents; ++eventIndex) {
+      {
+        std::unique_lock<std::mutex> lock(mEventQueueMutex);
+        if (mEventQueue.size() >= mLookahead) {
+          auto start = std::chrono::steady_clock::now();
+          mEventQueueCondition.wait(lock, [this]() { return mEventQueue.size() < mLookahead || mStopGeneration; });
+          mGeneratorWaitTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+        if (mStopGeneration) {
+          break;
+        }
+        if (mEventQueue.empty()) {
+          stateTransition(O2PrimaryServerState::WaitingEvent, "GENEVENT");
+        }
+      }
+      generateEvent(eventIndex);
+      {
+        std::lock_guard<std::mutex> lock(mEventQueueMutex);
+        mEventQueue.push_back(GeneratedEvent{mStack->getPrimaries(), mEventHeader});
+        LOG(info) << "Event " << eventIndex + 1 << " generated, " << mEventQueue.size() << " events ready to be served";
+      }
+      mEventQueueCondition.notify_all();
+      auto state = mState.load();
+      if (state == O2PrimaryServerState::WaitingEvent || state == O2PrimaryServerState::Initializing) {
+        stateTransition(O2PrimaryServerState::ReadyToServe, "GENEVENT");
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(mEventQueueMutex);
+      mGenerationDone = true;
+    }
+    mEventQueueCondition.notify_all();
+  }
+
+  // starts the generation of the events of a new batch
+  void startGeneration()
+  {
+    stopGeneration();
+    {
+      std::lock_guard<std::mutex> lock(mEventQueueMutex);
+      mEventQueue.clear();
+      mStopGeneration = false;
+      mGenerationDone = mMaxEvents <= 0;
+    }
+    if (mMaxEvents > 0) {
+      mGeneratorThread = std::thread(&O2PrimaryServerDevice::generateEvents, this);
+    }
+  }
+
+  // interrupts the generation of events, after the one being generated
+  void stopGeneration()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mEventQueueMutex);
+      mStopGeneration = true;
+    }
+    mEventQueueCondition.notify_all();
+    if (mGeneratorThread.joinable()) {
+      try {
+        mGeneratorThread.join();
+      } catch (std::exception const& e) {
+        LOG(warn) << "Exception during thread join ..ignoring";
+      }
+    }
+  }
+
+  // takes the next event from the queue of generated events, waits for it if needed;
+  // returns false if the generation was stopped or has finished without providing one
+  bool takeNextEvent()
+  {
+    {
+      std::unique_lock<std::mutex> lock(mEventQueueMutex);
+      if (mEventQueue.empty()) {
+        LOG(info) << "Waiting for event generation do become fully available";
+        auto start = std::chrono::steady_clock::now();
+        mEventQueueCondition.wait(lock, [this]() { return !mEventQueue.empty() || mStopGeneration || mGenerationDone; });
+        mServerWaitTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      }
+      if (mEventQueue.empty()) {
+        LOG(warn) << "No generated event available to be served";
+        return false;
+      }
+      mCurrentEvent = std::move(mEventQueue.front());
+      mEventQueue.pop_front();
+      LOG(info) << "Serving next event, " << mEventQueue.size() << " more events ready to be served";
     }
+    mEventQueueCondition.notify_all();
+    return true;
   }
 
   // launches a thread that listens for status requests from outside asynchronously
@@ -309,6 +402,8 @@ class O2PrimaryServerDevice final : public fair::mq::Device
         LOG(warn) << "Exception during thread join ..ignoring";
       }
     }
+    LOG(info) << "GENERATOR LOOKAHEAD SET TO " << mLookahead << " EVENTS";
+    startGeneration();
 
     // init pipe
     auto pipeenv = getenv("ALICE_O2SIMSERVERTODRIVER_PIPE");
@@ -355,6 +450,10 @@ class O2PrimaryServerDevice final : public fair::mq::Device
       return false;
     }
 
+    // the generator thread uses the seed, the number of events and the generator configuration,
+    // so it is stopped before any of them is changed
+    stopGeneration();
+
     // mSimConfig.getConfigData().mKeyValueTokens=reconfig.keyValueTokens;
     // Think about this:
     // update the parameters from an INI/JSON file, if given (overrides code-based version)
@@ -378,16 +477,9 @@ class O2PrimaryServerDevice final : public fair::mq::Device
     mEventCounter = 0;
     mPartCounter = 0;
     mNeedNewEvent = true;
-    // reinit generator and start generation of a new event
-    if (mGeneratorThread.joinable()) {
-      try {
-        mGeneratorThread.join();
-      } catch (std::exception const& e) {
-        LOG(warn) << "Exception during thread join ..ignoring";
-      }
-    }
-    // mGeneratorThread = std::thread(&O2PrimaryServerDevice::initGenerator, this);
+    // reinit generator and start generation of the new events
     initGenerator();
+    startGeneration();
 
     return true;
   }
@@ -470,6 +562,9 @@ class O2PrimaryServerDevice final : public fair::mq::Device
       using namespace std::chrono_literals;
       std::this_thread::sleep_for(100ms);
     }
+    // time the workers waited for events to be generated and time the generator waited for them to be served
+    LOG(info) << "GENERATOR-STAMP lookahead " << mLookahead << " events, server waiting for events " << mServerWaitTime
+              << " s, generator waiting for free slots " << mGeneratorWaitTime << " s";
   }
 
   bool HandleRequest(fair::mq::MessagePtr& request, int /*index*/, fair::mq::Channel& channel)
@@ -486,6 +581,17 @@ class O2PrimaryServerDevice final : public fair::mq::Device
       workavailable = false;
     }
 
+    if (workavailable && mNeedNewEvent) {
+      // we need a newly generated event now
+      if (takeNextEvent()) {
+        mNeedNewEvent = false;
+        mPartCounter = 0;
+        mEventCounter++;
+      } else {
+        workavailable = false;
+      }
+    }
+
     PrimaryChunkAnswer header{mState, workavailable};
     fair::mq::Parts reply;
     std::unique_ptr<fair::mq::Message> headermsg(channel.NewSimpleMessage(header));
@@ -493,27 +599,7 @@ class O2PrimaryServerDevice final : public fair::mq::Device
 
     LOG(debug) << "Received request for work " << mEventCounter << " " << mMaxEvents << " " << mNeedNewEvent << " available " << workavailable;
     if (workavailable) {
-
-      if (mNeedNewEvent) {
-        // we need a newly generated event now
-        if (mGeneratorThread.joinable()) {
-          try {
-            mGeneratorThread.join();
-          } catch (std::exception const& e) {
-            LOG(warn) << "Exception during thread join ..ignoring";
-          }
-        }
-        // also if we are still in event waiting stage (doing some busy sleep)
-        while (mState.load() == O2PrimaryServerState::WaitingEvent) {
-          LOG(info) << "Waiting for event generation do become fully available";
-          usleep(100);
-        }
-        mNeedNewEvent = false;
-        mPartCounter = 0;
-        mEventCounter++;
-      }
-
-      auto& prims = mStack->getPrimaries();
+      auto& prims = mCurrentEvent.primaries;
       auto numberofparts = (int)std::ceil(prims.size() / (1. * mChunkGranularity));
       // number of parts should be at least 1 (even if empty)
       numberofparts = std::max(1, numberofparts);
@@ -529,7 +615,7 @@ class O2PrimaryServerDevice final : public fair::mq::Device
 
       i.seed = mUseFixedChunkSeed ? mFixedChunkSeed : mEventCounter + mInitialSeed;
       i.index = m.mParticles.size();
-      i.mMCEventHeader = mEventHeader;
+      i.mMCEventHeader = mCurrentEvent.header;
       m.mSubEventInfo = i;
 
       int endindex = prims.size() - mPartCounter * mChunkGranularity;
@@ -559,10 +645,6 @@ class O2PrimaryServerDevice final : public fair::mq::Device
       mPartCounter++;
       if (mPartCounter == numberofparts) {
         mNeedNewEvent = true;
-        // start generation of a new event
-        if (mEventCounter < mMaxEvents) {
-          mGeneratorThread = std::thread(&O2PrimaryServerDevice::generateEvent, this);
-        }
       }
 
       TMessage* tmsg = new TMessage(kMESS_OBJECT);
@@ -660,6 +742,21 @@ class O2PrimaryServerDevice final : public fair::mq::Device
                                 //  or to generate events
   std::thread mControlThread;   //! a thread used to wait for control commands
 
+  // an event generated ahead of being served to the workers
+  struct GeneratedEvent {
+    std::vector<TParticle> primaries;
+    o2::dataformats::MCEventHeader header;
+  };
+  GeneratedEvent mCurrentEvent;           //! the event currently served to the workers
+  std::deque<GeneratedEvent> mEventQueue; //! events generated and waiting to be served
+  std::mutex mEventQueueMutex;            //! protects mEventQueue, mStopGeneration and mGenerationDone
+  std::condition_variable mEventQueueCondition;
+  size_t mLookahead = 1;          // maximal number of events in mEventQueue
+  bool mStopGeneration = false;   //! asks the generator thread to stop
+  bool mGenerationDone = false;   //! the generator thread has finished, no more events will be queued
+  double mServerWaitTime = 0.;    //! time the server waited for events to be generated
+  double mGeneratorWaitTime = 0.; //! time the generator waited for a free slot in mEventQueue
+
   // Keeps various generators instantiated in memory
   // useful when running simulation as a service (when generators
   // change between batches)
@@ -21,6 +21,8 @@
 #include <fairlogger/Logger.h>
 #include <fairmq/Parts.h>
 #include <fairmq/TransportFactory.h>
+#include <fairmq/ProgOptions.h>
+#include <fairmq/tools/Unique.h>
 #include <TStopwatch.h>
 #include <sys/wait.h>
 #include <pthread.h> // to set cpu affinity
@@ -149,7 +151,8 @@ struct KernelSetup {
   int workerID = -1;
 };
 
-KernelSetup initSim(std::string transport, std::string primaddress, std::string primstatusaddress, std::string mergeraddress, int workerID)
+KernelSetup initSim(std::string transport, std::string primaddress, std::string primstatusaddress, std::string mergeraddress,
+                    std::string mergertransport, std::string session, int workerID)
 {
   auto factory = fair::mq::TransportFactory::CreateTransportFactory(transport);
   auto primchannel = new fair::mq::Channel{"primary-get", "req", factory};
@@ -160,7 +163,12 @@ KernelSetup initSim(std::string transport, std::string primaddress, std::string
   prim_status_channel->Connect(primstatusaddress);
   prim_status_channel->Validate();
 
-  auto datachannel = new fair::mq::Channel{"simdata", "push", factory};
+  // the sim data go to the merger through the transport of its channel (shared memory by default),
+  // in the session of this o2sim instance
+  fair::mq::ProgOptions dataconfig;
+  dataconfig.SetProperty<std::string>("session", session);
+  auto datafactory = fair::mq::TransportFactory::CreateTransportFactory(mergertransport, fair::mq::tools::Uuid(), &dataconfig);
+  auto datachannel = new fair::mq::Channel{"simdata", "push", datafactory};
   datachannel->Connect(mergeraddress);
   datachannel->Validate();
   // the channels are setup
@@ -287,6 +295,7 @@ int main(int argc, char* argv[])
       ("id","ID")
       ("config-key","config key")
       ("mq-config",bpo::value<std::string>(),"path to FairMQ config")
+      ("session",bpo::value<std::string>()->default_value("default"),"FairMQ session (shared memory of the simdata channel)")
       ("severity","log severity");
   // clang-format on
   bpo::variables_map vm;
@@ -318,6 +327,7 @@ int main(int argc, char* argv[])
     // retrieve correct server and merger URLs
     std::string serveraddress;
     std::string mergeraddress;
+    std::string mergertransport("zeromq");
     std::string serverstatus_address;
     std::string s;
 
@@ -347,6 +357,9 @@ int main(int argc, char* argv[])
                 auto sockets = channel["sockets"].GetArray();
                 auto address = (sockets[0])["address"].GetString();
                 mergeraddress = address;
+                if (channel.HasMember("transport")) {
+                  mergertransport = channel["transport"].GetString();
+                }
               }
             }
           }
@@ -356,7 +369,7 @@ int main(int argc, char* argv[])
 
     LOG(info) << "Parsed primary server address " << serveraddress;
     LOG(info) << "Parsed primary server status address " << serverstatus_address;
-    LOG(info) << "Parsed merger address " << mergeraddress;
+    LOG(info) << "Parsed merger address " << mergeraddress << " (transport " << mergertransport << ")";
     if (serveraddress.empty() || mergeraddress.empty()) {
       throw std::runtime_error("Could not determine server or merger URLs.");
     }
@@ -419,7 +432,7 @@ int main(int argc, char* argv[])
         // this can be made configurable via environment variables??
         pinToCPU(i);
 
-        auto kernelSetup = initSim("zeromq", serveraddress, serverstatus_address, mergeraddress, i);
+        auto kernelSetup = initSim("zeromq", serveraddress, serverstatus_address, mergeraddress, mergertransport, vm["session"].as<std::string>(), i);
 
         std::stringstream worker;
         worker << "WORKER" << i;
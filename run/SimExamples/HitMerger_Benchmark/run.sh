@@ -0,0 +1,25 @@
+#!/usr/bin/env bash
+#
+# Benchmark of the hit merger: a synthetic load of box-gun events with many particles
+# is transported by several workers into many detectors and the merger merges and
+# writes the hits with a different number of threads each time.
+# The time spent in merging and the share of time the merger was busy receiving data
+# are taken from the merger log.
+#
+
+MODULES="PIPE ITS MFT TPC TOF TRD EMC HMP PHS FT0 FV0 FDD MCH MID ZDC"
+EVENTS=${EVENTS:-20}
+NWORKERS=${NWORKERS:-8}
+NPARTICLES=${NPARTICLES:-500}
+THREADS=${THREADS:-"1 2 4 8"}
+
+for nthreads in ${THREADS}; do
+  prefix=merger_${nthreads}threads
+  ALICE_O2SIMMERGER_NTHREADS=${nthreads} o2-sim -j ${NWORKERS} -n ${EVENTS} -g boxgen -m ${MODULES} \
+    --configKeyValues "BoxGun.number=${NPARTICLES};BoxGun.prange[0]=0.5;BoxGun.prange[1]=5" \
+    --seed 1 -o ${prefix} > ${prefix}.log 2>&1
+
+  mergetime=$(grep "Merge/flush for" ${prefix}_mergerlog | awk '{s += $NF} END {print s}')
+  echo "${nthreads} merger threads: merge/flush time ${mergetime} s"
+  grep "SIMDATA-STAMP" ${prefix}_mergerlog
+done
@@ -14,6 +14,7 @@
 #include <fairmq/TransportFactory.h>
 #include <fairmq/Channel.h>
 #include <fairmq/Message.h>
+#include <fairmq/shmem/Monitor.h>
 
 #include <cstdlib>
 #include <unistd.h>
@@ -89,6 +90,13 @@ void remove_tmp_files()
   }
 }
 
+// the FairMQ session of the workers and the merger, holding the
+// shared memory of the simdata channel
+std::string getSimDataSession()
+{
+  return std::string("o2sim-") + std::to_string(getpid());
+}
+
 void cleanup()
 {
   auto& conf = o2::conf::SimConfig::Instance();
@@ -115,6 +123,7 @@ void cleanup()
   }
   remove_tmp_files();
   o2::utils::ShmManager::Instance().release();
+  fair::mq::shmem::Monitor::Cleanup(fair::mq::shmem::SessionId{getSimDataSession()}, false);
 
   // special mode in which we dump the output from various
   // log files to terminal (mainly interesting for CI mode)
@@ -454,6 +463,7 @@ int main(int argc, char* argv[])
   configss << rootpath << "/share/config/o2simtopology_template.json";
   auto localconfig = std::string("o2simtopology_") + std::to_string(getpid()) + std::string(".json");
 
+  const auto simdatasession = getSimDataSession();
   // need to add pid to channel urls to allow simultaneous deploys!
   // we simply insert the PID into the topology template
   std::ifstream in(configss.str());
@@ -651,7 +661,7 @@ int main(int argc, char* argv[])
       const std::string path = installpath + "/" + name;
 
       execl(path.c_str(), name.c_str(), "--control", "static", "--id", workerss.str().c_str(), "--config-key",
-            "worker", "--mq-config", localconfig.c_str(), "--severity", "info", (char*)nullptr);
+            "worker", "--mq-config", localconfig.c_str(), "--session", simdatasession.c_str(), "--severity", "info", (char*)nullptr);
       return 0;
     } else {
       gChildProcesses.push_back(pid);
@@ -680,7 +690,7 @@ int main(int argc, char* argv[])
     setenv("ALICE_O2SIMMERGERTODRIVER_PIPE", std::to_string(pipe_mergerdriver_fd[1]).c_str(), 1);
     const std::string name("o2-sim-hit-merger-runner");
     const std::string path = installpath + "/" + name;
-    execl(path.c_str(), name.c_str(), "--control", "static", "--catch-signals", "0", "--id", "hitmerger", "--mq-config", localconfig.c_str(), "--color", "false",
+    execl(path.c_str(), name.c_str(), "--control", "static", "--catch-signals", "0", "--id", "hitmerger", "--mq-config", localconfig.c_str(), "--session", simdatasession.c_str(), "--color", "false",
           (char*)nullptr);
     return 0;
   } else {